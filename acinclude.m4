@@ -7,6 +7,74 @@ AC_DEFUN([AX_LIBFWPS_CHECK_LOCAL],
   [dnl No additional checks.
   ])
 
+dnl Function to detect whether allocation statistics should be enabled
+AC_DEFUN([AX_LIBFWPS_CHECK_ENABLE_ALLOCATION_STATISTICS],
+  [AX_COMMON_ARG_ENABLE(
+    [allocation-statistics],
+    [allocation_statistics],
+    [enable allocation statistics],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_allocation_statistics" != xno ],
+    [AC_DEFINE(
+      [HAVE_ALLOCATION_STATISTICS],
+      [1],
+      [Define to 1 if allocation statistics should be used.])
+
+    ac_cv_enable_allocation_statistics=yes])
+  ])
+
+dnl Function to detect whether parse tracing should be enabled
+AC_DEFUN([AX_LIBFWPS_CHECK_ENABLE_PARSE_TRACING],
+  [AX_COMMON_ARG_ENABLE(
+    [parse-tracing],
+    [parse_tracing],
+    [enable parse tracing functions and value type statistics],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_parse_tracing" != xno ],
+    [AC_DEFINE(
+      [HAVE_PARSE_TRACING],
+      [1],
+      [Define to 1 if parse tracing should be used.])
+
+    AC_SEARCH_LIBS(
+      [clock_gettime],
+      [rt])
+
+    AC_CHECK_FUNCS([clock_gettime])
+
+    ac_cv_enable_parse_tracing=yes])
+  ])
+
+dnl Function to detect if fwpstools dependencies are available
+AC_DEFUN([AX_FWPSTOOLS_CHECK_LOCAL],
+  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+
+  AC_CHECK_FUNCS([close getopt setvbuf])
+
+  AS_IF(
+   [test "x$ac_cv_func_close" != xyes],
+   [AC_MSG_FAILURE(
+     [Missing function: close],
+     [1])
+   ])
+
+  dnl Headers included in fwpstools/export_handle.c
+  AC_CHECK_HEADERS([dirent.h sys/stat.h])
+  ])
+
+dnl Function to detect if benchmarks dependencies are available
+AC_DEFUN([AX_BENCHMARKS_CHECK_LOCAL],
+  [AC_SEARCH_LIBS(
+    [clock_gettime],
+    [rt])
+
+  AC_CHECK_FUNCS([clock_gettime])
+  ])
+
 dnl Function to check if DLL support is needed
 AC_DEFUN([AX_LIBFWPS_CHECK_DLL_SUPPORT],
   [AS_IF(
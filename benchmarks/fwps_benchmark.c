@@ -0,0 +1,2322 @@
+/*
+ * Library parsing and getter micro-benchmark program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_benchmark_libcerror.h"
+#include "fwps_benchmark_libfwps.h"
+#include "fwps_benchmark_memory.h"
+#include "fwps_benchmark_timer.h"
+#include "fwps_benchmark_unused.h"
+#include "fwps_generator.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+#include "../libfwps/libfwps_definitions.h"
+#include "../libfwps/libfwps_record.h"
+
+#define FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS	1
+#endif
+
+/* The default minimum duration of a timed run in milliseconds
+ */
+#define FWPS_BENCHMARK_DEFAULT_MINIMUM_DURATION	250
+
+/* The size of the blocks in which an input file is read
+ */
+#define FWPS_BENCHMARK_READ_BLOCK_SIZE		( 64 * 1024 )
+
+/* The maximum number of spans of an input
+ */
+#define FWPS_BENCHMARK_MAXIMUM_NUMBER_OF_SPANS	( 16 * 1024 * 1024 )
+
+enum FWPS_BENCHMARK_INPUT_TYPES
+{
+	FWPS_BENCHMARK_INPUT_TYPE_UNKNOWN	= 0,
+	FWPS_BENCHMARK_INPUT_TYPE_STORE		= 1,
+	FWPS_BENCHMARK_INPUT_TYPE_SET		= 2,
+	FWPS_BENCHMARK_INPUT_TYPE_RECORD	= 3
+};
+
+enum FWPS_BENCHMARK_RECORD_TYPES
+{
+	FWPS_BENCHMARK_RECORD_TYPE_NAMED	= 1,
+	FWPS_BENCHMARK_RECORD_TYPE_NUMERIC	= 2
+};
+
+/* The identifier of a set that contains named records
+ */
+const uint8_t fwps_benchmark_named_set_identifier[ 16 ] = {
+	0x05, 0xd5, 0xcd, 0xd5, 0x9c, 0x2e, 0x1b, 0x10, 0x93, 0x97, 0x08, 0x00, 0x2b, 0x2c, 0xf9, 0xae };
+
+typedef struct fwps_benchmark_span fwps_benchmark_span_t;
+
+struct fwps_benchmark_span
+{
+	/* The offset of the span in the input data
+	 */
+	size_t offset;
+
+	/* The size of the span
+	 */
+	size_t size;
+
+	/* The record type, only used for record spans
+	 */
+	uint8_t record_type;
+};
+
+typedef struct fwps_benchmark_input fwps_benchmark_input_t;
+
+struct fwps_benchmark_input
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The input type
+	 */
+	int input_type;
+
+	/* The set spans
+	 */
+	fwps_benchmark_span_t *set_spans;
+
+	/* The number of set spans
+	 */
+	int number_of_set_spans;
+
+	/* The record spans
+	 */
+	fwps_benchmark_span_t *record_spans;
+
+	/* The number of record spans
+	 */
+	int number_of_record_spans;
+
+	/* The store, used by the getter benchmarks of store inputs
+	 */
+	libfwps_store_t *store;
+
+	/* The set, used by the getter benchmarks of set inputs
+	 */
+	libfwps_set_t *set;
+
+#if defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS )
+	/* The record, used by the getter benchmarks of record inputs
+	 */
+	libfwps_record_t *record;
+#endif
+
+	/* The records
+	 */
+	libfwps_record_t **records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+};
+
+typedef struct fwps_benchmark_result fwps_benchmark_result_t;
+
+struct fwps_benchmark_result
+{
+	/* The number of iterations of the timed run
+	 */
+	uint64_t number_of_iterations;
+
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+
+	/* The elapsed number of processor cycles
+	 */
+	uint64_t elapsed_cycles;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* Value to indicate the elapsed number of processor cycles is available
+	 */
+	int has_cycles;
+
+	/* Value to indicate the number of allocations is available
+	 */
+	int has_allocations;
+};
+
+typedef struct fwps_benchmark_getter_context fwps_benchmark_getter_context_t;
+
+struct fwps_benchmark_getter_context
+{
+	/* The getter function
+	 */
+	int (*getter_function)(
+	       libfwps_record_t *record,
+	       fwps_benchmark_getter_context_t *getter_context,
+	       libcerror_error_t **error );
+
+	/* The records the getter is applicable to
+	 */
+	libfwps_record_t **records;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The UTF-8 string buffer
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string buffer size
+	 */
+	size_t utf8_string_size;
+
+	/* The UTF-16 string buffer
+	 */
+	uint16_t *utf16_string;
+
+	/* The UTF-16 string buffer size
+	 */
+	size_t utf16_string_size;
+};
+
+typedef struct fwps_benchmark_getter fwps_benchmark_getter_t;
+
+struct fwps_benchmark_getter
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The getter function
+	 */
+	int (*getter_function)(
+	       libfwps_record_t *record,
+	       fwps_benchmark_getter_context_t *getter_context,
+	       libcerror_error_t **error );
+};
+
+/* The minimum duration of a timed run in nanoseconds
+ */
+uint64_t fwps_benchmark_minimum_duration = (uint64_t) FWPS_BENCHMARK_DEFAULT_MINIMUM_DURATION * 1000000UL;
+
+/* Prints usage information
+ */
+void fwps_benchmark_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwps_benchmark to time the parsing functions and getters of libfwps.\n\n" );
+
+	fprintf( stream, "Usage: fwps_benchmark [ -d milliseconds ] [ -hS ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: a file that contains a property store, set or record\n\n" );
+
+	fprintf( stream, "\t-d:     minimum duration of every timed run in milliseconds\n"
+	                 "\t        (default is %d)\n",
+	         FWPS_BENCHMARK_DEFAULT_MINIMUM_DURATION );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-S:     do not benchmark the synthetic stores\n" );
+}
+
+/* Reads all data of a file
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_read_file(
+     const char *filename,
+     uint8_t **file_data,
+     size_t *file_data_size,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	uint8_t *data         = NULL;
+	uint8_t *reallocation = NULL;
+	static char *function = "fwps_benchmark_read_file";
+	size_t allocated_size = 0;
+	size_t data_size      = 0;
+	size_t read_count     = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data size.",
+		 function );
+
+		return( -1 );
+	}
+	stream = file_stream_open(
+	          filename,
+	          "rb" );
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( allocated_size - data_size ) < FWPS_BENCHMARK_READ_BLOCK_SIZE )
+		{
+			if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: file: %s too large.",
+				 function,
+				 filename );
+
+				goto on_error;
+			}
+			if( allocated_size == 0 )
+			{
+				allocated_size = FWPS_BENCHMARK_READ_BLOCK_SIZE;
+			}
+			else
+			{
+				allocated_size *= 2;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            data,
+			                            sizeof( uint8_t ) * allocated_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data.",
+				 function );
+
+				goto on_error;
+			}
+			data = reallocation;
+		}
+		read_count = file_stream_read(
+		              stream,
+		              &( data[ data_size ] ),
+		              allocated_size - data_size );
+
+		data_size += read_count;
+	}
+	while( read_count > 0 );
+
+	if( file_stream_at_end(
+	     stream ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	*file_data      = data;
+	*file_data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Appends a span to an array of spans
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_spans_append(
+     fwps_benchmark_span_t **spans,
+     int *number_of_spans,
+     size_t offset,
+     size_t size,
+     uint8_t record_type,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_span_t *reallocation = NULL;
+	static char *function               = "fwps_benchmark_spans_append";
+
+	if( *number_of_spans >= FWPS_BENCHMARK_MAXIMUM_NUMBER_OF_SPANS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of spans value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *number_of_spans % 256 ) == 0 )
+	{
+		reallocation = (fwps_benchmark_span_t *) memory_reallocate(
+		                                          *spans,
+		                                          sizeof( fwps_benchmark_span_t ) * ( *number_of_spans + 256 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize spans.",
+			 function );
+
+			return( -1 );
+		}
+		*spans = reallocation;
+	}
+	( *spans )[ *number_of_spans ].offset      = offset;
+	( *spans )[ *number_of_spans ].size        = size;
+	( *spans )[ *number_of_spans ].record_type = record_type;
+
+	*number_of_spans += 1;
+
+	return( 1 );
+}
+
+/* Determines the record spans of the set at a specific offset
+ * Returns 1 if successful, 0 if the set is not supported or -1 on error
+ */
+int fwps_benchmark_input_get_record_spans(
+     fwps_benchmark_input_t *input,
+     size_t set_offset,
+     size_t set_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *set_data = NULL;
+	size_t record_offset    = 0;
+	uint32_t record_size    = 0;
+	uint8_t record_type     = FWPS_BENCHMARK_RECORD_TYPE_NUMERIC;
+
+	if( ( set_size < 24 )
+	 || ( set_size > input->data_size )
+	 || ( set_offset > ( input->data_size - set_size ) ) )
+	{
+		return( 0 );
+	}
+	set_data = &( input->data[ set_offset ] );
+
+	if( memory_compare(
+	     &( set_data[ 4 ] ),
+	     "1SPS",
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( set_data[ 8 ] ),
+	     fwps_benchmark_named_set_identifier,
+	     16 ) == 0 )
+	{
+		record_type = FWPS_BENCHMARK_RECORD_TYPE_NAMED;
+	}
+	record_offset = 24;
+
+	while( ( set_size - record_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( set_data[ record_offset ] ),
+		 record_size );
+
+		if( record_size == 0 )
+		{
+			break;
+		}
+		if( (size_t) record_size > ( set_size - record_offset ) )
+		{
+			break;
+		}
+		if( fwps_benchmark_spans_append(
+		     &( input->record_spans ),
+		     &( input->number_of_record_spans ),
+		     set_offset + record_offset,
+		     (size_t) record_size,
+		     record_type,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		record_offset += record_size;
+	}
+	return( 1 );
+}
+
+/* Determines the set and record spans of an input
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_input_get_spans(
+     fwps_benchmark_input_t *input,
+     libcerror_error_t **error )
+{
+	size_t set_offset = 0;
+	uint32_t set_size = 0;
+	int result        = 0;
+
+	if( input->input_type == FWPS_BENCHMARK_INPUT_TYPE_RECORD )
+	{
+		return( fwps_benchmark_spans_append(
+		         &( input->record_spans ),
+		         &( input->number_of_record_spans ),
+		         0,
+		         input->data_size,
+		         FWPS_BENCHMARK_RECORD_TYPE_NUMERIC,
+		         error ) );
+	}
+	while( ( input->data_size - set_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( input->data[ set_offset ] ),
+		 set_size );
+
+		if( input->input_type == FWPS_BENCHMARK_INPUT_TYPE_SET )
+		{
+			set_size = (uint32_t) input->data_size;
+		}
+		else if( set_size == 0 )
+		{
+			break;
+		}
+		result = fwps_benchmark_input_get_record_spans(
+		          input,
+		          set_offset,
+		          (size_t) set_size,
+		          error );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( fwps_benchmark_spans_append(
+		     &( input->set_spans ),
+		     &( input->number_of_set_spans ),
+		     set_offset,
+		     (size_t) set_size,
+		     0,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( input->input_type == FWPS_BENCHMARK_INPUT_TYPE_SET )
+		{
+			break;
+		}
+		set_offset += set_size;
+	}
+	return( 1 );
+}
+
+/* Appends a record to the records of an input
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_input_append_record(
+     fwps_benchmark_input_t *input,
+     libfwps_record_t *record,
+     libcerror_error_t **error )
+{
+	libfwps_record_t **reallocation = NULL;
+	static char *function           = "fwps_benchmark_input_append_record";
+
+	if( ( input->number_of_records % 256 ) == 0 )
+	{
+		reallocation = (libfwps_record_t **) memory_reallocate(
+		                                      input->records,
+		                                      sizeof( libfwps_record_t * ) * ( input->number_of_records + 256 ) );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			return( -1 );
+		}
+		input->records = reallocation;
+	}
+	input->records[ input->number_of_records++ ] = record;
+
+	return( 1 );
+}
+
+/* Appends the records of a set to the records of an input
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_input_append_set_records(
+     fwps_benchmark_input_t *input,
+     libfwps_set_t *set,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *record = NULL;
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	if( libfwps_set_get_number_of_records(
+	     set,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfwps_set_get_record_by_index(
+		     set,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( fwps_benchmark_input_append_record(
+		     input,
+		     record,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens an input
+ * The input type is determined by parsing the data as a store, set and record
+ * Returns 1 if successful, 0 if the data is not supported or -1 on error
+ */
+int fwps_benchmark_input_open(
+     fwps_benchmark_input_t *input,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *parse_error = NULL;
+	libfwps_set_t *set             = NULL;
+	int number_of_sets             = 0;
+	int result                     = 0;
+	int set_index                  = 0;
+
+	if( libfwps_store_initialize(
+	     &( input->store ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libfwps_store_copy_from_byte_stream(
+	          input->store,
+	          input->data,
+	          input->data_size,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &parse_error );
+
+	libcerror_error_free(
+	 &parse_error );
+
+	if( result == 1 )
+	{
+		input->input_type = FWPS_BENCHMARK_INPUT_TYPE_STORE;
+
+		if( libfwps_store_get_number_of_sets(
+		     input->store,
+		     &number_of_sets,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		for( set_index = 0;
+		     set_index < number_of_sets;
+		     set_index++ )
+		{
+			if( libfwps_store_get_set_by_index(
+			     input->store,
+			     set_index,
+			     &set,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_benchmark_input_append_set_records(
+			     input,
+			     set,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	if( libfwps_store_free(
+	     &( input->store ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfwps_set_initialize(
+	     &( input->set ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libfwps_set_copy_from_byte_stream(
+	          input->set,
+	          input->data,
+	          input->data_size,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &parse_error );
+
+	libcerror_error_free(
+	 &parse_error );
+
+	if( result == 1 )
+	{
+		input->input_type = FWPS_BENCHMARK_INPUT_TYPE_SET;
+
+		return( fwps_benchmark_input_append_set_records(
+		         input,
+		         input->set,
+		         error ) );
+	}
+	if( libfwps_set_free(
+	     &( input->set ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+#if defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS )
+	if( libfwps_record_initialize(
+	     &( input->record ),
+	     LIBFWPS_RECORD_TYPE_NUMERIC,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libfwps_record_copy_from_byte_stream(
+	          input->record,
+	          input->data,
+	          input->data_size,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &parse_error );
+
+	libcerror_error_free(
+	 &parse_error );
+
+	if( result == 1 )
+	{
+		input->input_type = FWPS_BENCHMARK_INPUT_TYPE_RECORD;
+
+		return( fwps_benchmark_input_append_record(
+		         input,
+		         input->record,
+		         error ) );
+	}
+	if( libfwps_record_free(
+	     &( input->record ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+#endif /* defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS ) */
+
+	return( 0 );
+}
+
+/* Closes an input and frees its data
+ */
+void fwps_benchmark_input_close(
+      fwps_benchmark_input_t *input )
+{
+	if( input->records != NULL )
+	{
+		memory_free(
+		 input->records );
+
+		input->records = NULL;
+	}
+	input->number_of_records = 0;
+
+	if( input->store != NULL )
+	{
+		libfwps_store_free(
+		 &( input->store ),
+		 NULL );
+	}
+	if( input->set != NULL )
+	{
+		libfwps_set_free(
+		 &( input->set ),
+		 NULL );
+	}
+#if defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS )
+	if( input->record != NULL )
+	{
+		libfwps_record_free(
+		 &( input->record ),
+		 NULL );
+	}
+#endif
+	if( input->set_spans != NULL )
+	{
+		memory_free(
+		 input->set_spans );
+
+		input->set_spans = NULL;
+	}
+	input->number_of_set_spans = 0;
+
+	if( input->record_spans != NULL )
+	{
+		memory_free(
+		 input->record_spans );
+
+		input->record_spans = NULL;
+	}
+	input->number_of_record_spans = 0;
+	input->input_type             = FWPS_BENCHMARK_INPUT_TYPE_UNKNOWN;
+
+	if( input->data != NULL )
+	{
+		memory_free(
+		 input->data );
+
+		input->data = NULL;
+	}
+	input->data_size = 0;
+}
+
+/* Runs a benchmark function repeatedly until the minimum duration has passed
+ * Only the last run of iterations is measured, the earlier runs serve as warm-up
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_run(
+     int (*benchmark_function)(
+            void *context,
+            libcerror_error_t **error ),
+     void *context,
+     fwps_benchmark_result_t *result,
+     libcerror_error_t **error )
+{
+	uint64_t end_allocations      = 0;
+	uint64_t end_cycles           = 0;
+	uint64_t end_time             = 0;
+	uint64_t iteration            = 0;
+	uint64_t number_of_iterations = 1;
+	uint64_t start_allocations    = 0;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+
+	if( benchmark_function(
+	     context,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	while( number_of_iterations < ( (uint64_t) 1 << 40 ) )
+	{
+		fwps_benchmark_memory_get_number_of_allocations(
+		 &start_allocations );
+
+		fwps_benchmark_timer_get_cycles(
+		 &start_cycles );
+
+		start_time = fwps_benchmark_timer_get_nanoseconds();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( benchmark_function(
+			     context,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		end_time = fwps_benchmark_timer_get_nanoseconds();
+
+		result->has_cycles = fwps_benchmark_timer_get_cycles(
+		                      &end_cycles );
+
+		result->has_allocations = fwps_benchmark_memory_get_number_of_allocations(
+		                           &end_allocations );
+
+		if( ( end_time - start_time ) >= fwps_benchmark_minimum_duration )
+		{
+			break;
+		}
+		number_of_iterations *= 2;
+	}
+	result->number_of_iterations  = number_of_iterations;
+	result->elapsed_time          = end_time - start_time;
+	result->elapsed_cycles        = end_cycles - start_cycles;
+	result->number_of_allocations = end_allocations - start_allocations;
+
+	return( 1 );
+}
+
+/* Prints the header of the benchmark results
+ */
+void fwps_benchmark_header_fprint(
+      FILE *stream )
+{
+	fprintf(
+	 stream,
+	 "%-50s %-16s %10s %12s %12s %10s %12s %12s\n",
+	 "benchmark",
+	 "input",
+	 "iterations",
+	 "ns/iter",
+	 "records/s",
+	 "MiB/s",
+	 "allocs/rec",
+	 "cycles/byte" );
+}
+
+/* Prints a benchmark result
+ * The number of records and bytes are those processed by a single iteration
+ */
+void fwps_benchmark_result_fprint(
+      FILE *stream,
+      const char *benchmark_name,
+      const char *input_name,
+      fwps_benchmark_result_t *result,
+      uint64_t number_of_records,
+      uint64_t number_of_bytes )
+{
+	double elapsed_time            = (double) result->elapsed_time;
+	double total_number_of_bytes   = (double) number_of_bytes * (double) result->number_of_iterations;
+	double total_number_of_records = (double) number_of_records * (double) result->number_of_iterations;
+
+	if( elapsed_time < 1.0 )
+	{
+		elapsed_time = 1.0;
+	}
+	fprintf(
+	 stream,
+	 "%-50s %-16s %10" PRIu64 " %12.1f %12.0f %10.1f ",
+	 benchmark_name,
+	 input_name,
+	 result->number_of_iterations,
+	 elapsed_time / (double) result->number_of_iterations,
+	 ( total_number_of_records * 1000000000.0 ) / elapsed_time,
+	 ( total_number_of_bytes * 1000000000.0 ) / ( elapsed_time * 1048576.0 ) );
+
+	if( ( result->has_allocations != 0 )
+	 && ( total_number_of_records > 0.0 ) )
+	{
+		fprintf(
+		 stream,
+		 "%12.2f ",
+		 (double) result->number_of_allocations / total_number_of_records );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "%12s ",
+		 "n/a" );
+	}
+	if( ( result->has_cycles != 0 )
+	 && ( total_number_of_bytes > 0.0 ) )
+	{
+		fprintf(
+		 stream,
+		 "%12.2f\n",
+		 (double) result->elapsed_cycles / total_number_of_bytes );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "%12s\n",
+		 "n/a" );
+	}
+}
+
+/* Parses the data of an input as a store
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_store_copy_from_byte_stream(
+     void *context,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_input_t *input = (fwps_benchmark_input_t *) context;
+	libfwps_store_t *store        = NULL;
+
+	if( libfwps_store_initialize(
+	     &store,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfwps_store_copy_from_byte_stream(
+	     store,
+	     input->data,
+	     input->data_size,
+	     LIBFWPS_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+
+		return( -1 );
+	}
+	return( libfwps_store_free(
+	         &store,
+	         error ) );
+}
+
+/* Record callback function of the scan benchmark
+ * Returns 1 to continue the scan
+ */
+int fwps_benchmark_scan_record_callback(
+     const uint8_t *set_identifier FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	uint32_t value_type = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( set_identifier )
+
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*( (uint64_t *) callback_data ) += value_type;
+
+	return( 1 );
+}
+
+/* Scans the data of an input as a store
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_store_scan_byte_stream(
+     void *context,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_input_t *input = (fwps_benchmark_input_t *) context;
+	uint64_t checksum             = 0;
+
+	return( libfwps_store_scan_byte_stream(
+	         input->data,
+	         input->data_size,
+	         LIBFWPS_CODEPAGE_WINDOWS_1252,
+	         &fwps_benchmark_scan_record_callback,
+	         (void *) &checksum,
+	         error ) );
+}
+
+/* Parses the sets of an input
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_set_copy_from_byte_stream(
+     void *context,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_input_t *input = (fwps_benchmark_input_t *) context;
+	fwps_benchmark_span_t *span   = NULL;
+	libfwps_set_t *set            = NULL;
+	int span_index                = 0;
+
+	for( span_index = 0;
+	     span_index < input->number_of_set_spans;
+	     span_index++ )
+	{
+		span = &( input->set_spans[ span_index ] );
+
+		if( libfwps_set_initialize(
+		     &set,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfwps_set_copy_from_byte_stream(
+		     set,
+		     &( input->data[ span->offset ] ),
+		     span->size,
+		     LIBFWPS_CODEPAGE_WINDOWS_1252,
+		     error ) != 1 )
+		{
+			libfwps_set_free(
+			 &set,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libfwps_set_free(
+		     &set,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS )
+
+/* Parses the records of an input
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_record_copy_from_byte_stream(
+     void *context,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_input_t *input = (fwps_benchmark_input_t *) context;
+	fwps_benchmark_span_t *span   = NULL;
+	libfwps_record_t *record      = NULL;
+	int span_index                = 0;
+
+	for( span_index = 0;
+	     span_index < input->number_of_record_spans;
+	     span_index++ )
+	{
+		span = &( input->record_spans[ span_index ] );
+
+		if( libfwps_record_initialize(
+		     &record,
+		     span->record_type,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfwps_record_copy_from_byte_stream(
+		     record,
+		     &( input->data[ span->offset ] ),
+		     span->size,
+		     LIBFWPS_CODEPAGE_WINDOWS_1252,
+		     error ) != 1 )
+		{
+			libfwps_record_free(
+			 &record,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libfwps_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS ) */
+
+/* Retrieves the record data as a boolean
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_boolean(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint8_t value_boolean = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_boolean(
+	         record,
+	         &value_boolean,
+	         error ) );
+}
+
+/* Retrieves the record data as an 8-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_8bit_integer(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint8_t value_8bit = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_8bit_integer(
+	         record,
+	         &value_8bit,
+	         error ) );
+}
+
+/* Retrieves the record data as a 16-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_16bit_integer(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint16_t value_16bit = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_16bit_integer(
+	         record,
+	         &value_16bit,
+	         error ) );
+}
+
+/* Retrieves the record data as a 32-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_32bit_integer(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint32_t value_32bit = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_32bit_integer(
+	         record,
+	         &value_32bit,
+	         error ) );
+}
+
+/* Retrieves the record data as a 64-bit integer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_64bit_integer(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint64_t value_64bit = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_64bit_integer(
+	         record,
+	         &value_64bit,
+	         error ) );
+}
+
+/* Retrieves the record data as a FILETIME timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_filetime(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint64_t filetime = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_filetime(
+	         record,
+	         &filetime,
+	         error ) );
+}
+
+/* Retrieves the record data as a floatingtime timestamp
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_floatingtime(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint64_t floatingtime = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_floatingtime(
+	         record,
+	         &floatingtime,
+	         error ) );
+}
+
+/* Retrieves the record data as a floating point
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_floating_point(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	double value_floating_point = 0.0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_floating_point(
+	         record,
+	         &value_floating_point,
+	         error ) );
+}
+
+/* Retrieves the record data as a GUID
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_guid(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	uint8_t guid_data[ 16 ];
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_guid(
+	         record,
+	         guid_data,
+	         16,
+	         error ) );
+}
+
+/* Retrieves the size of the record data as an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf8_string_size(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_size = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_utf8_string_size(
+	         record,
+	         &utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the record data as an UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf8_string(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_size = 0;
+
+	if( libfwps_record_get_data_as_utf8_string_size(
+	     record,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf8_string_size > getter_context->utf8_string_size )
+	{
+		return( -1 );
+	}
+	return( libfwps_record_get_data_as_utf8_string(
+	         record,
+	         getter_context->utf8_string,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the size of the record data as an UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf16_string_size(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	size_t utf16_string_size = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_utf16_string_size(
+	         record,
+	         &utf16_string_size,
+	         error ) );
+}
+
+/* Retrieves the record data as an UTF-16 string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf16_string(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context,
+     libcerror_error_t **error )
+{
+	size_t utf16_string_size = 0;
+
+	if( libfwps_record_get_data_as_utf16_string_size(
+	     record,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf16_string_size > getter_context->utf16_string_size )
+	{
+		return( -1 );
+	}
+	return( libfwps_record_get_data_as_utf16_string(
+	         record,
+	         getter_context->utf16_string,
+	         utf16_string_size,
+	         error ) );
+}
+
+/* Retrieves the size of the record data as an UTF-8 path string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf8_path_string_size(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_size = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_utf8_path_string_size(
+	         record,
+	         &utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the record data as an UTF-8 path string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf8_path_string(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_size = 0;
+
+	if( libfwps_record_get_data_as_utf8_path_string_size(
+	     record,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf8_string_size > getter_context->utf8_string_size )
+	{
+		return( -1 );
+	}
+	return( libfwps_record_get_data_as_utf8_path_string(
+	         record,
+	         getter_context->utf8_string,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the size of the record data as an UTF-16 path string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf16_path_string_size(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context FWPS_BENCHMARK_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	size_t utf16_string_size = 0;
+
+	FWPS_BENCHMARK_UNREFERENCED_PARAMETER( getter_context )
+
+	return( libfwps_record_get_data_as_utf16_path_string_size(
+	         record,
+	         &utf16_string_size,
+	         error ) );
+}
+
+/* Retrieves the record data as an UTF-16 path string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_get_data_as_utf16_path_string(
+     libfwps_record_t *record,
+     fwps_benchmark_getter_context_t *getter_context,
+     libcerror_error_t **error )
+{
+	size_t utf16_string_size = 0;
+
+	if( libfwps_record_get_data_as_utf16_path_string_size(
+	     record,
+	     &utf16_string_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( utf16_string_size > getter_context->utf16_string_size )
+	{
+		return( -1 );
+	}
+	return( libfwps_record_get_data_as_utf16_path_string(
+	         record,
+	         getter_context->utf16_string,
+	         utf16_string_size,
+	         error ) );
+}
+
+fwps_benchmark_getter_t fwps_benchmark_getters[] = {
+	{ "libfwps_record_get_data_as_boolean", fwps_benchmark_get_data_as_boolean },
+	{ "libfwps_record_get_data_as_8bit_integer", fwps_benchmark_get_data_as_8bit_integer },
+	{ "libfwps_record_get_data_as_16bit_integer", fwps_benchmark_get_data_as_16bit_integer },
+	{ "libfwps_record_get_data_as_32bit_integer", fwps_benchmark_get_data_as_32bit_integer },
+	{ "libfwps_record_get_data_as_64bit_integer", fwps_benchmark_get_data_as_64bit_integer },
+	{ "libfwps_record_get_data_as_filetime", fwps_benchmark_get_data_as_filetime },
+	{ "libfwps_record_get_data_as_floatingtime", fwps_benchmark_get_data_as_floatingtime },
+	{ "libfwps_record_get_data_as_floating_point", fwps_benchmark_get_data_as_floating_point },
+	{ "libfwps_record_get_data_as_guid", fwps_benchmark_get_data_as_guid },
+	{ "libfwps_record_get_data_as_utf8_string_size", fwps_benchmark_get_data_as_utf8_string_size },
+	{ "libfwps_record_get_data_as_utf8_string", fwps_benchmark_get_data_as_utf8_string },
+	{ "libfwps_record_get_data_as_utf16_string_size", fwps_benchmark_get_data_as_utf16_string_size },
+	{ "libfwps_record_get_data_as_utf16_string", fwps_benchmark_get_data_as_utf16_string },
+	{ "libfwps_record_get_data_as_utf8_path_string_size", fwps_benchmark_get_data_as_utf8_path_string_size },
+	{ "libfwps_record_get_data_as_utf8_path_string", fwps_benchmark_get_data_as_utf8_path_string },
+	{ "libfwps_record_get_data_as_utf16_path_string_size", fwps_benchmark_get_data_as_utf16_path_string_size },
+	{ "libfwps_record_get_data_as_utf16_path_string", fwps_benchmark_get_data_as_utf16_path_string },
+	{ NULL, NULL } };
+
+/* Calls a getter for every applicable record
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_getter_run(
+     void *context,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_getter_context_t *getter_context = (fwps_benchmark_getter_context_t *) context;
+	int record_index                                = 0;
+
+	for( record_index = 0;
+	     record_index < getter_context->number_of_records;
+	     record_index++ )
+	{
+		if( getter_context->getter_function(
+		     getter_context->records[ record_index ],
+		     getter_context,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the sizes of the string buffers needed by the getters
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_getter_context_resize_strings(
+     fwps_benchmark_getter_context_t *getter_context,
+     fwps_benchmark_input_t *input,
+     libcerror_error_t **error )
+{
+	static char *function    = "fwps_benchmark_getter_context_resize_strings";
+	size_t string_size       = 0;
+	size_t utf16_string_size = 0;
+	size_t utf8_string_size  = 0;
+	int record_index         = 0;
+
+	for( record_index = 0;
+	     record_index < input->number_of_records;
+	     record_index++ )
+	{
+		if( libfwps_record_get_data_as_utf8_string_size(
+		     input->records[ record_index ],
+		     &string_size,
+		     NULL ) == 1 )
+		{
+			if( string_size > utf8_string_size )
+			{
+				utf8_string_size = string_size;
+			}
+		}
+		if( libfwps_record_get_data_as_utf8_path_string_size(
+		     input->records[ record_index ],
+		     &string_size,
+		     NULL ) == 1 )
+		{
+			if( string_size > utf8_string_size )
+			{
+				utf8_string_size = string_size;
+			}
+		}
+		if( libfwps_record_get_data_as_utf16_string_size(
+		     input->records[ record_index ],
+		     &string_size,
+		     NULL ) == 1 )
+		{
+			if( string_size > utf16_string_size )
+			{
+				utf16_string_size = string_size;
+			}
+		}
+		if( libfwps_record_get_data_as_utf16_path_string_size(
+		     input->records[ record_index ],
+		     &string_size,
+		     NULL ) == 1 )
+		{
+			if( string_size > utf16_string_size )
+			{
+				utf16_string_size = string_size;
+			}
+		}
+	}
+	if( ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	getter_context->utf8_string = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * ( utf8_string_size + 1 ) );
+
+	if( getter_context->utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	getter_context->utf8_string_size = utf8_string_size;
+
+	getter_context->utf16_string = (uint16_t *) memory_allocate(
+	                                             sizeof( uint16_t ) * ( utf16_string_size + 1 ) );
+
+	if( getter_context->utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	getter_context->utf16_string_size = utf16_string_size;
+
+	return( 1 );
+}
+
+/* Benchmarks the getters on the records of an input
+ * Every getter is only timed on the records it supports
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_getters_run(
+     fwps_benchmark_input_t *input,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_getter_context_t getter_context;
+	fwps_benchmark_result_t result;
+
+	libcerror_error_t *getter_error = NULL;
+	static char *function           = "fwps_benchmark_getters_run";
+	size_t data_size                = 0;
+	uint64_t number_of_bytes        = 0;
+	int getter_index                = 0;
+	int record_index                = 0;
+
+	if( memory_set(
+	     &getter_context,
+	     0,
+	     sizeof( fwps_benchmark_getter_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear getter context.",
+		 function );
+
+		return( -1 );
+	}
+	if( input->number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	if( fwps_benchmark_getter_context_resize_strings(
+	     &getter_context,
+	     input,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	getter_context.records = (libfwps_record_t **) memory_allocate(
+	                                                sizeof( libfwps_record_t * ) * input->number_of_records );
+
+	if( getter_context.records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records.",
+		 function );
+
+		goto on_error;
+	}
+	for( getter_index = 0;
+	     fwps_benchmark_getters[ getter_index ].name != NULL;
+	     getter_index++ )
+	{
+		getter_context.getter_function   = fwps_benchmark_getters[ getter_index ].getter_function;
+		getter_context.number_of_records = 0;
+
+		number_of_bytes = 0;
+
+		for( record_index = 0;
+		     record_index < input->number_of_records;
+		     record_index++ )
+		{
+			if( getter_context.getter_function(
+			     input->records[ record_index ],
+			     &getter_context,
+			     &getter_error ) != 1 )
+			{
+				libcerror_error_free(
+				 &getter_error );
+
+				continue;
+			}
+			if( libfwps_record_get_data_size(
+			     input->records[ record_index ],
+			     &data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			getter_context.records[ getter_context.number_of_records++ ] = input->records[ record_index ];
+
+			number_of_bytes += data_size;
+		}
+		if( getter_context.number_of_records == 0 )
+		{
+			continue;
+		}
+		if( fwps_benchmark_run(
+		     &fwps_benchmark_getter_run,
+		     (void *) &getter_context,
+		     &result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run benchmark: %s.",
+			 function,
+			 fwps_benchmark_getters[ getter_index ].name );
+
+			goto on_error;
+		}
+		fwps_benchmark_result_fprint(
+		 stdout,
+		 fwps_benchmark_getters[ getter_index ].name,
+		 input->name,
+		 &result,
+		 (uint64_t) getter_context.number_of_records,
+		 number_of_bytes );
+	}
+	memory_free(
+	 getter_context.records );
+
+	memory_free(
+	 getter_context.utf16_string );
+
+	memory_free(
+	 getter_context.utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( getter_context.records != NULL )
+	{
+		memory_free(
+		 getter_context.records );
+	}
+	if( getter_context.utf16_string != NULL )
+	{
+		memory_free(
+		 getter_context.utf16_string );
+	}
+	if( getter_context.utf8_string != NULL )
+	{
+		memory_free(
+		 getter_context.utf8_string );
+	}
+	return( -1 );
+}
+
+/* Runs a parse benchmark on an input and prints the result
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_benchmark_parse_run(
+     fwps_benchmark_input_t *input,
+     const char *benchmark_name,
+     int (*benchmark_function)(
+            void *context,
+            libcerror_error_t **error ),
+     uint64_t number_of_bytes,
+     libcerror_error_t **error )
+{
+	fwps_benchmark_result_t result;
+
+	static char *function = "fwps_benchmark_parse_run";
+
+	if( fwps_benchmark_run(
+	     benchmark_function,
+	     (void *) input,
+	     &result,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run benchmark: %s.",
+		 function,
+		 benchmark_name );
+
+		return( -1 );
+	}
+	fwps_benchmark_result_fprint(
+	 stdout,
+	 benchmark_name,
+	 input->name,
+	 &result,
+	 (uint64_t) input->number_of_record_spans,
+	 number_of_bytes );
+
+	return( 1 );
+}
+
+/* Benchmarks an input
+ * Returns 1 if successful, 0 if the input is not supported or -1 on error
+ */
+int fwps_benchmark_input_run(
+     fwps_benchmark_input_t *input,
+     libcerror_error_t **error )
+{
+	static char *function    = "fwps_benchmark_input_run";
+	uint64_t number_of_bytes = 0;
+	int result               = 0;
+	int span_index           = 0;
+
+	result = fwps_benchmark_input_open(
+	          input,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( fwps_benchmark_input_get_spans(
+	     input,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine spans.",
+		 function );
+
+		return( -1 );
+	}
+	if( input->input_type == FWPS_BENCHMARK_INPUT_TYPE_STORE )
+	{
+		if( fwps_benchmark_parse_run(
+		     input,
+		     "libfwps_store_copy_from_byte_stream",
+		     &fwps_benchmark_store_copy_from_byte_stream,
+		     (uint64_t) input->data_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( fwps_benchmark_parse_run(
+		     input,
+		     "libfwps_store_scan_byte_stream",
+		     &fwps_benchmark_store_scan_byte_stream,
+		     (uint64_t) input->data_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( input->number_of_set_spans > 0 )
+	{
+		number_of_bytes = 0;
+
+		for( span_index = 0;
+		     span_index < input->number_of_set_spans;
+		     span_index++ )
+		{
+			number_of_bytes += input->set_spans[ span_index ].size;
+		}
+		if( fwps_benchmark_parse_run(
+		     input,
+		     "libfwps_set_copy_from_byte_stream",
+		     &fwps_benchmark_set_copy_from_byte_stream,
+		     number_of_bytes,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+#if defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS )
+	if( input->number_of_record_spans > 0 )
+	{
+		number_of_bytes = 0;
+
+		for( span_index = 0;
+		     span_index < input->number_of_record_spans;
+		     span_index++ )
+		{
+			number_of_bytes += input->record_spans[ span_index ].size;
+		}
+		if( fwps_benchmark_parse_run(
+		     input,
+		     "libfwps_record_copy_from_byte_stream",
+		     &fwps_benchmark_record_copy_from_byte_stream,
+		     number_of_bytes,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+#endif /* defined( FWPS_BENCHMARK_HAVE_RECORD_FUNCTIONS ) */
+
+	if( fwps_benchmark_getters_run(
+	     input,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the generator options of a store with many small records
+ */
+void fwps_benchmark_set_tiny_records_options(
+      fwps_generator_options_t *options )
+{
+	options->number_of_records = 10000;
+
+	fwps_generator_options_set_value_class_weights(
+	 options,
+	 "integer",
+	 NULL );
+}
+
+/* Sets the generator options of a store with large vectors
+ */
+void fwps_benchmark_set_large_vectors_options(
+      fwps_generator_options_t *options )
+{
+	options->number_of_records   = 16;
+	options->minimum_vector_size = 65536;
+	options->maximum_vector_size = 65536;
+
+	fwps_generator_options_set_value_class_weights(
+	 options,
+	 "vector",
+	 NULL );
+}
+
+/* Sets the generator options of a store with long strings
+ */
+void fwps_benchmark_set_long_strings_options(
+      fwps_generator_options_t *options )
+{
+	options->number_of_records     = 64;
+	options->minimum_string_length = 32767;
+	options->maximum_string_length = 32767;
+
+	fwps_generator_options_set_value_class_weights(
+	 options,
+	 "string",
+	 NULL );
+}
+
+/* Sets the generator options of a store with many sets
+ */
+void fwps_benchmark_set_many_sets_options(
+      fwps_generator_options_t *options )
+{
+	options->number_of_sets        = 2000;
+	options->number_of_records     = 4;
+	options->minimum_string_length = 8;
+	options->maximum_string_length = 8;
+
+	fwps_generator_options_set_value_class_weights(
+	 options,
+	 "integer,filetime,guid,string",
+	 NULL );
+}
+
+/* Sets the generator options of a store with named records
+ */
+void fwps_benchmark_set_named_records_options(
+      fwps_generator_options_t *options )
+{
+	options->number_of_sets    = 16;
+	options->number_of_records = 256;
+	options->named_percentage  = 100;
+}
+
+/* The synthetic stores
+ */
+struct fwps_benchmark_synthetic_store
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function that sets the generator options
+	 */
+	void (*set_options_function)(
+	       fwps_generator_options_t *options );
+};
+
+struct fwps_benchmark_synthetic_store fwps_benchmark_synthetic_stores[] = {
+	{ "tiny_records", fwps_benchmark_set_tiny_records_options },
+	{ "large_vectors", fwps_benchmark_set_large_vectors_options },
+	{ "long_strings", fwps_benchmark_set_long_strings_options },
+	{ "many_sets", fwps_benchmark_set_many_sets_options },
+	{ "named_records", fwps_benchmark_set_named_records_options },
+	{ NULL, NULL } };
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	fwps_benchmark_input_t input;
+	fwps_generator_options_t generator_options;
+
+	libcerror_error_t *error = NULL;
+	const char *source       = NULL;
+	char *end_of_string      = NULL;
+	unsigned long duration   = 0;
+	int argument_index       = 1;
+	int result               = 0;
+	int store_index          = 0;
+	int use_synthetic_stores = 1;
+
+	while( argument_index < argc )
+	{
+		if( argv[ argument_index ][ 0 ] != '-' )
+		{
+			break;
+		}
+		if( narrow_string_compare(
+		     argv[ argument_index ],
+		     "-d",
+		     3 ) == 0 )
+		{
+			argument_index++;
+
+			if( argument_index >= argc )
+			{
+				fwps_benchmark_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+			}
+			duration = strtoul(
+			            argv[ argument_index ],
+			            &end_of_string,
+			            10 );
+
+			if( ( end_of_string == argv[ argument_index ] )
+			 || ( *end_of_string != 0 )
+			 || ( duration == 0 )
+			 || ( duration > 3600000UL ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported minimum duration: %s.\n",
+				 argv[ argument_index ] );
+
+				return( EXIT_FAILURE );
+			}
+			fwps_benchmark_minimum_duration = (uint64_t) duration * 1000000UL;
+		}
+		else if( narrow_string_compare(
+		          argv[ argument_index ],
+		          "-h",
+		          3 ) == 0 )
+		{
+			fwps_benchmark_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( narrow_string_compare(
+		          argv[ argument_index ],
+		          "-S",
+		          3 ) == 0 )
+		{
+			use_synthetic_stores = 0;
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported option: %s.\n",
+			 argv[ argument_index ] );
+
+			fwps_benchmark_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		argument_index++;
+	}
+	if( memory_set(
+	     &input,
+	     0,
+	     sizeof( fwps_benchmark_input_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear input.\n" );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( HAVE_FWPS_BENCHMARK_MEMORY )
+	fprintf(
+	 stdout,
+	 "Note: allocations are not counted in this build.\n" );
+#endif
+	fwps_benchmark_header_fprint(
+	 stdout );
+
+	while( argument_index < argc )
+	{
+		source = argv[ argument_index++ ];
+
+		if( fwps_benchmark_read_file(
+		     source,
+		     &( input.data ),
+		     &( input.data_size ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read source: %s.\n",
+			 source );
+
+			goto on_error;
+		}
+		input.name = narrow_string_search_character_reverse(
+		              source,
+		              '/',
+		              narrow_string_length(
+		               source ) + 1 );
+
+		if( input.name == NULL )
+		{
+			input.name = source;
+		}
+		else
+		{
+			input.name += 1;
+		}
+		result = fwps_benchmark_input_run(
+		          &input,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark source: %s.\n",
+			 source );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Skipping unsupported source: %s.\n",
+			 source );
+		}
+		fwps_benchmark_input_close(
+		 &input );
+	}
+	if( use_synthetic_stores != 0 )
+	{
+		for( store_index = 0;
+		     fwps_benchmark_synthetic_stores[ store_index ].name != NULL;
+		     store_index++ )
+		{
+			fwps_generator_options_set_defaults(
+			 &generator_options );
+
+			fwps_benchmark_synthetic_stores[ store_index ].set_options_function(
+			 &generator_options );
+
+			input.name = fwps_benchmark_synthetic_stores[ store_index ].name;
+
+			if( fwps_generator_generate_to_buffer(
+			     &generator_options,
+			     &( input.data ),
+			     &( input.data_size ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to generate synthetic store: %s.\n",
+				 input.name );
+
+				goto on_error;
+			}
+			if( fwps_benchmark_input_run(
+			     &input,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to benchmark synthetic store: %s.\n",
+				 input.name );
+
+				goto on_error;
+			}
+			fwps_benchmark_input_close(
+			 &input );
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	fwps_benchmark_input_close(
+	 &input );
+
+	return( EXIT_FAILURE );
+}
+
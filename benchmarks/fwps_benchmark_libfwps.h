@@ -0,0 +1,30 @@
+/*
+ * The libfwps header wrapper
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWPS_BENCHMARK_LIBFWPS_H )
+#define _FWPS_BENCHMARK_LIBFWPS_H
+
+#include <common.h>
+
+#include <libfwps.h>
+
+#endif /* !defined( _FWPS_BENCHMARK_LIBFWPS_H ) */
+
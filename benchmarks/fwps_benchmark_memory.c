@@ -0,0 +1,104 @@
+/*
+ * Memory allocation counting functions for benchmarking
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#include "fwps_benchmark_memory.h"
+
+#if defined( HAVE_FWPS_BENCHMARK_MEMORY )
+
+static void *(*fwps_benchmark_real_malloc)(size_t)          = NULL;
+static void *(*fwps_benchmark_real_realloc)(void *, size_t) = NULL;
+
+uint64_t fwps_benchmark_number_of_allocations               = 0;
+
+/* Custom malloc that counts the number of allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	if( fwps_benchmark_real_malloc == NULL )
+	{
+		fwps_benchmark_real_malloc = dlsym(
+		                              RTLD_NEXT,
+		                              "malloc" );
+	}
+	fwps_benchmark_number_of_allocations++;
+
+	return( fwps_benchmark_real_malloc(
+	         size ) );
+}
+
+/* Custom realloc that counts the number of allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	if( fwps_benchmark_real_realloc == NULL )
+	{
+		fwps_benchmark_real_realloc = dlsym(
+		                               RTLD_NEXT,
+		                               "realloc" );
+	}
+	fwps_benchmark_number_of_allocations++;
+
+	return( fwps_benchmark_real_realloc(
+	         ptr,
+	         size ) );
+}
+
+#endif /* defined( HAVE_FWPS_BENCHMARK_MEMORY ) */
+
+/* Retrieves the number of allocations made so far
+ * Returns 1 if successful or 0 if allocations are not counted
+ */
+int fwps_benchmark_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations )
+{
+	if( number_of_allocations == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_FWPS_BENCHMARK_MEMORY )
+	*number_of_allocations = fwps_benchmark_number_of_allocations;
+
+	return( 1 );
+#else
+	*number_of_allocations = 0;
+
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,50 @@
+/*
+ * Memory allocation counting functions for benchmarking
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWPS_BENCHMARK_MEMORY_H )
+#define _FWPS_BENCHMARK_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) && !defined( __clang__ ) && !defined( __CYGWIN__ ) && !defined( HAVE_ASAN )
+#define HAVE_FWPS_BENCHMARK_MEMORY	1
+#endif
+
+#if defined( HAVE_FWPS_BENCHMARK_MEMORY )
+
+extern uint64_t fwps_benchmark_number_of_allocations;
+
+#endif /* defined( HAVE_FWPS_BENCHMARK_MEMORY ) */
+
+int fwps_benchmark_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWPS_BENCHMARK_MEMORY_H ) */
+
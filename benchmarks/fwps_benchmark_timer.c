@@ -0,0 +1,97 @@
+/*
+ * Timing functions for benchmarking
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include <time.h>
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+
+#define FWPS_BENCHMARK_HAVE_CYCLE_COUNTER	1
+
+#elif defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <x86intrin.h>
+
+#define FWPS_BENCHMARK_HAVE_CYCLE_COUNTER	1
+#endif
+
+#include "fwps_benchmark_timer.h"
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * Returns the timestamp
+ */
+uint64_t fwps_benchmark_timer_get_nanoseconds(
+          void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency = { 0 };
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(
+		 &frequency );
+	}
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) ( ( (double) clock() * 1000000000.0 ) / (double) CLOCKS_PER_SEC ) );
+
+#endif
+}
+
+/* Retrieves the value of the processor cycle counter
+ * Returns 1 if successful or 0 if not available
+ */
+int fwps_benchmark_timer_get_cycles(
+     uint64_t *cycles )
+{
+	if( cycles == NULL )
+	{
+		return( 0 );
+	}
+#if defined( FWPS_BENCHMARK_HAVE_CYCLE_COUNTER )
+	*cycles = (uint64_t) __rdtsc();
+
+	return( 1 );
+#else
+	*cycles = 0;
+
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,328 @@
+/*
+ * Generates synthetic property stores for scale testing
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_benchmark_libcerror.h"
+#include "fwps_generator.h"
+
+/* Prints usage information
+ */
+void fwps_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwps_generate to generate a synthetic property store.\n\n" );
+
+	fprintf( stream, "Usage: fwps_generate [ -l length ] [ -m mix ] [ -n sets ] [ -N percentage ]\n"
+	                 "                     [ -r records ] [ -s seed ] [ -v size ] [ -h ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the file to write the property store to\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-l:     number of characters of strings and bytes of binary data,\n"
+	                 "\t        either minimum-maximum or a single value (default is 1-64)\n" );
+	fprintf( stream, "\t-m:     mix of value classes as comma separated class:weight pairs,\n"
+	                 "\t        the classes are: boolean, integer, float, filetime, guid, string,\n"
+	                 "\t        ascii, binary and vector (default is every class with weight 1)\n" );
+	fprintf( stream, "\t-n:     number of sets (default is 1)\n" );
+	fprintf( stream, "\t-N:     percentage of sets with named instead of numeric records\n"
+	                 "\t        (default is 0)\n" );
+	fprintf( stream, "\t-r:     number of records per set (default is 16)\n" );
+	fprintf( stream, "\t-s:     seed of the pseudo random number generator (default is 1)\n" );
+	fprintf( stream, "\t-v:     number of values of vectors, either minimum-maximum or\n"
+	                 "\t        a single value (default is 1-16)\n" );
+}
+
+/* Parses a decimal 32-bit value from a string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generate_parse_uint32(
+     const char *string,
+     uint32_t maximum_value,
+     uint32_t *value_32bit )
+{
+	char *end_of_string = NULL;
+	unsigned long value = 0;
+
+	if( ( string == NULL )
+	 || ( string[ 0 ] < '0' )
+	 || ( string[ 0 ] > '9' ) )
+	{
+		return( -1 );
+	}
+	value = strtoul(
+	         string,
+	         &end_of_string,
+	         10 );
+
+	if( ( *end_of_string != 0 )
+	 || ( value > (unsigned long) maximum_value ) )
+	{
+		return( -1 );
+	}
+	*value_32bit = (uint32_t) value;
+
+	return( 1 );
+}
+
+/* Writes generated data to a file stream
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generate_write(
+     const uint8_t *data,
+     size_t data_size,
+     void *write_data,
+     libcerror_error_t **error )
+{
+	static char *function = "fwps_generate_write";
+
+	if( file_stream_write(
+	     (FILE *) write_data,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	fwps_generator_options_t options;
+
+	libcerror_error_t *error = NULL;
+	FILE *stream             = NULL;
+	const char *option       = NULL;
+	const char *target       = NULL;
+	uint32_t value_32bit     = 0;
+	int argument_index       = 1;
+	int result               = 0;
+
+	fwps_generator_options_set_defaults(
+	 &options );
+
+	while( argument_index < argc )
+	{
+		if( argv[ argument_index ][ 0 ] != '-' )
+		{
+			break;
+		}
+		option = argv[ argument_index ];
+
+		if( narrow_string_compare(
+		     option,
+		     "-h",
+		     3 ) == 0 )
+		{
+			fwps_generate_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		if( ( narrow_string_length(
+		       option ) != 2 )
+		 || ( narrow_string_search_character(
+		       "lmnNrsv",
+		       option[ 1 ],
+		       7 ) == NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported option: %s.\n",
+			 option );
+
+			fwps_generate_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		argument_index++;
+
+		if( argument_index >= argc )
+		{
+			fwps_generate_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		switch( option[ 1 ] )
+		{
+			case 'l':
+				result = fwps_generator_options_set_range(
+				          &( options.minimum_string_length ),
+				          &( options.maximum_string_length ),
+				          argv[ argument_index ],
+				          &error );
+				break;
+
+			case 'm':
+				result = fwps_generator_options_set_value_class_weights(
+				          &options,
+				          argv[ argument_index ],
+				          &error );
+				break;
+
+			case 'n':
+				result = fwps_generate_parse_uint32(
+				          argv[ argument_index ],
+				          UINT32_MAX,
+				          &( options.number_of_sets ) );
+				break;
+
+			case 'N':
+				result = fwps_generate_parse_uint32(
+				          argv[ argument_index ],
+				          100,
+				          &value_32bit );
+
+				options.named_percentage = (uint8_t) value_32bit;
+				break;
+
+			case 'r':
+				/* Entry types 0 and 1 have a special meaning
+				 */
+				result = fwps_generate_parse_uint32(
+				          argv[ argument_index ],
+				          UINT32_MAX - 2,
+				          &( options.number_of_records ) );
+				break;
+
+			case 's':
+				result = fwps_generate_parse_uint32(
+				          argv[ argument_index ],
+				          UINT32_MAX,
+				          &value_32bit );
+
+				options.seed = (uint64_t) value_32bit;
+				break;
+
+			case 'v':
+				result = fwps_generator_options_set_range(
+				          &( options.minimum_vector_size ),
+				          &( options.maximum_vector_size ),
+				          argv[ argument_index ],
+				          &error );
+				break;
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported value: %s of option: %s.\n",
+			 argv[ argument_index ],
+			 option );
+
+			goto on_error;
+		}
+		argument_index++;
+	}
+	if( argument_index != ( argc - 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		fwps_generate_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ argument_index ];
+
+	stream = file_stream_open(
+	          target,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %s.\n",
+		 target );
+
+		goto on_error;
+	}
+	if( fwps_generator_generate(
+	     &options,
+	     &fwps_generate_write,
+	     (void *) stream,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate property store.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target: %s.\n",
+		 target );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1492 @@
+/*
+ * Synthetic property store generator functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_benchmark_libcerror.h"
+#include "fwps_benchmark_libfwps.h"
+#include "fwps_generator.h"
+
+typedef struct fwps_generator_buffer fwps_generator_buffer_t;
+
+struct fwps_generator_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated size
+	 */
+	size_t allocated_size;
+};
+
+/* The names of the value classes
+ */
+const char *fwps_generator_value_class_names[ FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES ] = {
+	"boolean",
+	"integer",
+	"float",
+	"filetime",
+	"guid",
+	"string",
+	"ascii",
+	"binary",
+	"vector" };
+
+/* The value types used by the integer value class
+ */
+const uint32_t fwps_generator_integer_value_types[ 7 ] = {
+	LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED,
+	LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED };
+
+/* The identifier of a set that contains named records
+ */
+const uint8_t fwps_generator_named_set_identifier[ 16 ] = {
+	0x05, 0xd5, 0xcd, 0xd5, 0x9c, 0x2e, 0x1b, 0x10, 0x93, 0x97, 0x08, 0x00, 0x2b, 0x2c, 0xf9, 0xae };
+
+/* Sets the default generator options
+ */
+void fwps_generator_options_set_defaults(
+      fwps_generator_options_t *options )
+{
+	int value_class = 0;
+
+	if( options == NULL )
+	{
+		return;
+	}
+	options->seed                  = 1;
+	options->number_of_sets        = 1;
+	options->number_of_records     = 16;
+	options->minimum_string_length = 1;
+	options->maximum_string_length = 64;
+	options->minimum_vector_size   = 1;
+	options->maximum_vector_size   = 16;
+	options->named_percentage      = 0;
+
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		options->value_class_weights[ value_class ] = 1;
+	}
+}
+
+/* Parses a decimal 32-bit value from a string
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_parse_uint32(
+     const char *string,
+     size_t string_length,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "fwps_generator_parse_uint32";
+	uint64_t safe_value   = 0;
+	size_t string_index   = 0;
+
+	if( ( string_length == 0 )
+	 || ( string_length > 10 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += (uint64_t) ( string[ string_index ] - '0' );
+	}
+	if( safe_value > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*value_32bit = (uint32_t) safe_value;
+
+	return( 1 );
+}
+
+/* Sets the value class weights from a string
+ * The string contains comma separated value class names with an optional
+ * weight, e.g. "integer:4,string:2,vector"; classes not in the string get
+ * a weight of 0
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_options_set_value_class_weights(
+     fwps_generator_options_t *options,
+     const char *string,
+     libcerror_error_t **error )
+{
+	uint32_t value_class_weights[ FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES ];
+
+	const char *name        = NULL;
+	static char *function   = "fwps_generator_options_set_value_class_weights";
+	size_t name_length      = 0;
+	size_t string_index     = 0;
+	size_t string_length    = 0;
+	size_t weight_index     = 0;
+	uint64_t total_weight   = 0;
+	uint32_t weight         = 0;
+	int value_class         = 0;
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		value_class_weights[ value_class ] = 0;
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	while( string_index < string_length )
+	{
+		name        = &( string[ string_index ] );
+		name_length = 0;
+
+		while( ( string_index < string_length )
+		    && ( string[ string_index ] != ',' )
+		    && ( string[ string_index ] != ':' ) )
+		{
+			name_length++;
+			string_index++;
+		}
+		weight = 1;
+
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] == ':' ) )
+		{
+			string_index++;
+
+			weight_index = string_index;
+
+			while( ( string_index < string_length )
+			    && ( string[ string_index ] != ',' ) )
+			{
+				string_index++;
+			}
+			if( fwps_generator_parse_uint32(
+			     &( string[ weight_index ] ),
+			     string_index - weight_index,
+			     &weight,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse weight.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		for( value_class = 0;
+		     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+		     value_class++ )
+		{
+			if( ( narrow_string_length(
+			       fwps_generator_value_class_names[ value_class ] ) == name_length )
+			 && ( narrow_string_compare(
+			       fwps_generator_value_class_names[ value_class ],
+			       name,
+			       name_length ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( value_class >= FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value class in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_class_weights[ value_class ] = weight;
+
+		/* Skip the comma
+		 */
+		string_index++;
+	}
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		total_weight += value_class_weights[ value_class ];
+	}
+	if( ( total_weight == 0 )
+	 || ( total_weight > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid total weight value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		options->value_class_weights[ value_class ] = value_class_weights[ value_class ];
+	}
+	return( 1 );
+}
+
+/* Sets a range from a string
+ * The string contains either "minimum-maximum" or a single value
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_options_set_range(
+     uint32_t *minimum_value,
+     uint32_t *maximum_value,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "fwps_generator_options_set_range";
+	size_t separator_index = 0;
+	size_t string_length   = 0;
+	uint32_t safe_maximum  = 0;
+	uint32_t safe_minimum  = 0;
+
+	if( minimum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	while( ( separator_index < string_length )
+	    && ( string[ separator_index ] != '-' ) )
+	{
+		separator_index++;
+	}
+	if( fwps_generator_parse_uint32(
+	     string,
+	     separator_index,
+	     &safe_minimum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse minimum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( separator_index < string_length )
+	{
+		if( fwps_generator_parse_uint32(
+		     &( string[ separator_index + 1 ] ),
+		     string_length - ( separator_index + 1 ),
+		     &safe_maximum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse maximum value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		safe_maximum = safe_minimum;
+	}
+	if( safe_minimum > safe_maximum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*minimum_value = safe_minimum;
+	*maximum_value = safe_maximum;
+
+	return( 1 );
+}
+
+/* Retrieves the next value of the pseudo random number generator
+ * This is splitmix64 so the generated data only depends on the seed
+ * Returns the value
+ */
+uint64_t fwps_generator_random_get_value(
+          uint64_t *state )
+{
+	uint64_t value = 0;
+
+	*state += 0x9e3779b97f4a7c15ULL;
+
+	value = *state;
+	value = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	value = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+
+	return( value ^ ( value >> 31 ) );
+}
+
+/* Retrieves a pseudo random value in a range including the minimum and maximum
+ * Returns the value
+ */
+uint32_t fwps_generator_random_get_value_in_range(
+          uint64_t *state,
+          uint32_t minimum_value,
+          uint32_t maximum_value )
+{
+	uint64_t range = (uint64_t) maximum_value - (uint64_t) minimum_value + 1;
+
+	return( minimum_value + (uint32_t) ( fwps_generator_random_get_value( state ) % range ) );
+}
+
+/* Appends data to a buffer
+ * If data is NULL the appended data is set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_append(
+     fwps_generator_buffer_t *buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "fwps_generator_buffer_append";
+	size_t allocated_size = 0;
+
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->data_size + data_size ) > buffer->allocated_size )
+	{
+		allocated_size = buffer->allocated_size;
+
+		if( allocated_size == 0 )
+		{
+			allocated_size = 4096;
+		}
+		while( allocated_size < ( buffer->data_size + data_size ) )
+		{
+			if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+				break;
+			}
+			allocated_size *= 2;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            buffer->data,
+		                            sizeof( uint8_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data           = reallocation;
+		buffer->allocated_size = allocated_size;
+	}
+	if( data != NULL )
+	{
+		if( memory_copy(
+		     &( buffer->data[ buffer->data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_set(
+		     &( buffer->data[ buffer->data_size ] ),
+		     0,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	buffer->data_size += data_size;
+
+	return( 1 );
+}
+
+/* Appends a 32-bit little-endian value to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_append_uint32(
+     fwps_generator_buffer_t *buffer,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 ];
+
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 value_32bit );
+
+	return( fwps_generator_buffer_append(
+	         buffer,
+	         value_data,
+	         4,
+	         error ) );
+}
+
+/* Appends a 64-bit little-endian value to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_append_uint64(
+     fwps_generator_buffer_t *buffer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 value_64bit );
+
+	return( fwps_generator_buffer_append(
+	         buffer,
+	         value_data,
+	         8,
+	         error ) );
+}
+
+/* Patches the 32-bit little-endian size at the start of a structure
+ * The size is the number of bytes from the offset up to the end of the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_patch_size(
+     fwps_generator_buffer_t *buffer,
+     size_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "fwps_generator_buffer_patch_size";
+	size_t size           = 0;
+
+	size = buffer->data_size - offset;
+
+	if( size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer->data[ offset ] ),
+	 (uint32_t) size );
+
+	return( 1 );
+}
+
+/* Appends a random UTF-16 little-endian string including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_append_utf16_string(
+     fwps_generator_buffer_t *buffer,
+     uint64_t *state,
+     uint32_t number_of_characters,
+     libcerror_error_t **error )
+{
+	size_t data_offset       = 0;
+	uint64_t random_value    = 0;
+	uint32_t character_index = 0;
+	uint16_t character       = 0;
+
+	data_offset = buffer->data_size;
+
+	if( fwps_generator_buffer_append(
+	     buffer,
+	     NULL,
+	     ( (size_t) number_of_characters + 1 ) * 2,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		random_value = fwps_generator_random_get_value(
+		                state );
+
+		/* Mostly ASCII with some characters of the Basic Multilingual Plane
+		 * outside the surrogate range
+		 */
+		if( ( random_value & 0x07 ) == 0 )
+		{
+			character = (uint16_t) ( 0x00a0 + ( ( random_value >> 8 ) % ( 0xd800 - 0x00a0 ) ) );
+		}
+		else
+		{
+			character = (uint16_t) ( 'a' + ( ( random_value >> 8 ) % 26 ) );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( buffer->data[ data_offset + ( (size_t) character_index * 2 ) ] ),
+		 character );
+	}
+	return( 1 );
+}
+
+/* Appends a random value of a specific value class
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_append_value(
+     const fwps_generator_options_t *options,
+     uint64_t *state,
+     fwps_generator_buffer_t *buffer,
+     int value_class,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 16 ];
+
+	static char *function     = "fwps_generator_append_value";
+	size_t data_offset        = 0;
+	uint64_t random_value     = 0;
+	uint32_t number_of_values = 0;
+	uint32_t value_index      = 0;
+	uint32_t value_type       = 0;
+	int value_type_index      = 0;
+
+	union
+	{
+		double floating_point;
+		uint64_t integer;
+	} value_64bit;
+
+	random_value = fwps_generator_random_get_value(
+	                state );
+
+	switch( value_class )
+	{
+		case FWPS_GENERATOR_VALUE_CLASS_BOOLEAN:
+			value_data[ 0 ] = (uint8_t) ( random_value & 0x01 );
+
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     LIBFWPS_VALUE_TYPE_BOOLEAN,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append(
+			     buffer,
+			     value_data,
+			     1,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_INTEGER:
+			value_type_index = (int) ( random_value % 7 );
+			value_type       = fwps_generator_integer_value_types[ value_type_index ];
+
+			byte_stream_copy_from_uint64_little_endian(
+			 value_data,
+			 fwps_generator_random_get_value(
+			  state ) );
+
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     value_type,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append(
+			     buffer,
+			     value_data,
+			     ( value_type_index == 0 ) ? 1 : ( value_type_index <= 2 ) ? 2 : ( value_type_index <= 4 ) ? 4 : 8,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_FLOAT:
+			value_64bit.floating_point = (double) ( random_value >> 32 ) / 1024.0;
+
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     LIBFWPS_VALUE_TYPE_DOUBLE_64BIT,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append_uint64(
+			     buffer,
+			     value_64bit.integer,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_FILETIME:
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     LIBFWPS_VALUE_TYPE_FILETIME,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			/* A timestamp between 2015 and 2024
+			 */
+			if( fwps_generator_buffer_append_uint64(
+			     buffer,
+			     0x01d0000000000000ULL + ( random_value & 0x0000ffffffffffffULL ),
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_GUID:
+			byte_stream_copy_from_uint64_little_endian(
+			 value_data,
+			 random_value );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( value_data[ 8 ] ),
+			 fwps_generator_random_get_value(
+			  state ) );
+
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     LIBFWPS_VALUE_TYPE_GUID,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append(
+			     buffer,
+			     value_data,
+			     16,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_STRING:
+			number_of_values = fwps_generator_random_get_value_in_range(
+			                    state,
+			                    options->minimum_string_length,
+			                    options->maximum_string_length );
+
+			if( number_of_values == UINT32_MAX )
+			{
+				number_of_values -= 1;
+			}
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     LIBFWPS_VALUE_TYPE_STRING_UNICODE,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     number_of_values + 1,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append_utf16_string(
+			     buffer,
+			     state,
+			     number_of_values,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_ASCII:
+		case FWPS_GENERATOR_VALUE_CLASS_BINARY:
+			number_of_values = fwps_generator_random_get_value_in_range(
+			                    state,
+			                    options->minimum_string_length,
+			                    options->maximum_string_length );
+
+			if( value_class == FWPS_GENERATOR_VALUE_CLASS_ASCII )
+			{
+				if( number_of_values == UINT32_MAX )
+				{
+					number_of_values -= 1;
+				}
+				value_type = LIBFWPS_VALUE_TYPE_STRING_ASCII;
+			}
+			else
+			{
+				value_type = LIBFWPS_VALUE_TYPE_BINARY_DATA;
+			}
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     value_type,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     ( value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII ) ? number_of_values + 1 : number_of_values,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			data_offset = buffer->data_size;
+
+			if( fwps_generator_buffer_append(
+			     buffer,
+			     NULL,
+			     ( value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII ) ? (size_t) number_of_values + 1 : (size_t) number_of_values,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			for( value_index = 0;
+			     value_index < number_of_values;
+			     value_index++ )
+			{
+				random_value = fwps_generator_random_get_value(
+				                state );
+
+				if( value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+				{
+					buffer->data[ data_offset + value_index ] = (uint8_t) ( 0x20 + ( random_value % 0x5f ) );
+				}
+				else
+				{
+					buffer->data[ data_offset + value_index ] = (uint8_t) random_value;
+				}
+			}
+			break;
+
+		case FWPS_GENERATOR_VALUE_CLASS_VECTOR:
+			number_of_values = fwps_generator_random_get_value_in_range(
+			                    state,
+			                    options->minimum_vector_size,
+			                    options->maximum_vector_size );
+
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     0x00001000UL | LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( fwps_generator_buffer_append_uint32(
+			     buffer,
+			     number_of_values,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( number_of_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of values value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset = buffer->data_size;
+
+			if( fwps_generator_buffer_append(
+			     buffer,
+			     NULL,
+			     (size_t) number_of_values * 4,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			for( value_index = 0;
+			     value_index < number_of_values;
+			     value_index++ )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( buffer->data[ data_offset + ( (size_t) value_index * 4 ) ] ),
+				 (uint32_t) fwps_generator_random_get_value(
+				             state ) );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value class: %d.",
+			 function,
+			 value_class );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a record
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_append_record(
+     const fwps_generator_options_t *options,
+     uint64_t *state,
+     fwps_generator_buffer_t *buffer,
+     uint32_t record_index,
+     int is_named,
+     libcerror_error_t **error )
+{
+	uint8_t name_data[ 40 ];
+
+	static char *function   = "fwps_generator_append_record";
+	size_t name_data_size   = 0;
+	size_t record_offset    = 0;
+	uint64_t random_value   = 0;
+	uint64_t total_weight   = 0;
+	uint32_t digit_divider  = 0;
+	uint32_t value_32bit    = 0;
+	int value_class         = 0;
+
+	record_offset = buffer->data_size;
+
+	if( fwps_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( is_named != 0 )
+	{
+		/* The name is a UTF-16 little-endian string "name<index>"
+		 * including the end-of-string character
+		 */
+		byte_stream_copy_from_uint16_little_endian(
+		 &( name_data[ 0 ] ),
+		 'n' );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( name_data[ 2 ] ),
+		 'a' );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( name_data[ 4 ] ),
+		 'm' );
+		byte_stream_copy_from_uint16_little_endian(
+		 &( name_data[ 6 ] ),
+		 'e' );
+
+		name_data_size = 8;
+
+		for( digit_divider = 1000000000UL;
+		     digit_divider > 1;
+		     digit_divider /= 10 )
+		{
+			if( record_index >= digit_divider )
+			{
+				break;
+			}
+		}
+		while( digit_divider > 0 )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( name_data[ name_data_size ] ),
+			 '0' + ( ( record_index / digit_divider ) % 10 ) );
+
+			name_data_size += 2;
+			digit_divider  /= 10;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( name_data[ name_data_size ] ),
+		 0 );
+
+		name_data_size += 2;
+
+		value_32bit = (uint32_t) name_data_size;
+	}
+	else
+	{
+		/* Entry types 0 and 1 have a special meaning
+		 */
+		value_32bit = record_index + 2;
+	}
+	if( fwps_generator_buffer_append_uint32(
+	     buffer,
+	     value_32bit,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fwps_generator_buffer_append(
+	     buffer,
+	     NULL,
+	     1,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( is_named != 0 )
+	{
+		if( fwps_generator_buffer_append(
+		     buffer,
+		     name_data,
+		     name_data_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		total_weight += options->value_class_weights[ value_class ];
+	}
+	if( total_weight == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid options - total weight value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	random_value = fwps_generator_random_get_value(
+	                state ) % total_weight;
+
+	for( value_class = 0;
+	     value_class < FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES;
+	     value_class++ )
+	{
+		if( random_value < options->value_class_weights[ value_class ] )
+		{
+			break;
+		}
+		random_value -= options->value_class_weights[ value_class ];
+	}
+	if( fwps_generator_append_value(
+	     options,
+	     state,
+	     buffer,
+	     value_class,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fwps_generator_buffer_patch_size(
+	     buffer,
+	     record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record: %" PRIu32 " size.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a set
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_append_set(
+     const fwps_generator_options_t *options,
+     uint64_t *state,
+     fwps_generator_buffer_t *buffer,
+     uint32_t set_index,
+     libcerror_error_t **error )
+{
+	uint8_t set_identifier[ 16 ];
+
+	static char *function = "fwps_generator_append_set";
+	size_t set_offset     = 0;
+	uint32_t record_index = 0;
+	int is_named          = 0;
+
+	if( fwps_generator_random_get_value_in_range(
+	     state,
+	     0,
+	     99 ) < (uint32_t) options->named_percentage )
+	{
+		is_named = 1;
+	}
+	if( is_named != 0 )
+	{
+		if( memory_copy(
+		     set_identifier,
+		     fwps_generator_named_set_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy set identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( set_identifier[ 0 ] ),
+		 fwps_generator_random_get_value(
+		  state ) );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( set_identifier[ 8 ] ),
+		 fwps_generator_random_get_value(
+		  state ) );
+
+		/* Make the identifier a version 4 GUID that differs from the named set identifier
+		 */
+		set_identifier[ 7 ] = ( set_identifier[ 7 ] & 0x0f ) | 0x40;
+		set_identifier[ 8 ] = ( set_identifier[ 8 ] & 0x3f ) | 0x80;
+	}
+	set_offset = buffer->data_size;
+
+	if( fwps_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fwps_generator_buffer_append(
+	     buffer,
+	     (uint8_t *) "1SPS",
+	     4,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fwps_generator_buffer_append(
+	     buffer,
+	     set_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < options->number_of_records;
+	     record_index++ )
+	{
+		if( fwps_generator_append_record(
+		     options,
+		     state,
+		     buffer,
+		     record_index,
+		     is_named,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %" PRIu32 ".",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	/* The records are terminated by an empty record
+	 */
+	if( fwps_generator_buffer_append_uint32(
+	     buffer,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( fwps_generator_buffer_patch_size(
+	     buffer,
+	     set_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set set: %" PRIu32 " size.",
+		 function,
+		 set_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates a store
+ * The store is generated one set at a time and passed to the write function,
+ * hence the memory used is bounded by the size of the largest set.
+ * The same options always generate the same data
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_generate(
+     const fwps_generator_options_t *options,
+     int (*write_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *write_data,
+            libcerror_error_t **error ),
+     void *write_data,
+     libcerror_error_t **error )
+{
+	fwps_generator_buffer_t buffer = { NULL, 0, 0 };
+	uint8_t terminator[ 4 ]        = { 0, 0, 0, 0 };
+	static char *function          = "fwps_generator_generate";
+	uint64_t state                 = 0;
+	uint32_t set_index             = 0;
+
+	if( options == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid options.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( options->minimum_string_length > options->maximum_string_length )
+	 || ( options->minimum_vector_size > options->maximum_vector_size )
+	 || ( options->named_percentage > 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid options value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write function.",
+		 function );
+
+		return( -1 );
+	}
+	state = options->seed;
+
+	for( set_index = 0;
+	     set_index < options->number_of_sets;
+	     set_index++ )
+	{
+		buffer.data_size = 0;
+
+		if( fwps_generator_append_set(
+		     options,
+		     &state,
+		     &buffer,
+		     set_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append set: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		if( write_function(
+		     buffer.data,
+		     buffer.data_size,
+		     write_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write set: %" PRIu32 ".",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+	}
+	/* The sets are terminated by an empty set
+	 */
+	if( write_function(
+	     terminator,
+	     4,
+	     write_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write terminator.",
+		 function );
+
+		goto on_error;
+	}
+	if( buffer.data != NULL )
+	{
+		memory_free(
+		 buffer.data );
+	}
+	return( 1 );
+
+on_error:
+	if( buffer.data != NULL )
+	{
+		memory_free(
+		 buffer.data );
+	}
+	return( -1 );
+}
+
+/* Appends generated data to a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_buffer_write(
+     const uint8_t *data,
+     size_t data_size,
+     void *write_data,
+     libcerror_error_t **error )
+{
+	return( fwps_generator_buffer_append(
+	         (fwps_generator_buffer_t *) write_data,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+/* Generates a store in memory
+ * The data must be freed with memory_free
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_generator_generate_to_buffer(
+     const fwps_generator_options_t *options,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	fwps_generator_buffer_t buffer = { NULL, 0, 0 };
+	static char *function          = "fwps_generator_generate_to_buffer";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( fwps_generator_generate(
+	     options,
+	     &fwps_generator_buffer_write,
+	     (void *) &buffer,
+	     error ) != 1 )
+	{
+		if( buffer.data != NULL )
+		{
+			memory_free(
+			 buffer.data );
+		}
+		return( -1 );
+	}
+	*data      = buffer.data;
+	*data_size = buffer.data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Synthetic property store generator functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWPS_GENERATOR_H )
+#define _FWPS_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fwps_benchmark_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum FWPS_GENERATOR_VALUE_CLASSES
+{
+	FWPS_GENERATOR_VALUE_CLASS_BOOLEAN	= 0,
+	FWPS_GENERATOR_VALUE_CLASS_INTEGER	= 1,
+	FWPS_GENERATOR_VALUE_CLASS_FLOAT	= 2,
+	FWPS_GENERATOR_VALUE_CLASS_FILETIME	= 3,
+	FWPS_GENERATOR_VALUE_CLASS_GUID		= 4,
+	FWPS_GENERATOR_VALUE_CLASS_STRING	= 5,
+	FWPS_GENERATOR_VALUE_CLASS_ASCII	= 6,
+	FWPS_GENERATOR_VALUE_CLASS_BINARY	= 7,
+	FWPS_GENERATOR_VALUE_CLASS_VECTOR	= 8,
+
+	/* The number of value classes
+	 */
+	FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES	= 9
+};
+
+typedef struct fwps_generator_options fwps_generator_options_t;
+
+struct fwps_generator_options
+{
+	/* The seed of the pseudo random number generator
+	 */
+	uint64_t seed;
+
+	/* The number of sets
+	 */
+	uint32_t number_of_sets;
+
+	/* The number of records per set
+	 */
+	uint32_t number_of_records;
+
+	/* The relative weight of every value class
+	 */
+	uint32_t value_class_weights[ FWPS_GENERATOR_NUMBER_OF_VALUE_CLASSES ];
+
+	/* The minimum and maximum number of characters of a string or bytes of binary data
+	 */
+	uint32_t minimum_string_length;
+	uint32_t maximum_string_length;
+
+	/* The minimum and maximum number of values of a vector
+	 */
+	uint32_t minimum_vector_size;
+	uint32_t maximum_vector_size;
+
+	/* The percentage of sets that contain named instead of numeric records
+	 */
+	uint8_t named_percentage;
+};
+
+void fwps_generator_options_set_defaults(
+      fwps_generator_options_t *options );
+
+int fwps_generator_options_set_value_class_weights(
+     fwps_generator_options_t *options,
+     const char *string,
+     libcerror_error_t **error );
+
+int fwps_generator_options_set_range(
+     uint32_t *minimum_value,
+     uint32_t *maximum_value,
+     const char *string,
+     libcerror_error_t **error );
+
+int fwps_generator_generate(
+     const fwps_generator_options_t *options,
+     int (*write_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *write_data,
+            libcerror_error_t **error ),
+     void *write_data,
+     libcerror_error_t **error );
+
+int fwps_generator_generate_to_buffer(
+     const fwps_generator_options_t *options,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWPS_GENERATOR_H ) */
+
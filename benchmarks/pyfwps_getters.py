@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+#
+# Python-bindings getter micro-benchmark script
+#
+# Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import sys
+import threading
+import timeit
+
+import pyfwps
+
+
+_TEST_DATA = bytes(bytearray([
+    0x89, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+    0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+    0x6d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x2e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x2d,
+    0x00, 0x35, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2d, 0x00, 0x34,
+    0x00, 0x30, 0x00, 0x36, 0x00, 0x30, 0x00, 0x32, 0x00, 0x38, 0x00, 0x39,
+    0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x39,
+    0x00, 0x39, 0x00, 0x37, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x32,
+    0x00, 0x32, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x32, 0x00, 0x34,
+    0x00, 0x38, 0x00, 0x30, 0x00, 0x31, 0x00, 0x36, 0x00, 0x38, 0x00, 0x31,
+    0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00]))
+
+
+def BenchmarkGetter(getter, number_of_calls, number_of_threads):
+  """Times a getter, optionally called from multiple threads concurrently.
+
+  Args:
+    getter (callable): getter to benchmark.
+    number_of_calls (int): number of calls per thread.
+    number_of_threads (int): number of threads.
+
+  Returns:
+    float: average time per call in nanoseconds.
+  """
+  def _Run():
+    for _ in range(number_of_calls):
+      getter()
+
+  if number_of_threads <= 1:
+    elapsed_time = timeit.timeit(_Run, number=1)
+  else:
+    threads = [
+        threading.Thread(target=_Run) for _ in range(number_of_threads)]
+
+    start_time = timeit.default_timer()
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+    elapsed_time = timeit.default_timer() - start_time
+
+  return (elapsed_time * 1e9) / (number_of_calls * number_of_threads)
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      'Measures the per-call overhead of the pyfwps getters.'))
+
+  argument_parser.add_argument(
+      '-n', '--calls', dest='number_of_calls', type=int, default=1000000,
+      help='number of calls per getter and thread.')
+
+  argument_parser.add_argument(
+      '-t', '--threads', dest='number_of_threads', type=int, default=1,
+      help='number of threads calling the getters concurrently.')
+
+  options = argument_parser.parse_args()
+
+  fwps_store = pyfwps.store()
+  fwps_store.copy_from_byte_stream(_TEST_DATA)
+
+  fwps_set = fwps_store.get_set(0)
+  fwps_record = fwps_set.get_record(0)
+
+  getters = [
+      ('store.get_number_of_sets', fwps_store.get_number_of_sets),
+      ('set.get_identifier', fwps_set.get_identifier),
+      ('set.get_number_of_records', fwps_set.get_number_of_records),
+      ('record.get_entry_type', fwps_record.get_entry_type),
+      ('record.get_value_type', fwps_record.get_value_type),
+      ('record.get_data_as_string', fwps_record.get_data_as_string)]
+
+  for name, getter in getters:
+    nanoseconds_per_call = BenchmarkGetter(
+        getter, options.number_of_calls, options.number_of_threads)
+    print('{0:s}\t{1:.1f} ns/call'.format(name, nanoseconds_per_call))
+
+  return True
+
+
+if __name__ == '__main__':
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
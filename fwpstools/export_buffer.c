@@ -0,0 +1,1259 @@
+/*
+ * Export buffer
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "export_buffer.h"
+#include "fwpstools_libcerror.h"
+
+/* The lower case hexadecimal digits
+ */
+static const uint8_t export_buffer_hexadecimal_digits[ 16 ] = {
+	'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+/* Creates an export buffer
+ * Make sure the value export_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_initialize(
+     export_buffer_t **export_buffer,
+     size_t allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_initialize";
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocated_size == 0 )
+	 || ( allocated_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_buffer = memory_allocate_structure(
+	                  export_buffer_t );
+
+	if( *export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_buffer,
+	     0,
+	     sizeof( export_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export buffer.",
+		 function );
+
+		memory_free(
+		 *export_buffer );
+
+		*export_buffer = NULL;
+
+		return( -1 );
+	}
+	( *export_buffer )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * allocated_size );
+
+	if( ( *export_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_buffer )->allocated_size = allocated_size;
+
+	return( 1 );
+
+on_error:
+	if( *export_buffer != NULL )
+	{
+		memory_free(
+		 *export_buffer );
+
+		*export_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_free(
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_free";
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_buffer != NULL )
+	{
+		if( ( *export_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *export_buffer )->data );
+		}
+		memory_free(
+		 *export_buffer );
+
+		*export_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties an export buffer
+ * The allocated data is retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_empty(
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_empty";
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	export_buffer->data_size = 0;
+
+	return( 1 );
+}
+
+/* Makes sure an export buffer can hold an additional number of bytes
+ * The allocated size is at least doubled to amortize reallocations
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_reserve(
+     export_buffer_t *export_buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation  = NULL;
+	static char *function  = "export_buffer_reserve";
+	size_t allocated_size  = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - export_buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_buffer->data_size + size ) <= export_buffer->allocated_size )
+	{
+		return( 1 );
+	}
+	allocated_size = export_buffer->allocated_size;
+
+	while( allocated_size < ( export_buffer->data_size + size ) )
+	{
+		if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			allocated_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+			break;
+		}
+		allocated_size *= 2;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            export_buffer->data,
+	                            sizeof( uint8_t ) * allocated_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	export_buffer->data           = reallocation;
+	export_buffer->allocated_size = allocated_size;
+
+	return( 1 );
+}
+
+/* Appends data to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_data(
+     export_buffer_t *export_buffer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_append_data";
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( export_buffer->data[ export_buffer->data_size ] ),
+	     data,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	export_buffer->data_size += size;
+
+	return( 1 );
+}
+
+/* Appends a character to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_character(
+     export_buffer_t *export_buffer,
+     uint8_t character,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_append_character";
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	export_buffer->data[ export_buffer->data_size++ ] = character;
+
+	return( 1 );
+}
+
+/* Appends the decimal representation of an unsigned integer to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_unsigned_integer(
+     export_buffer_t *export_buffer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint8_t digits[ 20 ];
+
+	static char *function = "export_buffer_append_unsigned_integer";
+	size_t digit_index    = 20;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* Format the digits from right to left
+	 */
+	do
+	{
+		digit_index--;
+
+		digits[ digit_index ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( export_buffer_append_data(
+	     export_buffer,
+	     &( digits[ digit_index ] ),
+	     20 - digit_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append digits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the decimal representation of a signed integer to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_signed_integer(
+     export_buffer_t *export_buffer,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_append_signed_integer";
+	uint64_t magnitude    = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( value < 0 )
+	{
+		if( export_buffer_append_character(
+		     export_buffer,
+		     (uint8_t) '-',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sign.",
+			 function );
+
+			return( -1 );
+		}
+		/* Negate as unsigned to support the minimum 64-bit value
+		 */
+		magnitude = ~( (uint64_t) value ) + 1;
+	}
+	else
+	{
+		magnitude = (uint64_t) value;
+	}
+	if( export_buffer_append_unsigned_integer(
+	     export_buffer,
+	     magnitude,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append magnitude.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the decimal representation of a floating point to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_floating_point(
+     export_buffer_t *export_buffer,
+     double value,
+     libcerror_error_t **error )
+{
+	char string[ 32 ];
+
+	static char *function = "export_buffer_append_floating_point";
+	int print_count       = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* Floating point values are relatively rare hence formatting them
+	 * with the C library is acceptable
+	 */
+	print_count = narrow_string_snprintf(
+	               string,
+	               32,
+	               "%.17g",
+	               value );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format floating point.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_append_data(
+	     export_buffer,
+	     (uint8_t *) string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append floating point.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the lower case hexadecimal representation of data to an export buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_hexadecimal(
+     export_buffer_t *export_buffer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *hexadecimal_data = NULL;
+	static char *function     = "export_buffer_append_hexadecimal";
+	size_t data_offset        = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     size * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	hexadecimal_data = &( export_buffer->data[ export_buffer->data_size ] );
+
+	for( data_offset = 0;
+	     data_offset < size;
+	     data_offset++ )
+	{
+		*( hexadecimal_data++ ) = export_buffer_hexadecimal_digits[ data[ data_offset ] >> 4 ];
+		*( hexadecimal_data++ ) = export_buffer_hexadecimal_digits[ data[ data_offset ] & 0x0f ];
+	}
+	export_buffer->data_size += size * 2;
+
+	return( 1 );
+}
+
+/* Appends the string representation of a GUID to an export buffer
+ * The GUID is stored in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_guid(
+     export_buffer_t *export_buffer,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	/* The order in which the GUID bytes are formatted, a value of 0xff represents a hyphen
+	 */
+	static const uint8_t byte_order[ 20 ] = {
+		3, 2, 1, 0, 0xff, 5, 4, 0xff, 7, 6, 0xff, 8, 9, 0xff, 10, 11, 12, 13, 14, 15 };
+
+	uint8_t *string       = NULL;
+	static char *function = "export_buffer_append_guid";
+	size_t order_index    = 0;
+	uint8_t byte_value    = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid GUID data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     36,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	string = &( export_buffer->data[ export_buffer->data_size ] );
+
+	for( order_index = 0;
+	     order_index < 20;
+	     order_index++ )
+	{
+		if( byte_order[ order_index ] == 0xff )
+		{
+			*( string++ ) = (uint8_t) '-';
+		}
+		else
+		{
+			byte_value = guid_data[ byte_order[ order_index ] ];
+
+			*( string++ ) = export_buffer_hexadecimal_digits[ byte_value >> 4 ];
+			*( string++ ) = export_buffer_hexadecimal_digits[ byte_value & 0x0f ];
+		}
+	}
+	export_buffer->data_size += 36;
+
+	return( 1 );
+}
+
+/* Appends the ISO 8601 representation of a FILETIME to an export buffer
+ * The FILETIME is the number of 100th nano seconds since January 1, 1601 (UTC)
+ * and is formatted as: YYYY-MM-DDThh:mm:ss.fffffffZ
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_filetime(
+     export_buffer_t *export_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	uint8_t *string          = NULL;
+	static char *function    = "export_buffer_append_filetime";
+	uint64_t day_of_era      = 0;
+	uint64_t day_of_year     = 0;
+	uint64_t era             = 0;
+	uint64_t number_of_days  = 0;
+	uint64_t year            = 0;
+	uint64_t year_of_era     = 0;
+	uint32_t fraction        = 0;
+	uint8_t day_of_month     = 0;
+	uint8_t digit_index      = 0;
+	uint8_t hours            = 0;
+	uint8_t minutes          = 0;
+	uint8_t month            = 0;
+	uint8_t month_from_march = 0;
+	uint8_t seconds          = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	fraction  = (uint32_t) ( filetime % 10000000 );
+	filetime /= 10000000;
+
+	seconds   = (uint8_t) ( filetime % 60 );
+	filetime /= 60;
+
+	minutes   = (uint8_t) ( filetime % 60 );
+	filetime /= 60;
+
+	hours     = (uint8_t) ( filetime % 24 );
+	filetime /= 24;
+
+	/* Determine the date from the number of days relative to March 1, 0000
+	 * in eras of 400 years, where January 1, 1601 is 584694 days after March 1, 0000
+	 */
+	number_of_days = filetime + 584694;
+
+	era         = number_of_days / 146097;
+	day_of_era  = number_of_days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	month_from_march = (uint8_t) ( ( ( 5 * day_of_year ) + 2 ) / 153 );
+	day_of_month     = (uint8_t) ( day_of_year - ( ( ( 153 * month_from_march ) + 2 ) / 5 ) + 1 );
+
+	if( month_from_march < 10 )
+	{
+		month = month_from_march + 3;
+	}
+	else
+	{
+		month = month_from_march - 9;
+	}
+	year = year_of_era + ( era * 400 );
+
+	if( month <= 2 )
+	{
+		year += 1;
+	}
+	/* The largest FILETIME is in year 60056 hence the year can have 5 digits
+	 */
+	if( year > 9999 )
+	{
+		if( export_buffer_append_unsigned_integer(
+		     export_buffer,
+		     year / 10000,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append year.",
+			 function );
+
+			return( -1 );
+		}
+		year %= 10000;
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     28,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	string = &( export_buffer->data[ export_buffer->data_size ] );
+
+	string[ 0 ]  = (uint8_t) '0' + (uint8_t) ( year / 1000 );
+	string[ 1 ]  = (uint8_t) '0' + (uint8_t) ( ( year / 100 ) % 10 );
+	string[ 2 ]  = (uint8_t) '0' + (uint8_t) ( ( year / 10 ) % 10 );
+	string[ 3 ]  = (uint8_t) '0' + (uint8_t) ( year % 10 );
+	string[ 4 ]  = (uint8_t) '-';
+	string[ 5 ]  = (uint8_t) '0' + ( month / 10 );
+	string[ 6 ]  = (uint8_t) '0' + ( month % 10 );
+	string[ 7 ]  = (uint8_t) '-';
+	string[ 8 ]  = (uint8_t) '0' + ( day_of_month / 10 );
+	string[ 9 ]  = (uint8_t) '0' + ( day_of_month % 10 );
+	string[ 10 ] = (uint8_t) 'T';
+	string[ 11 ] = (uint8_t) '0' + ( hours / 10 );
+	string[ 12 ] = (uint8_t) '0' + ( hours % 10 );
+	string[ 13 ] = (uint8_t) ':';
+	string[ 14 ] = (uint8_t) '0' + ( minutes / 10 );
+	string[ 15 ] = (uint8_t) '0' + ( minutes % 10 );
+	string[ 16 ] = (uint8_t) ':';
+	string[ 17 ] = (uint8_t) '0' + ( seconds / 10 );
+	string[ 18 ] = (uint8_t) '0' + ( seconds % 10 );
+	string[ 19 ] = (uint8_t) '.';
+
+	for( digit_index = 26;
+	     digit_index > 19;
+	     digit_index-- )
+	{
+		string[ digit_index ] = (uint8_t) '0' + (uint8_t) ( fraction % 10 );
+
+		fraction /= 10;
+	}
+	string[ 27 ] = (uint8_t) 'Z';
+
+	export_buffer->data_size += 28;
+
+	return( 1 );
+}
+
+/* Appends a quoted JSON string to an export buffer
+ * The string is expected to be UTF-8 encoded
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_json_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *escaped_string = NULL;
+	static char *function   = "export_buffer_append_json_string";
+	size_t string_index     = 0;
+	uint8_t character       = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) / 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reserve for the worst case where every character is escaped as \u00XX
+	 */
+	if( export_buffer_reserve(
+	     export_buffer,
+	     ( string_length * 6 ) + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	escaped_string = &( export_buffer->data[ export_buffer->data_size ] );
+
+	*( escaped_string++ ) = (uint8_t) '"';
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( character == (uint8_t) '"' )
+		 || ( character == (uint8_t) '\\' ) )
+		{
+			*( escaped_string++ ) = (uint8_t) '\\';
+			*( escaped_string++ ) = character;
+		}
+		else if( character == (uint8_t) '\n' )
+		{
+			*( escaped_string++ ) = (uint8_t) '\\';
+			*( escaped_string++ ) = (uint8_t) 'n';
+		}
+		else if( character == (uint8_t) '\r' )
+		{
+			*( escaped_string++ ) = (uint8_t) '\\';
+			*( escaped_string++ ) = (uint8_t) 'r';
+		}
+		else if( character == (uint8_t) '\t' )
+		{
+			*( escaped_string++ ) = (uint8_t) '\\';
+			*( escaped_string++ ) = (uint8_t) 't';
+		}
+		else if( character < 0x20 )
+		{
+			*( escaped_string++ ) = (uint8_t) '\\';
+			*( escaped_string++ ) = (uint8_t) 'u';
+			*( escaped_string++ ) = (uint8_t) '0';
+			*( escaped_string++ ) = (uint8_t) '0';
+			*( escaped_string++ ) = export_buffer_hexadecimal_digits[ character >> 4 ];
+			*( escaped_string++ ) = export_buffer_hexadecimal_digits[ character & 0x0f ];
+		}
+		else
+		{
+			*( escaped_string++ ) = character;
+		}
+	}
+	*( escaped_string++ ) = (uint8_t) '"';
+
+	export_buffer->data_size = (size_t) ( escaped_string - export_buffer->data );
+
+	return( 1 );
+}
+
+/* Appends a CSV field string to an export buffer
+ * The string is quoted if it contains a separator, quote or end of line character
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_csv_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *escaped_string = NULL;
+	static char *function   = "export_buffer_append_csv_string";
+	size_t string_index     = 0;
+	uint8_t character       = 0;
+	uint8_t requires_quotes = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( character == (uint8_t) ',' )
+		 || ( character == (uint8_t) '"' )
+		 || ( character == (uint8_t) '\n' )
+		 || ( character == (uint8_t) '\r' ) )
+		{
+			requires_quotes = 1;
+
+			break;
+		}
+	}
+	if( requires_quotes == 0 )
+	{
+		return( export_buffer_append_data(
+		         export_buffer,
+		         string,
+		         string_length,
+		         error ) );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     ( string_length * 2 ) + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	escaped_string = &( export_buffer->data[ export_buffer->data_size ] );
+
+	*( escaped_string++ ) = (uint8_t) '"';
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( character == (uint8_t) '"' )
+		{
+			*( escaped_string++ ) = (uint8_t) '"';
+		}
+		*( escaped_string++ ) = character;
+	}
+	*( escaped_string++ ) = (uint8_t) '"';
+
+	export_buffer->data_size = (size_t) ( escaped_string - export_buffer->data );
+
+	return( 1 );
+}
+
+/* Appends a TSV field string to an export buffer
+ * Tab, end of line and backslash characters are escaped with a backslash
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_append_tsv_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	uint8_t *escaped_string = NULL;
+	static char *function   = "export_buffer_append_tsv_string";
+	size_t string_index     = 0;
+	uint8_t character       = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_reserve(
+	     export_buffer,
+	     string_length * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	escaped_string = &( export_buffer->data[ export_buffer->data_size ] );
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		switch( character )
+		{
+			case (uint8_t) '\t':
+				*( escaped_string++ ) = (uint8_t) '\\';
+				*( escaped_string++ ) = (uint8_t) 't';
+				break;
+
+			case (uint8_t) '\n':
+				*( escaped_string++ ) = (uint8_t) '\\';
+				*( escaped_string++ ) = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				*( escaped_string++ ) = (uint8_t) '\\';
+				*( escaped_string++ ) = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\\':
+				*( escaped_string++ ) = (uint8_t) '\\';
+				*( escaped_string++ ) = (uint8_t) '\\';
+				break;
+
+			default:
+				*( escaped_string++ ) = character;
+				break;
+		}
+	}
+	export_buffer->data_size = (size_t) ( escaped_string - export_buffer->data );
+
+	return( 1 );
+}
+
+/* Writes the data of an export buffer to a stream and empties the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_buffer_write_to_stream(
+     export_buffer_t *export_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_buffer_write_to_stream";
+	size_t write_count    = 0;
+
+	if( export_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer->data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               stream,
+		               export_buffer->data,
+		               export_buffer->data_size );
+
+		if( write_count != export_buffer->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_buffer->data_size = 0;
+
+	return( 1 );
+}
+
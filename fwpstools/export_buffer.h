@@ -0,0 +1,141 @@
+/*
+ * Export buffer
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_BUFFER_H )
+#define _EXPORT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fwpstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_buffer export_buffer_t;
+
+struct export_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated size
+	 */
+	size_t allocated_size;
+};
+
+int export_buffer_initialize(
+     export_buffer_t **export_buffer,
+     size_t allocated_size,
+     libcerror_error_t **error );
+
+int export_buffer_free(
+     export_buffer_t **export_buffer,
+     libcerror_error_t **error );
+
+int export_buffer_empty(
+     export_buffer_t *export_buffer,
+     libcerror_error_t **error );
+
+int export_buffer_reserve(
+     export_buffer_t *export_buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int export_buffer_append_data(
+     export_buffer_t *export_buffer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error );
+
+int export_buffer_append_character(
+     export_buffer_t *export_buffer,
+     uint8_t character,
+     libcerror_error_t **error );
+
+int export_buffer_append_unsigned_integer(
+     export_buffer_t *export_buffer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int export_buffer_append_signed_integer(
+     export_buffer_t *export_buffer,
+     int64_t value,
+     libcerror_error_t **error );
+
+int export_buffer_append_floating_point(
+     export_buffer_t *export_buffer,
+     double value,
+     libcerror_error_t **error );
+
+int export_buffer_append_hexadecimal(
+     export_buffer_t *export_buffer,
+     const uint8_t *data,
+     size_t size,
+     libcerror_error_t **error );
+
+int export_buffer_append_guid(
+     export_buffer_t *export_buffer,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int export_buffer_append_filetime(
+     export_buffer_t *export_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int export_buffer_append_json_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int export_buffer_append_csv_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int export_buffer_append_tsv_string(
+     export_buffer_t *export_buffer,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int export_buffer_write_to_stream(
+     export_buffer_t *export_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_BUFFER_H ) */
+
@@ -0,0 +1,2850 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "export_buffer.h"
+#include "export_handle.h"
+#include "fwpstools_file.h"
+#include "fwpstools_libcdata.h"
+#include "fwpstools_libcerror.h"
+#include "fwpstools_libclocale.h"
+#include "fwpstools_libcthreads.h"
+#include "fwpstools_libfwps.h"
+#include "fwpstools_libuna.h"
+#include "fwpstools_unused.h"
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define EXPORT_HANDLE_HAVE_DIRECTORY_SUPPORT
+#endif
+
+/* The initial size of the output buffer of a job
+ */
+#define EXPORT_JOB_OUTPUT_BUFFER_SIZE	( 64 * 1024 )
+
+/* The number of jobs per thread that are run before the output is written
+ */
+#define EXPORT_HANDLE_JOBS_PER_THREAD	4
+
+/* The maximum number of threads
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* Creates an export job
+ * Make sure the value export_job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_initialize(
+     export_job_t **export_job,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_initialize";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_job = memory_allocate_structure(
+	               export_job_t );
+
+	if( *export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_job,
+	     0,
+	     sizeof( export_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export job.",
+		 function );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+
+		return( -1 );
+	}
+	( *export_job )->path = system_string_allocate(
+	                         path_length + 1 );
+
+	if( ( *export_job )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *export_job )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_job )->path[ path_length ] = 0;
+
+	/* The source path is written to the output as UTF-8
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) ( *export_job )->path,
+	     path_length + 1,
+	     &( ( *export_job )->utf8_path_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 path size.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	( *export_job )->utf8_path_size = path_length + 1;
+#endif
+	( *export_job )->utf8_path = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * ( *export_job )->utf8_path_size );
+
+	if( ( *export_job )->utf8_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_copy_from_utf16(
+	     ( *export_job )->utf8_path,
+	     ( *export_job )->utf8_path_size,
+	     (libuna_utf16_character_t *) ( *export_job )->path,
+	     path_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     ( *export_job )->utf8_path,
+	     ( *export_job )->path,
+	     ( *export_job )->utf8_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->utf8_path != NULL )
+		{
+			memory_free(
+			 ( *export_job )->utf8_path );
+		}
+		if( ( *export_job )->path != NULL )
+		{
+			memory_free(
+			 ( *export_job )->path );
+		}
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_free";
+	int result            = 1;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->output_buffer != NULL )
+		{
+			if( export_buffer_free(
+			     &( ( *export_job )->output_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_job )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *export_job )->error ) );
+		}
+		if( ( *export_job )->string_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_job )->string_buffer );
+		}
+		if( ( *export_job )->data_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_job )->data_buffer );
+		}
+		memory_free(
+		 ( *export_job )->utf8_path );
+
+		memory_free(
+		 ( *export_job )->path );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( result );
+}
+
+/* Resizes a buffer of an export job if it is smaller than the size
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_resize_buffer(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "export_job_resize_buffer";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size <= *buffer_size )
+	{
+		return( 1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            *buffer,
+	                            sizeof( uint8_t ) * size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = reallocation;
+	*buffer_size = size;
+
+	return( 1 );
+}
+
+/* Appends a string field to the output buffer of an export job
+ * The string is escaped according to the output format
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_append_string(
+     export_job_t *export_job,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_append_string";
+	int result            = 0;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	switch( export_job->output_format )
+	{
+		case EXPORT_FORMAT_CSV:
+			result = export_buffer_append_csv_string(
+			          export_job->output_buffer,
+			          string,
+			          string_length,
+			          error );
+			break;
+
+		case EXPORT_FORMAT_TSV:
+			result = export_buffer_append_tsv_string(
+			          export_job->output_buffer,
+			          string,
+			          string_length,
+			          error );
+			break;
+
+		default:
+			result = export_buffer_append_json_string(
+			          export_job->output_buffer,
+			          string,
+			          string_length,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends text that does not require escaping to the output buffer of an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_append_text(
+     export_job_t *export_job,
+     const char *text,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_append_text";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_buffer_append_data(
+	     export_job->output_buffer,
+	     (uint8_t *) text,
+	     narrow_string_length(
+	      text ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append text.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a field separator, or for NDJSON a key, to the output buffer of an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_append_field_separator(
+     export_job_t *export_job,
+     const char *json_key,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_append_field_separator";
+	int result            = 0;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	switch( export_job->output_format )
+	{
+		case EXPORT_FORMAT_CSV:
+			result = export_buffer_append_character(
+			          export_job->output_buffer,
+			          (uint8_t) ',',
+			          error );
+			break;
+
+		case EXPORT_FORMAT_TSV:
+			result = export_buffer_append_character(
+			          export_job->output_buffer,
+			          (uint8_t) '\t',
+			          error );
+			break;
+
+		default:
+			result = export_job_append_text(
+			          export_job,
+			          json_key,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append field separator.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a value that is formatted as text but is not a string, such as
+ * a GUID or date and time, to the output buffer of an export job
+ * For NDJSON the value is quoted
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_append_quote(
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_append_quote";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job->output_format != EXPORT_FORMAT_NDJSON )
+	{
+		return( 1 );
+	}
+	if( export_buffer_append_character(
+	     export_job->output_buffer,
+	     (uint8_t) '"',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append quote.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the value of a record to the output buffer of an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_append_value(
+     export_job_t *export_job,
+     libfwps_record_t *record,
+     uint32_t value_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "export_job_append_value";
+	size_t string_size        = 0;
+	double value_double       = 0.0;
+	uint64_t value_64bit      = 0;
+	uint32_t value_32bit      = 0;
+	uint16_t value_16bit      = 0;
+	uint8_t value_boolean     = 0;
+	int result                = 0;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Values with insufficient data and vector values are exported as hexadecimal data
+	 */
+	switch( value_type )
+	{
+		case LIBFWPS_VALUE_TYPE_EMPTY:
+		case LIBFWPS_VALUE_TYPE_NULL:
+			if( export_job->output_format == EXPORT_FORMAT_NDJSON )
+			{
+				result = export_job_append_text(
+				          export_job,
+				          "null",
+				          error );
+			}
+			else
+			{
+				result = 1;
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BOOLEAN:
+			if( libfwps_record_get_data_as_boolean(
+			     record,
+			     &value_boolean,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			result = export_job_append_text(
+			          export_job,
+			          ( value_boolean != 0 ) ? "true" : "false",
+			          error );
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
+			if( data_size < 1 )
+			{
+				break;
+			}
+			result = export_buffer_append_signed_integer(
+			          export_job->output_buffer,
+			          (int64_t) (int8_t) data[ 0 ],
+			          error );
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
+			if( data_size < 1 )
+			{
+				break;
+			}
+			result = export_buffer_append_unsigned_integer(
+			          export_job->output_buffer,
+			          (uint64_t) data[ 0 ],
+			          error );
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			if( data_size < 2 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 data,
+			 value_16bit );
+
+			if( value_type == LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED )
+			{
+				result = export_buffer_append_signed_integer(
+				          export_job->output_buffer,
+				          (int64_t) (int16_t) value_16bit,
+				          error );
+			}
+			else
+			{
+				result = export_buffer_append_unsigned_integer(
+				          export_job->output_buffer,
+				          (uint64_t) value_16bit,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_ERROR:
+			if( data_size < 4 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 data,
+			 value_32bit );
+
+			if( ( value_type == LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED )
+			 || ( value_type == LIBFWPS_VALUE_TYPE_INTEGER_SIGNED ) )
+			{
+				result = export_buffer_append_signed_integer(
+				          export_job->output_buffer,
+				          (int64_t) (int32_t) value_32bit,
+				          error );
+			}
+			else
+			{
+				result = export_buffer_append_unsigned_integer(
+				          export_job->output_buffer,
+				          (uint64_t) value_32bit,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_CURRENCY:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+			if( data_size < 8 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 data,
+			 value_64bit );
+
+			if( value_type == LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED )
+			{
+				result = export_buffer_append_unsigned_integer(
+				          export_job->output_buffer,
+				          value_64bit,
+				          error );
+			}
+			else
+			{
+				result = export_buffer_append_signed_integer(
+				          export_job->output_buffer,
+				          (int64_t) value_64bit,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
+		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBFWPS_VALUE_TYPE_APPLICATION_TIME:
+			if( libfwps_record_get_data_as_floating_point(
+			     record,
+			     &value_double,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve floating point value.",
+				 function );
+
+				return( -1 );
+			}
+			/* NaN and infinity are not supported by JSON and are exported as a string
+			 */
+			if( ( value_double != value_double )
+			 || ( ( value_double - value_double ) != 0.0 ) )
+			{
+				result = export_job_append_quote(
+				          export_job,
+				          error );
+
+				if( result == 1 )
+				{
+					result = export_buffer_append_floating_point(
+					          export_job->output_buffer,
+					          value_double,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = export_job_append_quote(
+					          export_job,
+					          error );
+				}
+			}
+			else
+			{
+				result = export_buffer_append_floating_point(
+				          export_job->output_buffer,
+				          value_double,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FILETIME:
+			if( data_size < 8 )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 data,
+			 value_64bit );
+
+			result = export_job_append_quote(
+			          export_job,
+			          error );
+
+			if( result == 1 )
+			{
+				result = export_buffer_append_filetime(
+				          export_job->output_buffer,
+				          value_64bit,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = export_job_append_quote(
+				          export_job,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_GUID:
+			if( data_size < 16 )
+			{
+				break;
+			}
+			result = export_job_append_quote(
+			          export_job,
+			          error );
+
+			if( result == 1 )
+			{
+				result = export_buffer_append_guid(
+				          export_job->output_buffer,
+				          data,
+				          data_size,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = export_job_append_quote(
+				          export_job,
+				          error );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+			/* Strings that cannot be converted are exported as hexadecimal data
+			 */
+			if( libfwps_record_get_data_as_utf8_string_size(
+			     record,
+			     &string_size,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			if( string_size == 0 )
+			{
+				result = export_job_append_string(
+				          export_job,
+				          (uint8_t *) "",
+				          0,
+				          error );
+
+				break;
+			}
+			if( export_job_resize_buffer(
+			     &( export_job->string_buffer ),
+			     &( export_job->string_buffer_size ),
+			     string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize string buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwps_record_get_data_as_utf8_string(
+			     record,
+			     export_job->string_buffer,
+			     string_size,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			result = export_job_append_string(
+			          export_job,
+			          export_job->string_buffer,
+			          string_size - 1,
+			          error );
+			break;
+
+		default:
+			break;
+	}
+	if( result == 0 )
+	{
+		result = export_job_append_quote(
+		          export_job,
+		          error );
+
+		if( ( result == 1 )
+		 && ( data_size > 0 ) )
+		{
+			result = export_buffer_append_hexadecimal(
+			          export_job->output_buffer,
+			          data,
+			          data_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = export_job_append_quote(
+			          export_job,
+			          error );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports a record, this function is called by the scan of a store
+ * Returns 1 to continue the scan, 0 to stop the scan or -1 on error
+ */
+int export_job_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *data       = NULL;
+	export_job_t *export_job  = NULL;
+	static char *function     = "export_job_record_callback";
+	size_t data_size          = 0;
+	size_t entry_name_size    = 0;
+	uint32_t entry_type       = 0;
+	uint32_t value_type       = 0;
+	int is_named              = 0;
+	int result                = 0;
+
+	if( set_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	export_job = (export_job_t *) callback_data;
+
+	if( ( export_job->abort != NULL )
+	 && ( *( export_job->abort ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	is_named = libfwps_record_get_utf8_entry_name_size(
+	            record,
+	            &entry_name_size,
+	            error );
+
+	if( is_named == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( is_named == 0 )
+	{
+		if( libfwps_record_get_entry_type(
+		     record,
+		     &entry_type,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Use the value data in place when possible and only copy deferred value data
+	 */
+	result = libfwps_record_get_data_pointer(
+	          record,
+	          &data,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data pointer.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfwps_record_get_data_size(
+		     record,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			return( -1 );
+		}
+		data = NULL;
+
+		if( data_size > 0 )
+		{
+			if( export_job_resize_buffer(
+			     &( export_job->data_buffer ),
+			     &( export_job->data_buffer_size ),
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize data buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwps_record_get_data(
+			     record,
+			     export_job->data_buffer,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data.",
+				 function );
+
+				return( -1 );
+			}
+			data = export_job->data_buffer;
+		}
+	}
+	/* The columns are: source, fmtid, pid, name, vt and value
+	 * NDJSON only contains the pid or the name
+	 */
+	if( export_job->output_format == EXPORT_FORMAT_NDJSON )
+	{
+		result = export_job_append_text(
+		          export_job,
+		          "{\"source\":",
+		          error );
+	}
+	else
+	{
+		result = 1;
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_string(
+		          export_job,
+		          export_job->utf8_path,
+		          export_job->utf8_path_size - 1,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_field_separator(
+		          export_job,
+		          ",\"fmtid\":\"",
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_buffer_append_guid(
+		          export_job->output_buffer,
+		          set_identifier,
+		          16,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_quote(
+		          export_job,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append format identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_named == 0 )
+	{
+		result = export_job_append_field_separator(
+		          export_job,
+		          ",\"pid\":",
+		          error );
+
+		if( result == 1 )
+		{
+			result = export_buffer_append_unsigned_integer(
+			          export_job->output_buffer,
+			          (uint64_t) entry_type,
+			          error );
+		}
+		if( ( result == 1 )
+		 && ( export_job->output_format != EXPORT_FORMAT_NDJSON ) )
+		{
+			result = export_job_append_field_separator(
+			          export_job,
+			          NULL,
+			          error );
+		}
+	}
+	else
+	{
+		if( export_job->output_format != EXPORT_FORMAT_NDJSON )
+		{
+			result = export_job_append_field_separator(
+			          export_job,
+			          NULL,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = export_job_append_field_separator(
+			          export_job,
+			          ",\"name\":",
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = export_job_resize_buffer(
+			          &( export_job->string_buffer ),
+			          &( export_job->string_buffer_size ),
+			          entry_name_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = libfwps_record_get_utf8_entry_name(
+			          record,
+			          export_job->string_buffer,
+			          entry_name_size,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = export_job_append_string(
+			          export_job,
+			          export_job->string_buffer,
+			          entry_name_size - 1,
+			          error );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_job_append_field_separator(
+	          export_job,
+	          ",\"vt\":",
+	          error );
+
+	if( result == 1 )
+	{
+		result = export_buffer_append_unsigned_integer(
+		          export_job->output_buffer,
+		          (uint64_t) value_type,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_field_separator(
+		          export_job,
+		          ",\"value\":",
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_value(
+		          export_job,
+		          record,
+		          value_type,
+		          data,
+		          data_size,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = export_job_append_text(
+		          export_job,
+		          ( export_job->output_format == EXPORT_FORMAT_NDJSON ) ? "}\n" : "\n",
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	export_job->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Runs an export job, this function is called by the thread pool
+ * The output of the job is stored in its output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_run(
+     export_job_t *export_job,
+     void *arguments FWPSTOOLS_ATTRIBUTE_UNUSED )
+{
+	uint8_t *source_data    = NULL;
+	static char *function   = "export_job_run";
+	size_t source_data_size = 0;
+
+	FWPSTOOLS_UNREFERENCED_PARAMETER( arguments )
+
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	export_job->result = -1;
+
+	if( export_job->output_buffer == NULL )
+	{
+		if( export_buffer_initialize(
+		     &( export_job->output_buffer ),
+		     EXPORT_JOB_OUTPUT_BUFFER_SIZE,
+		     &( export_job->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( export_job->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( fwpstools_file_read_data(
+	     export_job->path,
+	     &source_data,
+	     &source_data_size,
+	     &( export_job->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( export_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_store_scan_byte_stream(
+	     source_data,
+	     source_data_size,
+	     export_job->ascii_codepage,
+	     &export_job_record_callback,
+	     (void *) export_job,
+	     &( export_job->error ) ) == -1 )
+	{
+		libcerror_error_set(
+		 &( export_job->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan store.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 source_data );
+
+	/* The buffers used for record values are only needed while scanning
+	 */
+	if( export_job->string_buffer != NULL )
+	{
+		memory_free(
+		 export_job->string_buffer );
+
+		export_job->string_buffer      = NULL;
+		export_job->string_buffer_size = 0;
+	}
+	if( export_job->data_buffer != NULL )
+	{
+		memory_free(
+		 export_job->data_buffer );
+
+		export_job->data_buffer      = NULL;
+		export_job->data_buffer_size = 0;
+	}
+	export_job->result = 1;
+
+	/* The result of the job is checked after the thread pool was joined
+	 */
+	return( 1 );
+
+on_error:
+	if( source_data != NULL )
+	{
+		memory_free(
+		 source_data );
+	}
+	return( 1 );
+}
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *export_handle )->jobs_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs array.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->output_format     = EXPORT_FORMAT_NDJSON;
+	( *export_handle )->ascii_codepage    = LIBFWPS_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->number_of_threads = 1;
+	( *export_handle )->output_stream     = stdout;
+	( *export_handle )->notify_stream     = stderr;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->output_stream_opened != 0 )
+		{
+			if( export_handle_close_output(
+			     *export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( ( *export_handle )->jobs_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &export_job_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_signal_abort";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_FORMAT_CSV;
+			result                       = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "tsv" ),
+		          3 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_FORMAT_TSV;
+			result                       = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "ndjson" ),
+		     6 ) == 0 )
+		{
+			export_handle->output_format = EXPORT_FORMAT_NDJSON;
+			result                       = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the ASCII codepage
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_ascii_codepage(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( export_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( export_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_handle_set_number_of_threads";
+	size_t string_index     = 0;
+	int number_of_threads   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		return( 0 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		return( 0 );
+	}
+#endif
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Opens the output
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "export_handle_open_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream_opened != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - output stream already opened.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	export_handle->output_stream        = stream;
+	export_handle->output_stream_opened = 1;
+
+	return( 1 );
+}
+
+/* Closes the output
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->output_stream_opened == 0 )
+	{
+		return( 0 );
+	}
+	export_handle->output_stream_opened = 0;
+
+	if( file_stream_close(
+	     export_handle->output_stream ) != 0 )
+	{
+		export_handle->output_stream = stdout;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output stream.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->output_stream = stdout;
+
+	return( 0 );
+}
+
+/* Appends a source file to the jobs of an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_source_file(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job = NULL;
+	static char *function    = "export_handle_append_source_file";
+	int entry_index          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job_initialize(
+	     &export_job,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create export job.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     export_handle->jobs_array,
+	     &entry_index,
+	     (intptr_t *) export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append export job to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_job != NULL )
+	{
+		export_job_free(
+		 &export_job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( EXPORT_HANDLE_HAVE_DIRECTORY_SUPPORT )
+
+/* Frees a path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_path_free(
+     system_character_t **path,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_path_free";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		memory_free(
+		 *path );
+
+		*path = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two paths
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int export_handle_path_compare(
+     system_character_t *first_path,
+     system_character_t *second_path,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_path_compare";
+	size_t path_index     = 0;
+
+	if( first_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first path.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second path.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( first_path[ path_index ] != 0 )
+	    && ( first_path[ path_index ] == second_path[ path_index ] ) )
+	{
+		path_index++;
+	}
+	if( first_path[ path_index ] < second_path[ path_index ] )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_path[ path_index ] > second_path[ path_index ] )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Appends the files in a directory and its sub directories to the jobs of an export handle
+ * The directory entries are sorted by name so the order of the output does not depend
+ * on the order in which the file system returns them
+ * Symbolic links and other special files in the directory are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_source_directory(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	libcdata_array_t *paths_array = NULL;
+	system_character_t *sub_path  = NULL;
+	struct dirent *directory_entry = NULL;
+	DIR *directory                = NULL;
+	static char *function         = "export_handle_append_source_directory";
+	size_t name_length            = 0;
+	size_t sub_path_length        = 0;
+	int entry_index               = 0;
+	int number_of_entries         = 0;
+	int result                    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &paths_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create paths array.",
+		 function );
+
+		goto on_error;
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		name_length = narrow_string_length(
+		               directory_entry->d_name );
+
+		if( ( ( name_length == 1 )
+		  &&  ( directory_entry->d_name[ 0 ] == '.' ) )
+		 || ( ( name_length == 2 )
+		  &&  ( directory_entry->d_name[ 0 ] == '.' )
+		  &&  ( directory_entry->d_name[ 1 ] == '.' ) ) )
+		{
+			continue;
+		}
+		sub_path_length = path_length + 1 + name_length;
+
+		sub_path = system_string_allocate(
+		            sub_path_length + 1 );
+
+		if( sub_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     sub_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to sub path.",
+			 function );
+
+			goto on_error;
+		}
+		sub_path[ path_length ] = (system_character_t) '/';
+
+		if( system_string_copy(
+		     &( sub_path[ path_length + 1 ] ),
+		     directory_entry->d_name,
+		     name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to sub path.",
+			 function );
+
+			goto on_error;
+		}
+		sub_path[ sub_path_length ] = 0;
+
+		result = libcdata_array_insert_entry(
+		          paths_array,
+		          &entry_index,
+		          (intptr_t *) sub_path,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &export_handle_path_compare,
+		          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub path into array.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			memory_free(
+			 sub_path );
+		}
+		sub_path = NULL;
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		directory = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	directory = NULL;
+
+	if( libcdata_array_get_number_of_entries(
+	     paths_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub paths.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     paths_array,
+		     entry_index,
+		     (intptr_t **) &sub_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub path: %d.",
+			 function,
+			 entry_index );
+
+			sub_path = NULL;
+
+			goto on_error;
+		}
+		sub_path_length = system_string_length(
+		                   sub_path );
+
+		/* Do not follow symbolic links to prevent cycles
+		 */
+		if( lstat(
+		     sub_path,
+		     &file_statistics ) != 0 )
+		{
+			sub_path = NULL;
+
+			continue;
+		}
+		if( S_ISDIR( file_statistics.st_mode ) )
+		{
+			result = export_handle_append_source_directory(
+			          export_handle,
+			          sub_path,
+			          sub_path_length,
+			          error );
+		}
+		else if( S_ISREG( file_statistics.st_mode ) )
+		{
+			result = export_handle_append_source_file(
+			          export_handle,
+			          sub_path,
+			          sub_path_length,
+			          error );
+		}
+		else
+		{
+			result = 1;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIs_SYSTEM ".",
+			 function,
+			 sub_path );
+
+			sub_path = NULL;
+
+			goto on_error;
+		}
+	}
+	sub_path = NULL;
+
+	if( libcdata_array_free(
+	     &paths_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &export_handle_path_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free paths array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	if( paths_array != NULL )
+	{
+		libcdata_array_free(
+		 &paths_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &export_handle_path_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( EXPORT_HANDLE_HAVE_DIRECTORY_SUPPORT ) */
+
+/* Appends a source to the jobs of an export handle
+ * If the source is a directory the files in the directory and its sub directories are appended
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_source(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( EXPORT_HANDLE_HAVE_DIRECTORY_SUPPORT )
+	struct stat file_statistics;
+#endif
+
+	static char *function = "export_handle_append_source";
+	size_t path_length    = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+#if defined( EXPORT_HANDLE_HAVE_DIRECTORY_SUPPORT )
+	/* Remove trailing path separators, except for the root directory
+	 */
+	while( ( path_length > 1 )
+	    && ( path[ path_length - 1 ] == (system_character_t) '/' ) )
+	{
+		path_length--;
+	}
+	if( ( stat(
+	       path,
+	       &file_statistics ) == 0 )
+	 && ( S_ISDIR( file_statistics.st_mode ) ) )
+	{
+		if( ( path_length == 1 )
+		 && ( path[ 0 ] == (system_character_t) '/' ) )
+		{
+			path_length = 0;
+		}
+		result = export_handle_append_source_directory(
+		          export_handle,
+		          path,
+		          path_length,
+		          error );
+	}
+	else
+#endif
+	{
+		result = export_handle_append_source_file(
+		          export_handle,
+		          path,
+		          path_length,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the header of the output
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_header(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	const char *header    = NULL;
+	static char *function = "export_handle_write_header";
+	size_t header_length  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( export_handle->output_format )
+	{
+		case EXPORT_FORMAT_CSV:
+			header = "source,fmtid,pid,name,vt,value\n";
+			break;
+
+		case EXPORT_FORMAT_TSV:
+			header = "source\tfmtid\tpid\tname\tvt\tvalue\n";
+			break;
+
+		default:
+			return( 1 );
+	}
+	header_length = narrow_string_length(
+	                 header );
+
+	if( file_stream_write(
+	     export_handle->output_stream,
+	     header,
+	     header_length ) != header_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs a batch of export jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_run_jobs(
+     export_handle_t *export_handle,
+     int first_job_index,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job = NULL;
+	static char *function    = "export_handle_run_jobs";
+	int job_index            = 0;
+	int result               = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( export_handle->number_of_threads > 1 )
+	 && ( number_of_jobs > 1 ) )
+	{
+		result = libcthreads_thread_pool_create(
+		          &thread_pool,
+		          NULL,
+		          ( export_handle->number_of_threads < number_of_jobs ) ? export_handle->number_of_threads : number_of_jobs,
+		          number_of_jobs,
+		          (int (*)(intptr_t *, void *)) &export_job_run,
+		          NULL,
+		          error );
+
+		for( job_index = first_job_index;
+		     ( result == 1 ) && ( job_index < ( first_job_index + number_of_jobs ) );
+		     job_index++ )
+		{
+			result = libcdata_array_get_entry_by_index(
+			          export_handle->jobs_array,
+			          job_index,
+			          (intptr_t **) &export_job,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libcthreads_thread_pool_push(
+				          thread_pool,
+				          (intptr_t *) export_job,
+				          error );
+			}
+		}
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     ( result == 1 ) ? error : NULL ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( job_index = first_job_index;
+		     ( result == 1 ) && ( job_index < ( first_job_index + number_of_jobs ) );
+		     job_index++ )
+		{
+			result = libcdata_array_get_entry_by_index(
+			          export_handle->jobs_array,
+			          job_index,
+			          (intptr_t **) &export_job,
+			          error );
+
+			if( result == 1 )
+			{
+				export_job_run(
+				 export_job,
+				 NULL );
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run export jobs.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records of the sources
+ * The sources are exported in batches, the output of a batch is written
+ * in the order of the sources once all jobs in the batch have completed
+ * Returns 1 if successful, 0 if not all sources could be exported or -1 on error
+ */
+int export_handle_export_sources(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job   = NULL;
+	static char *function      = "export_handle_export_sources";
+	int batch_size             = 0;
+	int first_job_index        = 0;
+	int job_index              = 0;
+	int number_of_batch_jobs   = 0;
+	int number_of_failed_jobs  = 0;
+	int number_of_jobs         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     export_handle->jobs_array,
+	     &number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_header(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	/* Limit the number of outputs that are buffered at the same time
+	 */
+	batch_size = export_handle->number_of_threads * EXPORT_HANDLE_JOBS_PER_THREAD;
+
+	for( first_job_index = 0;
+	     first_job_index < number_of_jobs;
+	     first_job_index += batch_size )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		number_of_batch_jobs = number_of_jobs - first_job_index;
+
+		if( number_of_batch_jobs > batch_size )
+		{
+			number_of_batch_jobs = batch_size;
+		}
+		for( job_index = first_job_index;
+		     job_index < ( first_job_index + number_of_batch_jobs );
+		     job_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     export_handle->jobs_array,
+			     job_index,
+			     (intptr_t **) &export_job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve job: %d.",
+				 function,
+				 job_index );
+
+				return( -1 );
+			}
+			export_job->output_format  = export_handle->output_format;
+			export_job->ascii_codepage = export_handle->ascii_codepage;
+			export_job->abort          = &( export_handle->abort );
+		}
+		if( export_handle_run_jobs(
+		     export_handle,
+		     first_job_index,
+		     number_of_batch_jobs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run jobs.",
+			 function );
+
+			return( -1 );
+		}
+		for( job_index = first_job_index;
+		     job_index < ( first_job_index + number_of_batch_jobs );
+		     job_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     export_handle->jobs_array,
+			     job_index,
+			     (intptr_t **) &export_job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve job: %d.",
+				 function,
+				 job_index );
+
+				return( -1 );
+			}
+			/* The output of a failed source is not written
+			 */
+			if( export_job->result != 1 )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Unable to export: %" PRIs_SYSTEM "\n",
+				 export_job->path );
+
+				if( export_job->error != NULL )
+				{
+					libcerror_error_backtrace_fprint(
+					 export_job->error,
+					 export_handle->notify_stream );
+
+					libcerror_error_free(
+					 &( export_job->error ) );
+				}
+				number_of_failed_jobs++;
+			}
+			else if( export_buffer_write_to_stream(
+			          export_job->output_buffer,
+			          export_handle->output_stream,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write output of: %" PRIs_SYSTEM ".",
+				 function,
+				 export_job->path );
+
+				return( -1 );
+			}
+			if( export_buffer_free(
+			     &( export_job->output_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( fflush(
+	     export_handle->output_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_jobs > 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,213 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "export_buffer.h"
+#include "fwpstools_libcdata.h"
+#include "fwpstools_libcerror.h"
+#include "fwpstools_libfwps.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_NDJSON		= (int) 'j',
+	EXPORT_FORMAT_CSV		= (int) 'c',
+	EXPORT_FORMAT_TSV		= (int) 't'
+};
+
+typedef struct export_job export_job_t;
+
+struct export_job
+{
+	/* The source path
+	 */
+	system_character_t *path;
+
+	/* The UTF-8 encoded source path
+	 */
+	uint8_t *utf8_path;
+
+	/* The UTF-8 encoded source path size
+	 */
+	size_t utf8_path_size;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* Value to indicate if the export should be aborted
+	 */
+	int *abort;
+
+	/* The output buffer
+	 */
+	export_buffer_t *output_buffer;
+
+	/* The data buffer, used for value data that is not available in memory
+	 */
+	uint8_t *data_buffer;
+
+	/* The data buffer size
+	 */
+	size_t data_buffer_size;
+
+	/* The string buffer, used for entry names and string values
+	 */
+	uint8_t *string_buffer;
+
+	/* The string buffer size
+	 */
+	size_t string_buffer_size;
+
+	/* The number of records exported
+	 */
+	uint64_t number_of_records;
+
+	/* The result of the job
+	 */
+	int result;
+
+	/* The error of the job
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The output format
+	 */
+	int output_format;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The jobs array, one job per source file
+	 */
+	libcdata_array_t *jobs_array;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate if the output stream was opened by the handle
+	 */
+	uint8_t output_stream_opened;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if the export should be aborted
+	 */
+	int abort;
+};
+
+int export_job_initialize(
+     export_job_t **export_job,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+int export_job_run(
+     export_job_t *export_job,
+     void *arguments );
+
+int export_job_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_output_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_ascii_codepage(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_open_output(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_output(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_append_source(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int export_handle_export_sources(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
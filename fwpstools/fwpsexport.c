@@ -0,0 +1,482 @@
+/*
+ * Exports the records of Windows Property Stores in bulk
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "export_handle.h"
+#include "fwpstools_getopt.h"
+#include "fwpstools_i18n.h"
+#include "fwpstools_libcerror.h"
+#include "fwpstools_libclocale.h"
+#include "fwpstools_libcnotify.h"
+#include "fwpstools_libfwps.h"
+#include "fwpstools_output.h"
+#include "fwpstools_signal.h"
+#include "fwpstools_unused.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+#define FWPSEXPORT_DEFAULT_NUMBER_OF_THREADS	4
+#else
+#define FWPSEXPORT_DEFAULT_NUMBER_OF_THREADS	1
+#endif
+
+export_handle_t *fwpsexport_export_handle = NULL;
+int fwpsexport_abort                      = 0;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwpsexport to export the records of Windows Property Stores\n"
+	                 "as NDJSON, CSV or TSV.\n\n" );
+
+	fprintf( stream, "Usage: fwpsexport [ -c codepage ] [ -f format ] [ -j threads ]\n"
+	                 "                  [ -t target ] [ -hvV ] source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: a file that contains a property store or a directory\n"
+	                 "\t        that contains such files\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256,\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-f:     output format, options: ndjson (default), csv, tsv\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of threads used to process the sources\n"
+	                 "\t        (default is %d)\n",
+	                 FWPSEXPORT_DEFAULT_NUMBER_OF_THREADS );
+	fprintf( stream, "\t-t:     write the output to the target file instead of stdout\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for fwpsexport
+ */
+void fwpsexport_signal_handler(
+      fwpstools_signal_t signal FWPSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "fwpsexport_signal_handler";
+
+	FWPSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fwpsexport_abort = 1;
+
+	if( fwpsexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     fwpsexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                 = NULL;
+	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_format         = NULL;
+	system_character_t *option_target         = NULL;
+	system_character_t *option_threads        = NULL;
+	char *program                             = "fwpsexport";
+	system_integer_t option                   = 0;
+	int argument_index                        = 0;
+	int result                                = 0;
+	int verbose                               = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fwpstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fwpstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = fwpstools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:f:hj:t:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fwpsoutput_version_fprint(
+				 stderr,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fwpsoutput_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				option_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fwpsoutput_version_fprint(
+				 stdout,
+				 program );
+
+				fwpsoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fwpsoutput_version_fprint(
+		 stderr,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source.\n" );
+
+		usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+#if !defined( HAVE_LOCAL_LIBFWPS )
+	libfwps_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfwps_notify_set_verbose(
+	 verbose );
+#endif
+
+	if( export_handle_initialize(
+	     &fwpsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( option_format != NULL )
+	{
+		result = export_handle_set_output_format(
+		          fwpsexport_export_handle,
+		          option_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format: %" PRIs_SYSTEM ".\n",
+			 option_format );
+
+			goto on_error;
+		}
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = export_handle_set_ascii_codepage(
+		          fwpsexport_export_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          fwpsexport_export_handle,
+		          option_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads: %" PRIs_SYSTEM ".\n",
+			 option_threads );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		fwpsexport_export_handle->number_of_threads = FWPSEXPORT_DEFAULT_NUMBER_OF_THREADS;
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( export_handle_append_source(
+		     fwpsexport_export_handle,
+		     argv[ argument_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	if( option_target != NULL )
+	{
+		if( export_handle_open_output(
+		     fwpsexport_export_handle,
+		     option_target,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open target: %" PRIs_SYSTEM ".\n",
+			 option_target );
+
+			goto on_error;
+		}
+	}
+	if( fwpstools_signal_attach(
+	     fwpsexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = export_handle_export_sources(
+	          fwpsexport_export_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export sources.\n" );
+
+		goto on_error;
+	}
+	if( fwpstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_close_output(
+	     fwpsexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &fwpsexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( fwpsexport_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Export aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Export completed with errors.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fwpsexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &fwpsexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,357 @@
+/*
+ * Shows information obtained from a Windows Property Store
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwpstools_getopt.h"
+#include "fwpstools_i18n.h"
+#include "fwpstools_libcerror.h"
+#include "fwpstools_libclocale.h"
+#include "fwpstools_libcnotify.h"
+#include "fwpstools_libfwps.h"
+#include "fwpstools_output.h"
+#include "fwpstools_signal.h"
+#include "fwpstools_unused.h"
+#include "info_handle.h"
+
+info_handle_t *fwpsinfo_info_handle = NULL;
+int fwpsinfo_abort                  = 0;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwpsinfo to determine information about a Windows Property Store.\n\n" );
+
+	fprintf( stream, "Usage: fwpsinfo [ -c codepage ] [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: a file that contains a property store\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256,\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for fwpsinfo
+ */
+void fwpsinfo_signal_handler(
+      fwpstools_signal_t signal FWPSTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "fwpsinfo_signal_handler";
+
+	FWPSTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fwpsinfo_abort = 1;
+
+	if( fwpsinfo_info_handle != NULL )
+	{
+		if( info_handle_signal_abort(
+		     fwpsinfo_info_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal info handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                 = NULL;
+	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "fwpsinfo";
+	system_integer_t option                   = 0;
+	int result                                = 0;
+	int verbose                               = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fwpstools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fwpstools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	fwpsoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = fwpstools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:hvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fwpsoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+
+#if !defined( HAVE_LOCAL_LIBFWPS )
+	libfwps_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfwps_notify_set_verbose(
+	 verbose );
+#endif
+
+	if( info_handle_initialize(
+	     &fwpsinfo_info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize info handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = info_handle_set_ascii_codepage(
+		          fwpsinfo_info_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in info handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( fwpstools_signal_attach(
+	     fwpsinfo_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle_open_input(
+	     fwpsinfo_info_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( info_handle_store_fprint(
+	     fwpsinfo_info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print store information.\n" );
+
+		goto on_error;
+	}
+	if( info_handle_close_input(
+	     fwpsinfo_info_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close info handle.\n" );
+
+		goto on_error;
+	}
+	if( fwpstools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle_free(
+	     &fwpsinfo_info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free info handle.\n" );
+
+		goto on_error;
+	}
+	if( fwpsinfo_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fwpsinfo_info_handle != NULL )
+	{
+		info_handle_free(
+		 &fwpsinfo_info_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,215 @@
+/*
+ * File functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fwpstools_file.h"
+#include "fwpstools_libcerror.h"
+
+/* The size of the blocks in which a file is read
+ */
+#define FWPSTOOLS_FILE_READ_BLOCK_SIZE	( 64 * 1024 )
+
+/* Reads all data of a file
+ * The data is read in blocks since the size of the file cannot be
+ * determined reliably for all types of files, e.g. pipes
+ * Returns 1 if successful or -1 on error
+ */
+int fwpstools_file_read_data(
+     const system_character_t *path,
+     uint8_t **file_data,
+     size_t *file_data_size,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	uint8_t *data         = NULL;
+	uint8_t *reallocation = NULL;
+	static char *function = "fwpstools_file_read_data";
+	size_t allocated_size = 0;
+	size_t data_size      = 0;
+	size_t read_count     = 0;
+	size_t read_size      = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          path,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          path,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	do
+	{
+		if( ( allocated_size - data_size ) < FWPSTOOLS_FILE_READ_BLOCK_SIZE )
+		{
+			if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - FWPSTOOLS_FILE_READ_BLOCK_SIZE ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid file size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( allocated_size == 0 )
+			{
+				read_size = FWPSTOOLS_FILE_READ_BLOCK_SIZE;
+			}
+			else if( allocated_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				read_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+			}
+			else
+			{
+				read_size = allocated_size * 2;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            data,
+			                            sizeof( uint8_t ) * read_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data.",
+				 function );
+
+				goto on_error;
+			}
+			data           = reallocation;
+			allocated_size = read_size;
+		}
+		read_size = allocated_size - data_size;
+
+		read_count = file_stream_read(
+		              stream,
+		              &( data[ data_size ] ),
+		              read_size );
+
+		data_size += read_count;
+
+		if( read_count < read_size )
+		{
+			if( file_stream_at_end(
+			     stream ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file: %" PRIs_SYSTEM ".",
+				 function,
+				 path );
+
+				goto on_error;
+			}
+			break;
+		}
+	}
+	while( read_count > 0 );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	*file_data      = data;
+	*file_data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,187 @@
+/*
+ * Signal handling functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SIGNAL_H )
+#include <signal.h>
+#endif
+
+#include "fwpstools_libcerror.h"
+#include "fwpstools_signal.h"
+
+#if defined( WINAPI )
+
+void (*fwpstools_signal_signal_handler)( fwpstools_signal_t ) = NULL;
+
+/* Signal handler for Ctrl+C or Ctrl+Break signals
+ */
+BOOL WINAPI fwpstools_signal_handler(
+             fwpstools_signal_t signal )
+{
+	switch( signal )
+	{
+		case CTRL_BREAK_EVENT:
+		case CTRL_C_EVENT:
+			if( fwpstools_signal_signal_handler != NULL )
+			{
+				fwpstools_signal_signal_handler(
+				 signal );
+			}
+			return( TRUE );
+
+		default:
+			break;
+	}
+	return( FALSE );
+}
+
+/* Attaches a signal handler for Ctrl+C or Ctrl+Break signals
+ * Returns 1 if successful or -1 on error
+ */
+int fwpstools_signal_attach(
+     void (*signal_handler)( fwpstools_signal_t ),
+     libcerror_error_t **error )
+{
+	static char *function = "fwpstools_signal_attach";
+
+	if( signal_handler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	fwpstools_signal_signal_handler = signal_handler;
+
+	if( SetConsoleCtrlHandler(
+	     (PHANDLER_ROUTINE) fwpstools_signal_handler,
+	     TRUE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to attach signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Detaches a signal handler for Ctrl+C or Ctrl+Break signals
+ * Returns 1 if successful or -1 on error
+ */
+int fwpstools_signal_detach(
+     libcerror_error_t **error )
+{
+	static char *function = "fwpstools_signal_detach";
+
+	if( SetConsoleCtrlHandler(
+	     (PHANDLER_ROUTINE) fwpstools_signal_handler,
+	     FALSE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to detach signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	fwpstools_signal_signal_handler = NULL;
+
+	return( 1 );
+}
+
+#elif defined( HAVE_SIGNAL_H )
+
+/* Attaches a signal handler for SIGINT
+ * Returns 1 if successful or -1 on error
+ */
+int fwpstools_signal_attach(
+     void (*signal_handler)( fwpstools_signal_t ),
+     libcerror_error_t **error )
+{
+	static char *function = "fwpstools_signal_attach";
+
+	if( signal_handler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	if( signal(
+	     SIGINT,
+	     signal_handler ) == SIG_ERR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to attach signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Detaches a signal handler for SIGINT
+ * Returns 1 if successful or -1 on error
+ */
+int fwpstools_signal_detach(
+     libcerror_error_t **error )
+{
+	static char *function = "fwpstools_signal_detach";
+
+	if( signal(
+	     SIGINT,
+	     SIG_DFL ) == SIG_ERR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to detach signal handler.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+#error missing signal functions
+#endif
+
@@ -0,0 +1,60 @@
+/*
+ * Signal handling functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWPSTOOLS_SIGNAL_H )
+#define _FWPSTOOLS_SIGNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fwpstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( WINAPI )
+typedef unsigned long fwpstools_signal_t;
+
+#else
+typedef int fwpstools_signal_t;
+
+#endif /* defined( WINAPI ) */
+
+#if defined( WINAPI )
+BOOL WINAPI fwpstools_signal_handler(
+             fwpstools_signal_t signal );
+
+#endif /* defined( WINAPI ) */
+
+int fwpstools_signal_attach(
+     void (*signal_handler)( fwpstools_signal_t ),
+     libcerror_error_t **error );
+
+int fwpstools_signal_detach(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWPSTOOLS_SIGNAL_H ) */
+
@@ -0,0 +1,832 @@
+/*
+ * Info handle
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fwpstools_file.h"
+#include "fwpstools_libcerror.h"
+#include "fwpstools_libclocale.h"
+#include "fwpstools_libfwps.h"
+#include "info_handle.h"
+
+/* Creates an info handle
+ * Make sure the value info_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_initialize(
+     info_handle_t **info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_initialize";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_handle = memory_allocate_structure(
+	                info_handle_t );
+
+	if( *info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *info_handle,
+	     0,
+	     sizeof( info_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear info handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *info_handle )->ascii_codepage = LIBFWPS_CODEPAGE_WINDOWS_1252;
+	( *info_handle )->notify_stream  = stdout;
+
+	return( 1 );
+
+on_error:
+	if( *info_handle != NULL )
+	{
+		memory_free(
+		 *info_handle );
+
+		*info_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an info handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_free(
+     info_handle_t **info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_free";
+	int result            = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_handle != NULL )
+	{
+		if( info_handle_close_input(
+		     *info_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *info_handle );
+
+		*info_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the info handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_signal_abort(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_signal_abort";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the ASCII codepage
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_ascii_codepage(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "info_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( info_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( info_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_open_input(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_open_input";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( fwpstools_file_read_data(
+	     filename,
+	     &( info_handle->data ),
+	     &( info_handle->data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read input.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_store_initialize(
+	     &( info_handle->store ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize store.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_store_copy_from_byte_stream(
+	     info_handle->store,
+	     info_handle->data,
+	     info_handle->data_size,
+	     info_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to copy store from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->store != NULL )
+	{
+		libfwps_store_free(
+		 &( info_handle->store ),
+		 NULL );
+	}
+	if( info_handle->data != NULL )
+	{
+		memory_free(
+		 info_handle->data );
+
+		info_handle->data = NULL;
+	}
+	info_handle->data_size = 0;
+
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int info_handle_close_input(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_close_input";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->store != NULL )
+	{
+		if( libfwps_store_free(
+		     &( info_handle->store ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free store.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( info_handle->data != NULL )
+	{
+		memory_free(
+		 info_handle->data );
+
+		info_handle->data = NULL;
+	}
+	info_handle->data_size = 0;
+
+	return( result );
+}
+
+/* Prints a GUID
+ * The GUID is stored in little-endian
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_guid_fprint(
+     info_handle_t *info_handle,
+     const uint8_t *guid_data,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_guid_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "{%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x}",
+	 guid_data[ 3 ], guid_data[ 2 ], guid_data[ 1 ], guid_data[ 0 ],
+	 guid_data[ 5 ], guid_data[ 4 ],
+	 guid_data[ 7 ], guid_data[ 6 ],
+	 guid_data[ 8 ], guid_data[ 9 ],
+	 guid_data[ 10 ], guid_data[ 11 ], guid_data[ 12 ], guid_data[ 13 ], guid_data[ 14 ], guid_data[ 15 ] );
+
+	return( 1 );
+}
+
+/* Prints the information of a record
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_record_fprint(
+     info_handle_t *info_handle,
+     int record_index,
+     libfwps_record_t *record,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_name    = NULL;
+	static char *function  = "info_handle_record_fprint";
+	size_t data_size       = 0;
+	size_t entry_name_size = 0;
+	uint32_t entry_type    = 0;
+	uint32_t value_type    = 0;
+	int result             = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRecord: %d\n",
+	 record_index + 1 );
+
+	result = libfwps_record_get_utf8_entry_name_size(
+	          record,
+	          &entry_name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( entry_name_size > 0 ) )
+	{
+		entry_name = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * entry_name_size );
+
+		if( entry_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwps_record_get_utf8_entry_name(
+		     record,
+		     entry_name,
+		     entry_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tEntry name\t\t\t: %s\n",
+		 (char *) entry_name );
+
+		memory_free(
+		 entry_name );
+
+		entry_name = NULL;
+	}
+	else
+	{
+		if( libfwps_record_get_entry_type(
+		     record,
+		     &entry_type,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry type.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tEntry type\t\t\t: %" PRIu32 "\n",
+		 entry_type );
+	}
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tValue type\t\t\t: 0x%04" PRIx32 "\n",
+	 value_type );
+
+	if( libfwps_record_get_data_size(
+	     record,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tData size\t\t\t: %" PRIzd "\n",
+	 (ssize_t) data_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( entry_name != NULL )
+	{
+		memory_free(
+		 entry_name );
+	}
+	return( -1 );
+}
+
+/* Prints the information of a set
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_fprint(
+     info_handle_t *info_handle,
+     int set_index,
+     libfwps_set_t *set,
+     libcerror_error_t **error )
+{
+	uint8_t guid_data[ 16 ];
+
+	libfwps_record_t *record = NULL;
+	static char *function    = "info_handle_set_fprint";
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_set_get_identifier(
+	     set,
+	     guid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_set_get_number_of_records(
+	     set,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Set: %d\n",
+	 set_index + 1 );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tIdentifier\t\t\t: " );
+
+	if( info_handle_guid_fprint(
+	     info_handle,
+	     guid_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print identifier.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of records\t\t: %d\n",
+	 number_of_records );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfwps_set_get_record_by_index(
+		     set,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		/* The record is managed by the set
+		 */
+		if( info_handle_record_fprint(
+		     info_handle,
+		     record_index,
+		     record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the store information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_store_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libfwps_set_t *set    = NULL;
+	static char *function = "info_handle_store_fprint";
+	int number_of_sets    = 0;
+	int set_index         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_store_get_number_of_sets(
+	     info_handle->store,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Windows Property Store information:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSize\t\t\t\t: %" PRIzd " bytes\n",
+	 (ssize_t) info_handle->data_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of sets\t\t\t: %d\n",
+	 number_of_sets );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfwps_store_get_set_by_index(
+		     info_handle->store,
+		     set_index,
+		     &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		/* The set is managed by the store
+		 */
+		if( info_handle_set_fprint(
+		     info_handle,
+		     set_index,
+		     set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,308 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwps_allocator.h"
+#include "libfwps_atomic.h"
+#include "libfwps_definitions.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+
+/* The allocate function, NULL represents memory_allocate
+ */
+static void *(*libfwps_allocator_allocate_function)(
+                size_t size,
+                void *context ) = NULL;
+
+/* The free function, NULL represents memory_free
+ */
+static void (*libfwps_allocator_free_function)(
+               void *memory,
+               void *context ) = NULL;
+
+/* The allocator context
+ */
+static void *libfwps_allocator_context = NULL;
+
+#if defined( HAVE_ALLOCATION_STATISTICS )
+
+/* The size of the header that precedes every allocation, which contains
+ * the size of the allocation and is a multiple of the maximum alignment
+ */
+#define LIBFWPS_ALLOCATOR_HEADER_SIZE	16
+
+/* The total number of allocations
+ */
+static uint64_t libfwps_allocator_number_of_allocations = 0;
+
+/* The total number of bytes allocated
+ */
+static uint64_t libfwps_allocator_allocated_size = 0;
+
+/* The number of bytes currently allocated
+ */
+static uint64_t libfwps_allocator_live_size = 0;
+
+/* The peak number of bytes allocated at the same time
+ */
+static uint64_t libfwps_allocator_peak_live_size = 0;
+
+/* The number of allocations per allocation type
+ */
+static uint64_t libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_NUMBER_OF_ALLOCATION_TYPES ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Updates the peak number of bytes allocated at the same time
+ */
+static void libfwps_allocator_update_peak_live_size(
+             uint64_t live_size )
+{
+	uint64_t peak_live_size = libfwps_atomic_load(
+	                           &libfwps_allocator_peak_live_size );
+
+	while( live_size > peak_live_size )
+	{
+		if( libfwps_atomic_compare_exchange(
+		     &libfwps_allocator_peak_live_size,
+		     peak_live_size,
+		     live_size ) != 0 )
+		{
+			break;
+		}
+		peak_live_size = libfwps_atomic_load(
+		                  &libfwps_allocator_peak_live_size );
+	}
+}
+
+#endif /* defined( HAVE_ALLOCATION_STATISTICS ) */
+
+/* Allocates memory using the allocator
+ * The allocation type is used for the allocation statistics
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libfwps_allocator_allocate(
+       size_t size,
+       int allocation_type )
+{
+	uint8_t *memory = NULL;
+
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	uint64_t live_size = 0;
+#endif
+
+	if( ( allocation_type < 0 )
+	 || ( allocation_type >= LIBFWPS_NUMBER_OF_ALLOCATION_TYPES ) )
+	{
+		return( NULL );
+	}
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	if( size > ( (size_t) SSIZE_MAX - LIBFWPS_ALLOCATOR_HEADER_SIZE ) )
+	{
+		return( NULL );
+	}
+	size += LIBFWPS_ALLOCATOR_HEADER_SIZE;
+#endif
+
+	if( libfwps_allocator_allocate_function != NULL )
+	{
+		memory = (uint8_t *) libfwps_allocator_allocate_function(
+		                      size,
+		                      libfwps_allocator_context );
+	}
+	else
+	{
+		memory = (uint8_t *) memory_allocate(
+		                      size );
+	}
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	if( memory == NULL )
+	{
+		return( NULL );
+	}
+	size -= LIBFWPS_ALLOCATOR_HEADER_SIZE;
+
+	*( (size_t *) memory ) = size;
+
+	libfwps_atomic_add(
+	 &libfwps_allocator_number_of_allocations,
+	 1 );
+
+	libfwps_atomic_add(
+	 &( libfwps_allocator_number_of_allocations_per_type[ allocation_type ] ),
+	 1 );
+
+	libfwps_atomic_add(
+	 &libfwps_allocator_allocated_size,
+	 (uint64_t) size );
+
+	live_size = libfwps_atomic_add(
+	             &libfwps_allocator_live_size,
+	             (uint64_t) size );
+
+	libfwps_allocator_update_peak_live_size(
+	 live_size );
+
+	memory += LIBFWPS_ALLOCATOR_HEADER_SIZE;
+#endif
+	return( memory );
+}
+
+/* Frees memory allocated by the allocator
+ */
+void libfwps_allocator_free(
+      void *memory )
+{
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	size_t size = 0;
+#endif
+
+	if( memory == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	memory = (void *) ( (uint8_t *) memory - LIBFWPS_ALLOCATOR_HEADER_SIZE );
+
+	size = *( (size_t *) memory );
+
+	libfwps_atomic_add(
+	 &libfwps_allocator_live_size,
+	 (uint64_t) 0 - (uint64_t) size );
+#endif
+	if( libfwps_allocator_free_function != NULL )
+	{
+		libfwps_allocator_free_function(
+		 memory,
+		 libfwps_allocator_context );
+	}
+	else
+	{
+		memory_free(
+		 memory );
+	}
+}
+
+/* Sets the allocator
+ * The allocate and free functions are either both set or both NULL,
+ * where NULL restores the default allocator. The context is passed
+ * to the functions as is
+ * The allocator must not be changed while there are libfwps objects
+ * or memory returned by libfwps, since memory is always freed with the
+ * free function of the current allocator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *context ),
+     void (*free_function)(
+             void *memory,
+             void *context ),
+     void *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_set_allocator";
+
+	if( ( ( allocate_function == NULL ) && ( free_function != NULL ) )
+	 || ( ( allocate_function != NULL ) && ( free_function == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocate and free function - both must be set or both must be NULL.",
+		 function );
+
+		return( -1 );
+	}
+	libfwps_allocator_allocate_function = allocate_function;
+	libfwps_allocator_free_function     = free_function;
+
+	if( allocate_function != NULL )
+	{
+		libfwps_allocator_context = context;
+	}
+	else
+	{
+		libfwps_allocator_context = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the allocation statistics
+ * The statistics are only available if libfwps was built with allocation statistics
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwps_get_statistics(
+     libfwps_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_get_statistics";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     statistics,
+	     0,
+	     sizeof( libfwps_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_ALLOCATION_STATISTICS )
+	statistics->number_of_allocations        = libfwps_atomic_load( &libfwps_allocator_number_of_allocations );
+	statistics->allocated_size               = libfwps_atomic_load( &libfwps_allocator_allocated_size );
+	statistics->live_size                    = libfwps_atomic_load( &libfwps_allocator_live_size );
+	statistics->peak_live_size               = libfwps_atomic_load( &libfwps_allocator_peak_live_size );
+	statistics->number_of_store_allocations        = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_STORE ] ) );
+	statistics->number_of_set_allocations          = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_SET ] ) );
+	statistics->number_of_record_allocations       = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_RECORD ] ) );
+	statistics->number_of_name_allocations         = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_NAME ] ) );
+	statistics->number_of_value_allocations        = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_VALUE ] ) );
+	statistics->number_of_store_cache_allocations  = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_STORE_CACHE ] ) );
+	statistics->number_of_hash_context_allocations = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_HASH_CONTEXT ] ) );
+	statistics->number_of_anomaly_allocations      = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_ANOMALY ] ) );
+	statistics->number_of_index_allocations        = libfwps_atomic_load( &( libfwps_allocator_number_of_allocations_per_type[ LIBFWPS_ALLOCATION_TYPE_INDEX ] ) );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
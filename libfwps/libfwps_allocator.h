@@ -0,0 +1,67 @@
+/*
+ * Allocator functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_ALLOCATOR_H )
+#define _LIBFWPS_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_extern.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define libfwps_allocator_allocate_structure( type, allocation_type ) \
+	(type *) libfwps_allocator_allocate( sizeof( type ), allocation_type )
+
+void *libfwps_allocator_allocate(
+       size_t size,
+       int allocation_type );
+
+void libfwps_allocator_free(
+      void *memory );
+
+LIBFWPS_EXTERN \
+int libfwps_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *context ),
+     void (*free_function)(
+             void *memory,
+             void *context ),
+     void *context,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_get_statistics(
+     libfwps_statistics_t *statistics,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_ALLOCATOR_H ) */
+
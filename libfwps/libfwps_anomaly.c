@@ -0,0 +1,468 @@
+/*
+ * Parse anomaly functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwps_allocator.h"
+#include "libfwps_anomaly.h"
+#include "libfwps_definitions.h"
+#include "libfwps_libcdata.h"
+#include "libfwps_libcerror.h"
+
+/* Creates an anomaly
+ * Make sure the value anomaly is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_initialize(
+     libfwps_anomaly_t **anomaly,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_anomaly_initialize";
+
+	if( anomaly == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid anomaly.",
+		 function );
+
+		return( -1 );
+	}
+	if( *anomaly != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid anomaly value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*anomaly = libfwps_allocator_allocate_structure(
+	            libfwps_anomaly_t,
+	            LIBFWPS_ALLOCATION_TYPE_ANOMALY );
+
+	if( *anomaly == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create anomaly.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *anomaly,
+	     0,
+	     sizeof( libfwps_anomaly_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear anomaly.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *anomaly != NULL )
+	{
+		libfwps_allocator_free(
+		 *anomaly );
+
+		*anomaly = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an anomaly
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_free(
+     libfwps_anomaly_t **anomaly,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_anomaly_free";
+
+	if( anomaly == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid anomaly.",
+		 function );
+
+		return( -1 );
+	}
+	if( *anomaly != NULL )
+	{
+		libfwps_allocator_free(
+		 *anomaly );
+
+		*anomaly = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if a parse error is caused by the data, in which case
+ * a lenient parse can skip the corresponding record or set
+ * Errors caused by insufficient memory or exceeding the parse limits
+ * are not recoverable
+ * Returns 1 if recoverable or 0 if not
+ */
+int libfwps_anomaly_is_recoverable_parse_error(
+     int parse_error_code )
+{
+	switch( parse_error_code )
+	{
+		case LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL:
+		case LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS:
+		case LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE:
+		case LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE:
+			return( 1 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Appends an anomaly to an anomalies array
+ * The anomalies array is created on the first anomaly
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_append_to_array(
+     libcdata_array_t **anomalies_array,
+     int anomaly_type,
+     off64_t offset,
+     int parse_error_code,
+     libcerror_error_t **error )
+{
+	libfwps_anomaly_t *anomaly = NULL;
+	static char *function      = "libfwps_anomaly_append_to_array";
+	int entry_index            = 0;
+
+	if( anomalies_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid anomalies array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *anomalies_array == NULL )
+	{
+		if( libcdata_array_initialize(
+		     anomalies_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create anomalies array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwps_anomaly_initialize(
+	     &anomaly,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create anomaly.",
+		 function );
+
+		goto on_error;
+	}
+	anomaly->anomaly_type     = anomaly_type;
+	anomaly->offset           = offset;
+	anomaly->parse_error_code = parse_error_code;
+
+	if( libcdata_array_append_entry(
+	     *anomalies_array,
+	     &entry_index,
+	     (intptr_t *) anomaly,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append anomaly to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( anomaly != NULL )
+	{
+		libfwps_anomaly_free(
+		 &anomaly,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends copies of the anomalies of a source anomalies array to a destination anomalies array
+ * The source anomalies array can be NULL if no anomalies were found
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_append_array_to_array(
+     libcdata_array_t **destination_anomalies_array,
+     libcdata_array_t *source_anomalies_array,
+     libcerror_error_t **error )
+{
+	libfwps_anomaly_t *anomaly = NULL;
+	static char *function      = "libfwps_anomaly_append_array_to_array";
+	int anomaly_index          = 0;
+	int number_of_anomalies    = 0;
+
+	if( source_anomalies_array == NULL )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     source_anomalies_array,
+	     &number_of_anomalies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from source anomalies array.",
+		 function );
+
+		return( -1 );
+	}
+	for( anomaly_index = 0;
+	     anomaly_index < number_of_anomalies;
+	     anomaly_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     source_anomalies_array,
+		     anomaly_index,
+		     (intptr_t **) &anomaly,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve anomaly: %d.",
+			 function,
+			 anomaly_index );
+
+			return( -1 );
+		}
+		if( anomaly == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing anomaly: %d.",
+			 function,
+			 anomaly_index );
+
+			return( -1 );
+		}
+		if( libfwps_anomaly_append_to_array(
+		     destination_anomalies_array,
+		     anomaly->anomaly_type,
+		     anomaly->offset,
+		     anomaly->parse_error_code,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append anomaly: %d.",
+			 function,
+			 anomaly_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of anomalies in an anomalies array
+ * The anomalies array can be NULL if no anomalies were found
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_array_get_number_of_anomalies(
+     libcdata_array_t *anomalies_array,
+     int *number_of_anomalies,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_anomaly_array_get_number_of_anomalies";
+
+	if( number_of_anomalies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of anomalies.",
+		 function );
+
+		return( -1 );
+	}
+	if( anomalies_array == NULL )
+	{
+		*number_of_anomalies = 0;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     anomalies_array,
+	     number_of_anomalies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from anomalies array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific anomaly from an anomalies array
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_anomaly_array_get_anomaly_by_index(
+     libcdata_array_t *anomalies_array,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error )
+{
+	libfwps_anomaly_t *anomaly = NULL;
+	static char *function      = "libfwps_anomaly_array_get_anomaly_by_index";
+
+	if( anomaly_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid anomaly type.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse error code.",
+		 function );
+
+		return( -1 );
+	}
+	if( anomalies_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid anomaly index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     anomalies_array,
+	     anomaly_index,
+	     (intptr_t **) &anomaly,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve anomaly: %d.",
+		 function,
+		 anomaly_index );
+
+		return( -1 );
+	}
+	if( anomaly == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing anomaly: %d.",
+		 function,
+		 anomaly_index );
+
+		return( -1 );
+	}
+	*anomaly_type     = anomaly->anomaly_type;
+	*offset           = anomaly->offset;
+	*parse_error_code = anomaly->parse_error_code;
+
+	return( 1 );
+}
+
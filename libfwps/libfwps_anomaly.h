@@ -0,0 +1,93 @@
+/*
+ * Parse anomaly functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_ANOMALY_H )
+#define _LIBFWPS_ANOMALY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_libcdata.h"
+#include "libfwps_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwps_anomaly libfwps_anomaly_t;
+
+struct libfwps_anomaly
+{
+	/* The anomaly type, which contains a LIBFWPS_ANOMALY_TYPE value
+	 */
+	int anomaly_type;
+
+	/* The offset relative to the start of the data the store or set was read from
+	 */
+	off64_t offset;
+
+	/* The parse error code, which contains a LIBFWPS_PARSE_ERROR value
+	 */
+	int parse_error_code;
+};
+
+int libfwps_anomaly_initialize(
+     libfwps_anomaly_t **anomaly,
+     libcerror_error_t **error );
+
+int libfwps_anomaly_free(
+     libfwps_anomaly_t **anomaly,
+     libcerror_error_t **error );
+
+int libfwps_anomaly_is_recoverable_parse_error(
+     int parse_error_code );
+
+int libfwps_anomaly_append_to_array(
+     libcdata_array_t **anomalies_array,
+     int anomaly_type,
+     off64_t offset,
+     int parse_error_code,
+     libcerror_error_t **error );
+
+int libfwps_anomaly_append_array_to_array(
+     libcdata_array_t **destination_anomalies_array,
+     libcdata_array_t *source_anomalies_array,
+     libcerror_error_t **error );
+
+int libfwps_anomaly_array_get_number_of_anomalies(
+     libcdata_array_t *anomalies_array,
+     int *number_of_anomalies,
+     libcerror_error_t **error );
+
+int libfwps_anomaly_array_get_anomaly_by_index(
+     libcdata_array_t *anomalies_array,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_ANOMALY_H ) */
+
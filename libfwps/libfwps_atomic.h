@@ -0,0 +1,73 @@
+/*
+ * Atomic operations on 64-bit counters
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_ATOMIC_H )
+#define _LIBFWPS_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define libfwps_atomic_add( value, addend ) \
+	__atomic_add_fetch( value, addend, __ATOMIC_RELAXED )
+
+#define libfwps_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libfwps_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#define libfwps_atomic_compare_exchange( value, expected_value, new_value ) \
+	__atomic_compare_exchange_n( value, &( expected_value ), new_value, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED )
+
+#elif defined( _MSC_VER )
+#define libfwps_atomic_add( value, addend ) \
+	(uint64_t) InterlockedAdd64( (LONG64 volatile *) value, (LONG64) addend )
+
+#define libfwps_atomic_load( value ) \
+	(uint64_t) InterlockedCompareExchange64( (LONG64 volatile *) value, 0, 0 )
+
+#define libfwps_atomic_store( value, new_value ) \
+	InterlockedExchange64( (LONG64 volatile *) value, (LONG64) new_value )
+
+#define libfwps_atomic_compare_exchange( value, expected_value, new_value ) \
+	( (uint64_t) InterlockedCompareExchange64( (LONG64 volatile *) value, (LONG64) new_value, (LONG64) expected_value ) == expected_value )
+
+#else
+/* Without atomic operations the counters can miss updates and the values
+ * are not reliable when they are used by multiple threads at the same time
+ */
+#define libfwps_atomic_add( value, addend ) \
+	( *( value ) += ( addend ) )
+
+#define libfwps_atomic_load( value ) \
+	*( value )
+
+#define libfwps_atomic_store( value, new_value ) \
+	*( value ) = ( new_value )
+
+#define libfwps_atomic_compare_exchange( value, expected_value, new_value ) \
+	( ( *( value ) == ( expected_value ) ) ? ( *( value ) = ( new_value ), 1 ) : 0 )
+
+#endif
+
+#endif /* !defined( _LIBFWPS_ATOMIC_H ) */
+
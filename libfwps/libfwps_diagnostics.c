@@ -0,0 +1,367 @@
+/*
+ * Diagnostics functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwps_atomic.h"
+#include "libfwps_definitions.h"
+#include "libfwps_diagnostics.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+#include "libfwps_unused.h"
+
+/* The maximum number of events in the ring buffer
+ */
+#define LIBFWPS_DIAGNOSTICS_MAXIMUM_NUMBER_OF_EVENTS	( 1 << 24 )
+
+typedef struct libfwps_diagnostics_slot libfwps_diagnostics_slot_t;
+
+struct libfwps_diagnostics_slot
+{
+	/* The sequence number, which indicates if the slot can be written
+	 * or read at a specific position
+	 */
+	uint64_t sequence_number;
+
+	/* The event
+	 */
+	libfwps_diagnostic_event_t event;
+};
+
+/* Value to indicate the diagnostic events are enabled
+ */
+int libfwps_diagnostics_enabled = 0;
+
+/* The ring buffer slots
+ */
+static libfwps_diagnostics_slot_t *libfwps_diagnostics_slots = NULL;
+
+/* The ring buffer position mask, which is the number of slots - 1
+ */
+static uint64_t libfwps_diagnostics_position_mask = 0;
+
+/* The position the next event is written to
+ */
+static uint64_t libfwps_diagnostics_write_position = 0;
+
+/* The position the next event is read from
+ */
+static uint64_t libfwps_diagnostics_read_position = 0;
+
+/* The number of events dropped because the ring buffer was full
+ */
+static uint64_t libfwps_diagnostics_number_of_dropped_events = 0;
+
+/* Pushes a diagnostic event onto the ring buffer
+ * A slot is claimed by advancing the write position, after which the event
+ * is copied and the slot is published to the readers by its sequence number
+ * The event is dropped if the ring buffer is full
+ */
+void libfwps_diagnostics_push_event(
+      int event_type,
+      off64_t offset,
+      size64_t size,
+      uint32_t value_type,
+      int decision,
+      uint8_t anomaly_flags,
+      int parse_error_code )
+{
+	libfwps_diagnostics_slot_t *slot = NULL;
+	uint64_t position                = 0;
+	uint64_t sequence_number         = 0;
+
+	if( libfwps_diagnostics_slots == NULL )
+	{
+		return;
+	}
+	position = libfwps_atomic_load(
+	            &libfwps_diagnostics_write_position );
+
+	for( ;; )
+	{
+		slot = &( libfwps_diagnostics_slots[ position & libfwps_diagnostics_position_mask ] );
+
+		sequence_number = libfwps_atomic_load(
+		                   &( slot->sequence_number ) );
+
+		if( sequence_number == position )
+		{
+			if( libfwps_atomic_compare_exchange(
+			     &libfwps_diagnostics_write_position,
+			     position,
+			     position + 1 ) )
+			{
+				break;
+			}
+			position = libfwps_atomic_load(
+			            &libfwps_diagnostics_write_position );
+		}
+		else if( (int64_t) ( sequence_number - position ) < 0 )
+		{
+			/* The slot still contains an event that was not read
+			 */
+			libfwps_atomic_add(
+			 &libfwps_diagnostics_number_of_dropped_events,
+			 1 );
+
+			return;
+		}
+		else
+		{
+			position = libfwps_atomic_load(
+			            &libfwps_diagnostics_write_position );
+		}
+	}
+	slot->event.event_type       = event_type;
+	slot->event.offset           = offset;
+	slot->event.size             = size;
+	slot->event.value_type       = value_type;
+	slot->event.decision         = decision;
+	slot->event.anomaly_flags    = anomaly_flags;
+	slot->event.parse_error_code = parse_error_code;
+
+	libfwps_atomic_store(
+	 &( slot->sequence_number ),
+	 position + 1 );
+}
+
+/* Enables the diagnostic events
+ * A diagnostic event is queued for every set and record that is read.
+ * The events are stored in a ring buffer of number of events entries, which
+ * must be a power of 2. When the ring buffer is full new events are dropped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_diagnostics_enable(
+     int number_of_events,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_diagnostics_enable";
+	int slot_index        = 0;
+
+	if( libfwps_diagnostics_slots != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diagnostics - ring buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_events <= 0 )
+	 || ( number_of_events > LIBFWPS_DIAGNOSTICS_MAXIMUM_NUMBER_OF_EVENTS )
+	 || ( ( number_of_events & ( number_of_events - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of events value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	libfwps_diagnostics_slots = (libfwps_diagnostics_slot_t *) memory_allocate(
+	                                                            sizeof( libfwps_diagnostics_slot_t ) * number_of_events );
+
+	if( libfwps_diagnostics_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create ring buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     libfwps_diagnostics_slots,
+	     0,
+	     sizeof( libfwps_diagnostics_slot_t ) * number_of_events ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear ring buffer.",
+		 function );
+
+		memory_free(
+		 libfwps_diagnostics_slots );
+
+		libfwps_diagnostics_slots = NULL;
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < number_of_events;
+	     slot_index++ )
+	{
+		libfwps_diagnostics_slots[ slot_index ].sequence_number = (uint64_t) slot_index;
+	}
+	libfwps_diagnostics_position_mask            = (uint64_t) number_of_events - 1;
+	libfwps_diagnostics_write_position           = 0;
+	libfwps_diagnostics_read_position            = 0;
+	libfwps_diagnostics_number_of_dropped_events = 0;
+
+	libfwps_diagnostics_enabled = 1;
+
+	return( 1 );
+}
+
+/* Disables the diagnostic events and frees the ring buffer
+ * The diagnostic events must not be disabled while libfwps is used by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_diagnostics_disable(
+     libcerror_error_t **error )
+{
+	LIBFWPS_UNREFERENCED_PARAMETER( error )
+
+	libfwps_diagnostics_enabled = 0;
+
+	if( libfwps_diagnostics_slots != NULL )
+	{
+		memory_free(
+		 libfwps_diagnostics_slots );
+
+		libfwps_diagnostics_slots = NULL;
+	}
+	libfwps_diagnostics_position_mask = 0;
+
+	return( 1 );
+}
+
+/* Reads the next diagnostic event from the ring buffer
+ * Events can be read by a different thread than the one that reads the data
+ * Returns 1 if successful, 0 if no event is available or -1 on error
+ */
+int libfwps_diagnostics_read_event(
+     libfwps_diagnostic_event_t *event,
+     libcerror_error_t **error )
+{
+	libfwps_diagnostics_slot_t *slot = NULL;
+	static char *function            = "libfwps_diagnostics_read_event";
+	uint64_t position                = 0;
+	uint64_t sequence_number         = 0;
+
+	if( event == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_diagnostics_slots == NULL )
+	{
+		return( 0 );
+	}
+	position = libfwps_atomic_load(
+	            &libfwps_diagnostics_read_position );
+
+	for( ;; )
+	{
+		slot = &( libfwps_diagnostics_slots[ position & libfwps_diagnostics_position_mask ] );
+
+		sequence_number = libfwps_atomic_load(
+		                   &( slot->sequence_number ) );
+
+		if( sequence_number == ( position + 1 ) )
+		{
+			if( libfwps_atomic_compare_exchange(
+			     &libfwps_diagnostics_read_position,
+			     position,
+			     position + 1 ) )
+			{
+				break;
+			}
+			position = libfwps_atomic_load(
+			            &libfwps_diagnostics_read_position );
+		}
+		else if( (int64_t) ( sequence_number - ( position + 1 ) ) < 0 )
+		{
+			/* The slot does not yet contain a published event
+			 */
+			return( 0 );
+		}
+		else
+		{
+			position = libfwps_atomic_load(
+			            &libfwps_diagnostics_read_position );
+		}
+	}
+	if( memory_copy(
+	     event,
+	     &( slot->event ),
+	     sizeof( libfwps_diagnostic_event_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy event.",
+		 function );
+
+		return( -1 );
+	}
+	/* Release the slot for the write position one lap later
+	 */
+	libfwps_atomic_store(
+	 &( slot->sequence_number ),
+	 position + libfwps_diagnostics_position_mask + 1 );
+
+	return( 1 );
+}
+
+/* Retrieves the number of diagnostic events that were dropped because the ring buffer was full
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_diagnostics_get_number_of_dropped_events(
+     uint64_t *number_of_dropped_events,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_diagnostics_get_number_of_dropped_events";
+
+	if( number_of_dropped_events == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of dropped events.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_dropped_events = libfwps_atomic_load(
+	                             &libfwps_diagnostics_number_of_dropped_events );
+
+	return( 1 );
+}
+
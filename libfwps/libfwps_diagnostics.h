@@ -0,0 +1,86 @@
+/*
+ * Diagnostics functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_DIAGNOSTICS_H )
+#define _LIBFWPS_DIAGNOSTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_extern.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Value to indicate the diagnostic events are enabled
+ */
+extern int libfwps_diagnostics_enabled;
+
+/* The diagnostic events are disabled in most cases hence the check
+ * is hinted to the compiler as unlikely
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define libfwps_diagnostics_is_enabled() \
+	__builtin_expect( libfwps_diagnostics_enabled != 0, 0 )
+
+#else
+#define libfwps_diagnostics_is_enabled() \
+	( libfwps_diagnostics_enabled != 0 )
+
+#endif
+
+void libfwps_diagnostics_push_event(
+      int event_type,
+      off64_t offset,
+      size64_t size,
+      uint32_t value_type,
+      int decision,
+      uint8_t anomaly_flags,
+      int parse_error_code );
+
+LIBFWPS_EXTERN \
+int libfwps_diagnostics_enable(
+     int number_of_events,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_diagnostics_disable(
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_diagnostics_read_event(
+     libfwps_diagnostic_event_t *event,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_diagnostics_get_number_of_dropped_events(
+     uint64_t *number_of_dropped_events,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_DIAGNOSTICS_H ) */
+
@@ -0,0 +1,479 @@
+/*
+ * Non-cryptographic hash functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwps_allocator.h"
+#include "libfwps_definitions.h"
+#include "libfwps_hash.h"
+#include "libfwps_libcerror.h"
+
+/* The hash is MurmurHash3 x64 128-bit with a seed of 0
+ */
+#define LIBFWPS_HASH_C1		0x87c37b91114253d5ULL
+#define LIBFWPS_HASH_C2		0x4cf5ad432745937fULL
+
+#define libfwps_hash_rotate_left( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+/* Mixes the bits of a 64-bit value
+ */
+static uint64_t libfwps_hash_final_mix(
+                 uint64_t value )
+{
+	value ^= value >> 33;
+	value *= 0xff51afd7ed558ccdULL;
+	value ^= value >> 33;
+	value *= 0xc4ceb9fe1a85ec53ULL;
+	value ^= value >> 33;
+
+	return( value );
+}
+
+/* Mixes a 16-byte block into the hash state
+ */
+static void libfwps_hash_context_transform_block(
+             libfwps_hash_context_t *context,
+             const uint8_t *block )
+{
+	uint64_t k1 = 0;
+	uint64_t k2 = 0;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 block,
+	 k1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block[ 8 ] ),
+	 k2 );
+
+	k1 *= LIBFWPS_HASH_C1;
+	k1  = libfwps_hash_rotate_left( k1, 31 );
+	k1 *= LIBFWPS_HASH_C2;
+
+	context->h1 ^= k1;
+	context->h1  = libfwps_hash_rotate_left( context->h1, 27 );
+	context->h1 += context->h2;
+	context->h1  = ( context->h1 * 5 ) + 0x52dce729UL;
+
+	k2 *= LIBFWPS_HASH_C2;
+	k2  = libfwps_hash_rotate_left( k2, 33 );
+	k2 *= LIBFWPS_HASH_C1;
+
+	context->h2 ^= k2;
+	context->h2  = libfwps_hash_rotate_left( context->h2, 31 );
+	context->h2 += context->h1;
+	context->h2  = ( context->h2 * 5 ) + 0x38495ab5UL;
+}
+
+/* Resets a hash context to its initial state
+ */
+void libfwps_hash_context_reset(
+      libfwps_hash_context_t *context )
+{
+	if( context != NULL )
+	{
+		context->h1         = 0;
+		context->h2         = 0;
+		context->block_size = 0;
+		context->data_size  = 0;
+	}
+}
+
+/* Creates a hash context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_hash_context_initialize(
+     libfwps_hash_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_hash_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = libfwps_allocator_allocate_structure(
+	            libfwps_hash_context_t,
+	            LIBFWPS_ALLOCATION_TYPE_HASH_CONTEXT );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *context,
+	     0,
+	     sizeof( libfwps_hash_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		libfwps_allocator_free(
+		 *context );
+
+		*context = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a hash context
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_hash_context_free(
+     libfwps_hash_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_hash_context_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libfwps_allocator_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the hash context with data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_hash_context_update(
+     libfwps_hash_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_hash_context_update";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer == NULL )
+	 && ( size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->data_size += (uint64_t) size;
+
+	if( context->block_size > 0 )
+	{
+		copy_size = 16 - context->block_size;
+
+		if( copy_size > size )
+		{
+			copy_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_size ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size += copy_size;
+		buffer_offset        = copy_size;
+
+		if( context->block_size < 16 )
+		{
+			return( 1 );
+		}
+		libfwps_hash_context_transform_block(
+		 context,
+		 context->block );
+
+		context->block_size = 0;
+	}
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		libfwps_hash_context_transform_block(
+		 context,
+		 &( buffer[ buffer_offset ] ) );
+
+		buffer_offset += 16;
+	}
+	if( buffer_offset < size )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_size = size - buffer_offset;
+	}
+	return( 1 );
+}
+
+/* Finalizes the hash context and retrieves the hash
+ * The hash is stored as 2 little-endian 64-bit values and requires 16 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_hash_context_finalize(
+     libfwps_hash_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_hash_context_finalize";
+	uint64_t h1           = 0;
+	uint64_t h2           = 0;
+	uint64_t k1           = 0;
+	uint64_t k2           = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < LIBFWPS_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	h1 = context->h1;
+	h2 = context->h2;
+
+	if( context->block_size > 0 )
+	{
+		if( memory_set(
+		     &( context->block[ context->block_size ] ),
+		     0,
+		     16 - context->block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 context->block,
+		 k1 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( context->block[ 8 ] ),
+		 k2 );
+
+		if( context->block_size > 8 )
+		{
+			k2 *= LIBFWPS_HASH_C2;
+			k2  = libfwps_hash_rotate_left( k2, 33 );
+			k2 *= LIBFWPS_HASH_C1;
+			h2 ^= k2;
+		}
+		k1 *= LIBFWPS_HASH_C1;
+		k1  = libfwps_hash_rotate_left( k1, 31 );
+		k1 *= LIBFWPS_HASH_C2;
+		h1 ^= k1;
+	}
+	h1 ^= context->data_size;
+	h2 ^= context->data_size;
+
+	h1 += h2;
+	h2 += h1;
+
+	h1 = libfwps_hash_final_mix(
+	      h1 );
+	h2 = libfwps_hash_final_mix(
+	      h2 );
+
+	h1 += h2;
+	h2 += h1;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 hash,
+	 h1 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( hash[ 8 ] ),
+	 h2 );
+
+	return( 1 );
+}
+
+/* Calculates the hash of a buffer
+ * The hash is stored as 2 little-endian 64-bit values and requires 16 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_hash_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libfwps_hash_context_t context;
+	static char *function = "libfwps_hash_calculate";
+
+	libfwps_hash_context_reset(
+	 &context );
+
+	if( libfwps_hash_context_update(
+	     &context,
+	     buffer,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_hash_context_finalize(
+	     &context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize hash context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
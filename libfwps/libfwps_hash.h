@@ -0,0 +1,98 @@
+/*
+ * Non-cryptographic hash functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_HASH_H )
+#define _LIBFWPS_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a hash
+ */
+#define LIBFWPS_HASH_SIZE	16
+
+typedef struct libfwps_hash_context libfwps_hash_context_t;
+
+struct libfwps_hash_context
+{
+	/* The first half of the hash state
+	 */
+	uint64_t h1;
+
+	/* The second half of the hash state
+	 */
+	uint64_t h2;
+
+	/* The block, which contains data that does not yet fill a full block
+	 */
+	uint8_t block[ 16 ];
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The total size of the hashed data
+	 */
+	uint64_t data_size;
+};
+
+void libfwps_hash_context_reset(
+      libfwps_hash_context_t *context );
+
+int libfwps_hash_context_initialize(
+     libfwps_hash_context_t **context,
+     libcerror_error_t **error );
+
+int libfwps_hash_context_free(
+     libfwps_hash_context_t **context,
+     libcerror_error_t **error );
+
+int libfwps_hash_context_update(
+     libfwps_hash_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libfwps_hash_context_finalize(
+     libfwps_hash_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libfwps_hash_calculate(
+     const uint8_t *buffer,
+     size_t size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_HASH_H ) */
+
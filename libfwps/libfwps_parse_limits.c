@@ -0,0 +1,150 @@
+/*
+ * Parse limits functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_libcerror.h"
+#include "libfwps_parse_limits.h"
+
+/* Sets the parse limits
+ * A limit of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_parse_limits_set(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t maximum_total_size,
+     int maximum_number_of_sets,
+     int maximum_number_of_records_per_set,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_parse_limits_set";
+
+	if( parse_limits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse limits.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_sets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of sets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_records_per_set < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of records per set value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	parse_limits->maximum_total_size                = maximum_total_size;
+	parse_limits->maximum_number_of_sets            = maximum_number_of_sets;
+	parse_limits->maximum_number_of_records_per_set = maximum_number_of_records_per_set;
+	parse_limits->maximum_number_of_vector_values   = maximum_number_of_vector_values;
+
+	return( 1 );
+}
+
+/* Determines if a size fits within the remaining maximum total size
+ * Returns 1 if the size fits, 0 if not or -1 on error
+ */
+int libfwps_parse_limits_check_size(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_parse_limits_check_size";
+
+	if( parse_limits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse limits.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_limits->maximum_total_size == 0 )
+	{
+		return( 1 );
+	}
+	if( ( parse_limits->total_size > parse_limits->maximum_total_size )
+	 || ( size > ( parse_limits->maximum_total_size - parse_limits->total_size ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reserves a size from the remaining maximum total size
+ * The size is reserved before the corresponding memory is allocated
+ * Returns 1 if successful, 0 if the size does not fit or -1 on error
+ */
+int libfwps_parse_limits_reserve_size(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_parse_limits_reserve_size";
+	int result            = 0;
+
+	result = libfwps_parse_limits_check_size(
+	          parse_limits,
+	          size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if size fits within maximum total size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		parse_limits->total_size += size;
+	}
+	return( result );
+}
+
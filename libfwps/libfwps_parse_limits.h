@@ -0,0 +1,83 @@
+/*
+ * Parse limits functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_PARSE_LIMITS_H )
+#define _LIBFWPS_PARSE_LIMITS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwps_parse_limits libfwps_parse_limits_t;
+
+struct libfwps_parse_limits
+{
+	/* The maximum total size of the sets, records, names and value data
+	 * created by a parse, where 0 represents no limit
+	 */
+	size64_t maximum_total_size;
+
+	/* The maximum number of sets, where 0 represents no limit
+	 */
+	int maximum_number_of_sets;
+
+	/* The maximum number of records per set, where 0 represents no limit
+	 */
+	int maximum_number_of_records_per_set;
+
+	/* The maximum number of vector values, where 0 represents no limit
+	 */
+	uint32_t maximum_number_of_vector_values;
+
+	/* The total size created by the current parse
+	 */
+	size64_t total_size;
+};
+
+int libfwps_parse_limits_set(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t maximum_total_size,
+     int maximum_number_of_sets,
+     int maximum_number_of_records_per_set,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error );
+
+int libfwps_parse_limits_check_size(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfwps_parse_limits_reserve_size(
+     libfwps_parse_limits_t *parse_limits,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_PARSE_LIMITS_H ) */
+
@@ -27,12 +27,18 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfwps_allocator.h"
 #include "libfwps_debug.h"
 #include "libfwps_definitions.h"
+#include "libfwps_diagnostics.h"
+#include "libfwps_hash.h"
+#include "libfwps_libbfio.h"
+#include "libfwps_libcdata.h"
 #include "libfwps_libcerror.h"
 #include "libfwps_libcnotify.h"
 #include "libfwps_libuna.h"
 #include "libfwps_record.h"
+#include "libfwps_trace.h"
 #include "libfwps_types.h"
 
 /* Creates a record
@@ -81,8 +87,9 @@ int libfwps_record_initialize(
 
 		return( -1 );
 	}
-	internal_record = memory_allocate_structure(
-	                   libfwps_internal_record_t );
+	internal_record = libfwps_allocator_allocate_structure(
+	                   libfwps_internal_record_t,
+	                   LIBFWPS_ALLOCATION_TYPE_RECORD );
 
 	if( internal_record == NULL )
 	{
@@ -118,7 +125,7 @@ int libfwps_record_initialize(
 on_error:
 	if( internal_record != NULL )
 	{
-		memory_free(
+		libfwps_allocator_free(
 		 internal_record );
 	}
 	return( -1 );
@@ -175,20 +182,20 @@ int libfwps_internal_record_free(
 	{
 		if( ( *internal_record )->entry_name != NULL )
 		{
-			memory_free(
+			libfwps_allocator_free(
 			 ( *internal_record )->entry_name );
 		}
 		if( ( *internal_record )->value_name != NULL )
 		{
-			memory_free(
+			libfwps_allocator_free(
 			 ( *internal_record )->value_name );
 		}
 		if( ( *internal_record )->value_data != NULL )
 		{
-			memory_free(
+			libfwps_allocator_free(
 			 ( *internal_record )->value_data );
 		}
-		memory_free(
+		libfwps_allocator_free(
 		 *internal_record );
 
 		*internal_record = NULL;
@@ -196,804 +203,3527 @@ int libfwps_internal_record_free(
 	return( 1 );
 }
 
-/* Copies a record from a byte stream
+/* Clears a record so that it can be reused to read another record
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_copy_from_byte_stream(
-     libfwps_record_t *record,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int ascii_codepage,
+int libfwps_internal_record_clear(
+     libfwps_internal_record_t *internal_record,
+     uint8_t record_type,
      libcerror_error_t **error )
 {
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_copy_from_byte_stream";
-	size_t byte_stream_offset                  = 0;
-	uint32_t name_size                         = 0;
-	uint32_t number_of_values                  = 0;
-	uint32_t value_index                       = 0;
-	uint32_t vector_value_data_size            = 0;
-	uint16_t value_16bit                       = 0;
-	int has_variable_data_size                 = 0;
+	static char *function = "libfwps_internal_record_clear";
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	system_character_t *value_string           = NULL;
-#endif
-
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid internal record.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( internal_record->entry_name != NULL )
+	if( ( record_type != LIBFWPS_RECORD_TYPE_NAMED )
+	 && ( record_type != LIBFWPS_RECORD_TYPE_NUMERIC ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record - entry name already set.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record type.",
 		 function );
 
 		return( -1 );
 	}
+	if( internal_record->entry_name != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->entry_name );
+	}
 	if( internal_record->value_name != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->value_name );
+	}
+	if( internal_record->value_data != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->value_data );
+	}
+	if( memory_set(
+	     internal_record,
+	     0,
+	     sizeof( libfwps_internal_record_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record - value name already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->value_data != NULL )
+	internal_record->type = record_type;
+
+	return( 1 );
+}
+
+/* Compares the key of a record with an entry type or entry name
+ * The entry type is compared for numeric records and the entry name,
+ * as an UTF-16 little-endian stream, for named records
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwps_internal_record_compare_with_key(
+     libfwps_internal_record_t *internal_record,
+     uint32_t entry_type,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_record_compare_with_key";
+	size_t compare_size   = 0;
+	int result            = 0;
+
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record - value data already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( byte_stream == NULL )
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		if( internal_record->entry_type < entry_type )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( internal_record->entry_type > entry_type )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+		return( LIBCDATA_COMPARE_EQUAL );
+	}
+	if( ( entry_name == NULL )
+	 && ( entry_name_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 "%s: invalid entry name.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( byte_stream_size < 13 )
-	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	if( internal_record->entry_name_size < entry_name_size )
+	{
+		compare_size = internal_record->entry_name_size;
+	}
+	else
+	{
+		compare_size = entry_name_size;
+	}
+	if( compare_size > 0 )
+	{
+		result = memory_compare(
+		          internal_record->entry_name,
+		          entry_name,
+		          compare_size );
+
+		if( result < 0 )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	if( internal_record->entry_name_size < entry_name_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( internal_record->entry_name_size > entry_name_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Compares the keys of two records
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwps_internal_record_compare_by_key(
+     libfwps_internal_record_t *first_internal_record,
+     libfwps_internal_record_t *second_internal_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_record_compare_by_key";
+	int result            = 0;
+
+	if( second_internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid byte stream size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second record.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 byte_stream,
-	 internal_record->size );
+	result = libfwps_internal_record_compare_with_key(
+	          first_internal_record,
+	          second_internal_record->entry_type,
+	          second_internal_record->entry_name,
+	          (size_t) second_internal_record->entry_name_size,
+	          error );
 
-	if( ( internal_record->size < 13 )
-	 || ( (size_t) internal_record->size > byte_stream_size ) )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid record - size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare first record with key of second record.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( result );
+}
+
+/* Determines if the record contains a vector of values with a variable size
+ * Returns 1 if the record contains a vector of values with a variable size or 0 if not
+ */
+int libfwps_internal_record_has_variable_size_vector_values(
+     libfwps_internal_record_t *internal_record )
+{
+	if( internal_record == NULL )
 	{
-		libcnotify_printf(
-		 "%s: record data:\n",
+		return( 0 );
+	}
+	if( ( internal_record->value_type & 0x0000f000UL ) != 0x00001000UL )
+	{
+		return( 0 );
+	}
+	switch( internal_record->value_type & 0x00000fffUL )
+	{
+		case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+		case LIBFWPS_VALUE_TYPE_STREAM:
+		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+			return( 1 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Retrieves the range of the vector value at a specific offset in the value data
+ * The data offset is advanced to the next vector value. The vector value
+ * data size that precedes the vector value data and the alignment padding
+ * that follows it are not part of the range
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_record_get_vector_value_range(
+     libfwps_internal_record_t *internal_record,
+     size_t *data_offset,
+     size_t *vector_value_data_offset,
+     size_t *vector_value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 4 ];
+
+	static char *function   = "libfwps_internal_record_get_vector_value_range";
+	size_t safe_data_offset = 0;
+	size_t value_size       = 0;
+	ssize_t read_count      = 0;
+	uint32_t value_32bit    = 0;
+	uint16_t value_16bit    = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
-		libcnotify_print_data(
-		 byte_stream,
-		 internal_record->size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		return( -1 );
 	}
-#endif
-	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	if( data_offset == NULL )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ byte_stream_offset + 4 ] ),
-		 name_size );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
 	}
-	else if( internal_record->type == LIBFWPS_RECORD_TYPE_NUMERIC )
+	if( vector_value_data_offset == NULL )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ byte_stream_offset + 4 ] ),
-		 internal_record->entry_type );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector value data offset.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( vector_value_data_size == NULL )
 	{
-		libcnotify_printf(
-		 "%s: size\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 internal_record->size );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector value data size.",
+		 function );
 
-		if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
-		{
-			libcnotify_printf(
-			 "%s: name size\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 name_size );
-		}
-		else
-		{
-			libcnotify_printf(
-			 "%s: entry type\t\t\t: %" PRIu32 "\n",
-			 function,
-			 internal_record->entry_type );
-		}
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t: 0x%02" PRIx8 "\n",
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( internal_record->value_data_size < 4 )
+	 || ( safe_data_offset > ( internal_record->value_data_size - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libfwps_record_read_data(
+	              (libfwps_record_t *) internal_record,
+	              safe_data_offset,
+	              buffer,
+	              4,
+	              error );
+
+	if( read_count != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read vector value data size at offset: %" PRIzu ".",
 		 function,
-		 byte_stream[ byte_stream_offset + 8 ] );
+		 safe_data_offset );
+
+		return( -1 );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	byte_stream_copy_to_uint32_little_endian(
+	 buffer,
+	 value_32bit );
 
-	byte_stream_offset += 9;
+	safe_data_offset += 4;
 
-	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	value_size = (size_t) value_32bit;
+
+	if( ( internal_record->value_type & 0x00000fffUL ) == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
 	{
-		if( ( name_size > byte_stream_size )
-		 || ( byte_stream_offset > ( byte_stream_size - name_size ) ) )
+		if( value_size > ( ( internal_record->value_data_size - safe_data_offset ) / 2 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid name size value out of bounds.",
+			 "%s: invalid vector value data size value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_record->entry_name = (uint8_t *) memory_allocate(
-		                                           sizeof( uint8_t ) * name_size );
+		value_size *= 2;
+	}
+	if( value_size > ( internal_record->value_data_size - safe_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid vector value data size value out of bounds.",
+		 function );
 
-		if( internal_record->entry_name == NULL )
+		return( -1 );
+	}
+	*vector_value_data_offset = safe_data_offset;
+	*vector_value_data_size   = value_size;
+
+	safe_data_offset += value_size;
+
+	/* The alignment padding is detected the same way as when the record is read
+	 */
+	if( ( internal_record->value_data_size >= 2 )
+	 && ( safe_data_offset <= ( internal_record->value_data_size - 2 ) ) )
+	{
+		read_count = libfwps_record_read_data(
+		              (libfwps_record_t *) internal_record,
+		              safe_data_offset,
+		              buffer,
+		              2,
+		              error );
+
+		if( read_count != 2 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create entry name.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read alignment padding at offset: %" PRIzu ".",
+			 function,
+			 safe_data_offset );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( memory_copy(
-		     internal_record->entry_name,
-		     &( byte_stream[ byte_stream_offset ] ),
-		     name_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy entry name data.",
-			 function );
+		byte_stream_copy_to_uint16_little_endian(
+		 buffer,
+		 value_16bit );
 
-			goto on_error;
+		if( value_16bit == 0 )
+		{
+			safe_data_offset += 2;
 		}
-		internal_record->entry_name_size = name_size;
+	}
+	*data_offset = safe_data_offset;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfwps_debug_print_utf16_string_value(
-			     function,
-			     "entry name\t\t\t",
-			     internal_record->entry_name,
-			     internal_record->entry_name_size,
-			     LIBUNA_ENDIAN_LITTLE,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print UTF-16 string value.",
-				 function );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+/* Updates a hash context with the content of a record
+ * The content consists of the key, value type, number of values, value name
+ * and value data, the value data size stored in the byte stream is not included
+ * The values of a vector with a variable size are included one by one without
+ * the vector value data sizes and alignment padding stored in the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_record_update_hash_context(
+     libfwps_internal_record_t *internal_record,
+     libfwps_hash_context_t *hash_context,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 512 ];
 
-		byte_stream_offset += name_size;
-	}
-	if( byte_stream_offset > ( byte_stream_size - 4 ) )
+	const uint8_t *value_data       = NULL;
+	static char *function           = "libfwps_internal_record_update_hash_context";
+	size_t data_offset              = 0;
+	size_t read_size                = 0;
+	size_t vector_value_data_offset = 0;
+	size_t vector_value_data_size   = 0;
+	ssize_t read_count              = 0;
+	uint32_t value_index            = 0;
+
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid byte stream size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 &( byte_stream[ byte_stream_offset ] ),
-	 internal_record->value_type );
-
-	byte_stream_offset += 4;
+	byte_stream_copy_from_uint32_little_endian(
+	 buffer,
+	 (uint32_t) internal_record->type );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
 	{
-		libcnotify_printf(
-		 "%s: value type\t\t\t: 0x%04" PRIx32 "\n",
-		 function,
-		 internal_record->value_type );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 internal_record->entry_name_size );
 	}
-#endif
-	/* TODO add support for VT_ARRAY and VT_BYREF
-	 */
-	switch( internal_record->value_type & 0xffffefffUL )
+	else
 	{
-		case LIBFWPS_VALUE_TYPE_NULL:
-			internal_record->value_data_size = 0;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_BOOLEAN:
-		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
-			internal_record->value_data_size = 1;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
-			internal_record->value_data_size = 2;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_ERROR:
-		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
-		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
-			internal_record->value_data_size = 4;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_APPLICATION_TIME:
-		case LIBFWPS_VALUE_TYPE_CURRENCY:
-		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
-		case LIBFWPS_VALUE_TYPE_FILETIME:
-		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
-		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
-			internal_record->value_data_size = 8;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_FIXED_POINT_128BIT:
-		case LIBFWPS_VALUE_TYPE_GUID:
-			internal_record->value_data_size = 16;
-			break;
-
-		case LIBFWPS_VALUE_TYPE_BINARY_DATA:
-		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
-		case LIBFWPS_VALUE_TYPE_STREAM:
-		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
-		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
-			has_variable_data_size = 1;
-			break;
-
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-			 function,
-			 internal_record->value_type );
-
-			goto on_error;
+		byte_stream_copy_from_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 internal_record->entry_type );
 	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STREAM )
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     buffer,
+	     8,
+	     error ) != 1 )
 	{
-		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		goto on_error;
+	}
+	if( ( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	 && ( internal_record->entry_name_size > 0 ) )
+	{
+		if( libfwps_hash_context_update(
+		     hash_context,
+		     internal_record->entry_name,
+		     (size_t) internal_record->entry_name_size,
+		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid byte stream size value too small.",
-			 function );
-
 			goto on_error;
 		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ byte_stream_offset ] ),
-		 name_size );
-
-		byte_stream_offset += 4;
-
-		if( ( name_size > byte_stream_size )
-		 || ( byte_stream_offset > ( byte_stream_size - name_size ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid name size value out of bounds.",
-			 function );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 buffer,
+	 internal_record->value_type );
 
-			goto on_error;
-		}
-		internal_record->value_name = (uint8_t *) memory_allocate(
-		                                           sizeof( uint8_t ) * name_size );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer[ 4 ] ),
+	 internal_record->number_of_values );
 
-		if( internal_record->value_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value name.",
-			 function );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer[ 8 ] ),
+	 internal_record->value_name_size );
 
-			goto on_error;
-		}
-		if( memory_copy(
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     buffer,
+	     12,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( internal_record->value_name_size > 0 )
+	{
+		if( libfwps_hash_context_update(
+		     hash_context,
 		     internal_record->value_name,
-		     &( byte_stream[ byte_stream_offset ] ),
-		     name_size ) == NULL )
+		     (size_t) internal_record->value_name_size,
+		     error ) != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy value name data.",
-			 function );
-
 			goto on_error;
 		}
-		internal_record->value_name_size = name_size;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	}
+	if( libfwps_internal_record_has_variable_size_vector_values(
+	     internal_record ) != 0 )
+	{
+		for( value_index = 0;
+		     value_index < internal_record->number_of_values;
+		     value_index++ )
 		{
-			if( libfwps_debug_print_utf16_string_value(
-			     function,
-			     "value name\t\t\t",
-			     internal_record->value_name,
-			     internal_record->value_name_size,
-			     LIBUNA_ENDIAN_LITTLE,
+			if( libfwps_internal_record_get_vector_value_range(
+			     internal_record,
+			     &data_offset,
+			     &vector_value_data_offset,
+			     &vector_value_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print UTF-16 string value.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve vector value: %" PRIu32 " range.",
+				 function,
+				 value_index );
 
+				return( -1 );
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 buffer,
+			 (uint64_t) vector_value_data_size );
+
+			if( libfwps_hash_context_update(
+			     hash_context,
+			     buffer,
+			     8,
+			     error ) != 1 )
+			{
 				goto on_error;
 			}
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		byte_stream_offset += name_size;
+			while( vector_value_data_size > 0 )
+			{
+				read_size = vector_value_data_size;
 
-		if( byte_stream_offset > ( byte_stream_size - 2 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid byte stream size value too small.",
-			 function );
+				if( read_size > 512 )
+				{
+					read_size = 512;
+				}
+				read_count = libfwps_record_read_data(
+				              (libfwps_record_t *) internal_record,
+				              vector_value_data_offset,
+				              buffer,
+				              read_size,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read value data at offset: %" PRIzu ".",
+					 function,
+					 vector_value_data_offset );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			byte_stream_copy_to_uint16_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 value_16bit );
-			libcnotify_printf(
-			 "%s: unknown1\t\t\t\t: 0x%04" PRIx16 "\n",
-			 function,
-			 value_16bit );
+					return( -1 );
+				}
+				if( libfwps_hash_context_update(
+				     hash_context,
+				     buffer,
+				     read_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				vector_value_data_offset += read_size;
+				vector_value_data_size   -= read_size;
+			}
 		}
-#endif
-		byte_stream_offset += 2;
+		return( 1 );
 	}
-	if( ( internal_record->value_type & 0x0000f000UL ) == 0x00001000UL )
+	byte_stream_copy_from_uint64_little_endian(
+	 buffer,
+	 (uint64_t) internal_record->value_data_size );
+
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     buffer,
+	     8,
+	     error ) != 1 )
 	{
-		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		goto on_error;
+	}
+	if( internal_record->value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_record->has_deferred_value_data != 0 )
+	 && ( internal_record->file_io_handle != NULL ) )
+	{
+		while( data_offset < internal_record->value_data_size )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid byte stream size value too small.",
-			 function );
-
-			goto on_error;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ byte_stream_offset ] ),
-		 number_of_values );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( has_variable_data_size == 0 )
+			read_count = libfwps_record_read_data(
+			              (libfwps_record_t *) internal_record,
+			              data_offset,
+			              buffer,
+			              512,
+			              error );
+
+			if( read_count <= 0 )
 			{
-				libcnotify_printf(
-				 "%s: value data size\t\t\t: %" PRIu32 "\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value data at offset: %" PRIzu ".",
 				 function,
-				 internal_record->value_data_size );
+				 data_offset );
+
+				return( -1 );
 			}
-			libcnotify_printf(
-			 "%s: number of values\t\t\t: %" PRIu32 "\n",
-			 function,
-			 number_of_values );
+			if( libfwps_hash_context_update(
+			     hash_context,
+			     buffer,
+			     (size_t) read_count,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			data_offset += (size_t) read_count;
 		}
-#endif
-		byte_stream_offset += 4;
+		return( 1 );
+	}
+	if( internal_record->has_deferred_value_data != 0 )
+	{
+		value_data = internal_record->value_data_reference;
+	}
+	else
+	{
+		value_data = internal_record->value_data;
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing value data.",
+		 function );
 
-		if( has_variable_data_size == 0 )
+		return( -1 );
+	}
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     value_data,
+	     internal_record->value_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+	 "%s: unable to update hash context.",
+	 function );
+
+	return( -1 );
+}
+
+/* Compares the values of two records
+ * The value type, number of values, value name and value data are compared
+ * The values of a vector with a variable size are compared one by one without
+ * the vector value data sizes and alignment padding stored in the byte stream
+ * Returns 1 if the values are equal, 0 if not or -1 on error
+ */
+int libfwps_internal_record_compare_value(
+     libfwps_internal_record_t *first_internal_record,
+     libfwps_internal_record_t *second_internal_record,
+     libcerror_error_t **error )
+{
+	uint8_t first_buffer[ 512 ];
+	uint8_t second_buffer[ 512 ];
+
+	const uint8_t *first_value_data        = NULL;
+	const uint8_t *second_value_data       = NULL;
+	static char *function                  = "libfwps_internal_record_compare_value";
+	size_t data_offset                     = 0;
+	size_t first_vector_value_data_offset  = 0;
+	size_t first_vector_value_data_size    = 0;
+	size_t read_size                       = 0;
+	size_t second_data_offset              = 0;
+	size_t second_vector_value_data_offset = 0;
+	size_t second_vector_value_data_size   = 0;
+	ssize_t read_count                     = 0;
+	uint32_t value_index                   = 0;
+
+	if( first_internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first record.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_internal_record->value_type != second_internal_record->value_type )
+	 || ( first_internal_record->number_of_values != second_internal_record->number_of_values )
+	 || ( first_internal_record->value_name_size != second_internal_record->value_name_size ) )
+	{
+		return( 0 );
+	}
+	if( first_internal_record->value_name_size > 0 )
+	{
+		if( memory_compare(
+		     first_internal_record->value_name,
+		     second_internal_record->value_name,
+		     (size_t) first_internal_record->value_name_size ) != 0 )
 		{
-			if( ( internal_record->value_data_size > 0 )
-			 && ( number_of_values > ( (size_t) SSIZE_MAX / internal_record->value_data_size ) ) )
+			return( 0 );
+		}
+	}
+	if( libfwps_internal_record_has_variable_size_vector_values(
+	     first_internal_record ) != 0 )
+	{
+		for( value_index = 0;
+		     value_index < first_internal_record->number_of_values;
+		     value_index++ )
+		{
+			if( libfwps_internal_record_get_vector_value_range(
+			     first_internal_record,
+			     &data_offset,
+			     &first_vector_value_data_offset,
+			     &first_vector_value_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid number of values value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: vector values data:\n",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first vector value: %" PRIu32 " range.",
 				 function,
 				 value_index );
-				libcnotify_print_data(
-				 &( byte_stream[ byte_stream_offset ] ),
-				 internal_record->value_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
-#endif
-			internal_record->value_data_size *= number_of_values;
 
-			byte_stream_offset += internal_record->value_data_size;
-		}
-		else
-		{
-			if( ( number_of_values > ( ( byte_stream_size - byte_stream_offset ) / 4 ) )
-			 || ( number_of_values == 0xffffffffUL ) )
+				return( -1 );
+			}
+			if( libfwps_internal_record_get_vector_value_range(
+			     second_internal_record,
+			     &second_data_offset,
+			     &second_vector_value_data_offset,
+			     &second_vector_value_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid number of values value out of bounds.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve second vector value: %" PRIu32 " range.",
+				 function,
+				 value_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			for( value_index = 0;
-			     value_index < number_of_values;
-			     value_index++ )
+			if( first_vector_value_data_size != second_vector_value_data_size )
 			{
-				if( byte_stream_offset > ( byte_stream_size - 4 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: invalid byte stream size value too small.",
-					 function );
-
-					goto on_error;
-				}
-				byte_stream_copy_to_uint32_little_endian(
-				 &( byte_stream[ byte_stream_offset ] ),
-				 vector_value_data_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: vector value: %" PRIu32 " data size\t\t: %" PRIu32 "\n",
-					 function,
-					 value_index,
-					 vector_value_data_size );
-				}
-#endif
-				byte_stream_offset += 4;
+				return( 0 );
+			}
+			while( first_vector_value_data_size > 0 )
+			{
+				read_size = first_vector_value_data_size;
 
-				if( ( internal_record->value_type & 0x00000fffUL ) == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
+				if( read_size > 512 )
 				{
-					if( vector_value_data_size > ( (uint32_t) UINT32_MAX / 2 ) )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid vector value: %" PRIu32 " data size value out of bounds.",
-						 function,
-						 value_index );
-
-						goto on_error;
-					}
-					vector_value_data_size *= 2;
+					read_size = 512;
 				}
-				if( vector_value_data_size > ( (size_t) SSIZE_MAX - internal_record->value_data_size ) )
+				read_count = libfwps_record_read_data(
+				              (libfwps_record_t *) first_internal_record,
+				              first_vector_value_data_offset,
+				              first_buffer,
+				              read_size,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid vector value: %" PRIu32 " data size value out of bounds.",
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read first value data at offset: %" PRIzu ".",
 					 function,
-					 value_index );
+					 first_vector_value_data_offset );
 
-					goto on_error;
+					return( -1 );
 				}
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
+				read_count = libfwps_record_read_data(
+				              (libfwps_record_t *) second_internal_record,
+				              second_vector_value_data_offset,
+				              second_buffer,
+				              read_size,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
 				{
-					libcnotify_printf(
-					 "%s: vector value: %" PRIu32 " data:\n",
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read second value data at offset: %" PRIzu ".",
 					 function,
-					 value_index );
-					libcnotify_print_data(
-					 &( byte_stream[ byte_stream_offset ] ),
-					 vector_value_data_size,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
-#endif
-				byte_stream_offset += vector_value_data_size;
-
-				internal_record->value_data_size += 4 + vector_value_data_size;
+					 second_vector_value_data_offset );
 
-				if( byte_stream_offset <= ( byte_stream_size - 2 ) )
+					return( -1 );
+				}
+				if( memory_compare(
+				     first_buffer,
+				     second_buffer,
+				     read_size ) != 0 )
 				{
-					byte_stream_copy_to_uint16_little_endian(
-					 &( byte_stream[ byte_stream_offset ] ),
-					 value_16bit );
-
-					if( value_16bit == 0 )
-					{
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: alignment padding data:\n",
-							 function );
-							libcnotify_print_data(
-							 &( byte_stream[ byte_stream_offset ] ),
-							 2,
-							 0 );
-						}
-#endif
-						byte_stream_offset += 2;
-
-						internal_record->value_data_size += 2;
-					}
+					return( 0 );
 				}
+				first_vector_value_data_offset  += read_size;
+				first_vector_value_data_size    -= read_size;
+				second_vector_value_data_offset += read_size;
 			}
 		}
+		return( 1 );
 	}
-	else
+	if( first_internal_record->value_data_size != second_internal_record->value_data_size )
 	{
-		if( has_variable_data_size != 0 )
+		return( 0 );
+	}
+	if( first_internal_record->value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Value data that is deferred to a file IO handle is compared in blocks
+	 */
+	if( ( ( first_internal_record->has_deferred_value_data != 0 )
+	  &&  ( first_internal_record->file_io_handle != NULL ) )
+	 || ( ( second_internal_record->has_deferred_value_data != 0 )
+	  &&  ( second_internal_record->file_io_handle != NULL ) ) )
+	{
+		while( data_offset < first_internal_record->value_data_size )
 		{
-			if( byte_stream_offset > ( byte_stream_size - 4 ) )
+			read_size = first_internal_record->value_data_size - data_offset;
+
+			if( read_size > 512 )
+			{
+				read_size = 512;
+			}
+			read_count = libfwps_record_read_data(
+			              (libfwps_record_t *) first_internal_record,
+			              data_offset,
+			              first_buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid byte stream size value too small.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read first value data at offset: %" PRIzu ".",
+				 function,
+				 data_offset );
 
-				goto on_error;
+				return( -1 );
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 internal_record->value_data_size );
-
-			byte_stream_offset += 4;
-
-			if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
+			read_count = libfwps_record_read_data(
+			              (libfwps_record_t *) second_internal_record,
+			              data_offset,
+			              second_buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
 			{
-				if( internal_record->value_data_size > ( (size_t) SSIZE_MAX / 2 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid value data size value out of bounds.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read second value data at offset: %" PRIzu ".",
+				 function,
+				 data_offset );
 
-					goto on_error;
-				}
-				internal_record->value_data_size *= 2;
+				return( -1 );
 			}
+			if( memory_compare(
+			     first_buffer,
+			     second_buffer,
+			     read_size ) != 0 )
+			{
+				return( 0 );
+			}
+			data_offset += read_size;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: value data size\t\t\t: %" PRIu32 "\n",
-			 function,
-			 internal_record->value_data_size );
-		}
-#endif
-		if( internal_record->value_data_size > 0 )
-		{
-			if( ( internal_record->value_data_size > byte_stream_size )
-			 || ( byte_stream_offset > ( byte_stream_size - internal_record->value_data_size ) ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid value data size value out of bounds.",
-				 function );
+		return( 1 );
+	}
+	if( first_internal_record->has_deferred_value_data != 0 )
+	{
+		first_value_data = first_internal_record->value_data_reference;
+	}
+	else
+	{
+		first_value_data = first_internal_record->value_data;
+	}
+	if( second_internal_record->has_deferred_value_data != 0 )
+	{
+		second_value_data = second_internal_record->value_data_reference;
+	}
+	else
+	{
+		second_value_data = second_internal_record->value_data;
+	}
+	if( ( first_value_data == NULL )
+	 || ( second_value_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     first_value_data,
+	     second_value_data,
+	     first_internal_record->value_data_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Copies a record from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_copy_from_byte_stream(
+     libfwps_record_t *record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_copy_from_byte_stream";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record - record is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_record->parse_error_offset = 0;
+
+	if( internal_record->entry_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record - entry name already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->value_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record - value name already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->value_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record - value data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 13 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		return( -1 );
+	}
+	if( libfwps_internal_record_read_byte_stream(
+	     internal_record,
+	     byte_stream,
+	     byte_stream_size,
+	     0,
+	     0,
+	     NULL,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the parse error of the last copy from byte stream
+ * The error code and offset are set even if no error argument was provided
+ * when parsing, hence failed parses do not require any error allocations
+ * The error offset is relative to the start of the byte stream
+ * Returns 1 if successful, 0 if no parse error is available or -1 on error
+ */
+int libfwps_record_get_parse_error(
+     libfwps_record_t *record,
+     int *error_code,
+     size_t *error_offset,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_parse_error";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->parse_error_code == LIBFWPS_PARSE_ERROR_NONE )
+	{
+		return( 0 );
+	}
+	*error_code   = internal_record->parse_error_code;
+	*error_offset = internal_record->parse_error_offset;
+
+	return( 1 );
+}
+
+/* Reads a record from a byte stream
+ * If LIBFWPS_READ_FLAG_DEFER_VALUE_DATA is set the byte stream can contain
+ * only the first part of the record, in which case the binary data and stream
+ * value data is not copied but read on demand
+ * Binary data and stream value data larger than a non-zero value data threshold
+ * is not copied but referenced, hence the byte stream must remain available
+ * If parse limits are provided the number of vector values is checked and
+ * the size of the names and value data is reserved before it is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_record_read_byte_stream(
+     libfwps_internal_record_t *internal_record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t read_flags,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfwps_internal_record_read_byte_stream";
+	size_t byte_stream_offset        = 0;
+	uint32_t name_size               = 0;
+	uint32_t number_of_values        = 0;
+	uint32_t value_index             = 0;
+	uint32_t vector_value_data_size  = 0;
+	uint16_t value_16bit             = 0;
+	int defer_value_data             = 0;
+	int has_variable_data_size       = 0;
+	int parse_error_code             = LIBFWPS_PARSE_ERROR_GENERIC;
 
-				goto on_error;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: value data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( byte_stream[ byte_stream_offset ] ),
-				 internal_record->value_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
+	system_character_t *value_string = NULL;
+	size_t print_data_size           = 0;
 #endif
-			if( internal_record->value_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid value data size value exceeds maximum.",
-				 function );
 
-				goto on_error;
-			}
-			internal_record->value_data = (uint8_t *) memory_allocate(
-			                                           sizeof( uint8_t ) * internal_record->value_data_size );
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
 
-			if( internal_record->value_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value data.",
-				 function );
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
 
-				goto on_error;
-			}
-			if( memory_copy(
-			     internal_record->value_data,
-			     &( byte_stream[ byte_stream_offset ] ),
-			     internal_record->value_data_size ) == NULL )
+		return( -1 );
+	}
+	internal_record->parse_error_code   = LIBFWPS_PARSE_ERROR_NONE;
+	internal_record->parse_error_offset = 0;
+	internal_record->anomaly_flags      = 0;
+
+	if( ( byte_stream_size < 13 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		return( -1 );
+	}
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_RECORD,
+	 NULL,
+	 0,
+	 byte_stream_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 byte_stream,
+	 internal_record->size );
+
+	if( ( internal_record->size < 13 )
+	 || ( ( ( read_flags & LIBFWPS_READ_FLAG_DEFER_VALUE_DATA ) == 0 )
+	  &&  ( (size_t) internal_record->size > byte_stream_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - size value out of bounds.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		print_data_size = internal_record->size;
+
+		if( print_data_size > byte_stream_size )
+		{
+			print_data_size = byte_stream_size;
+		}
+		libcnotify_printf(
+		 "%s: record data:\n",
+		 function );
+		libcnotify_print_data(
+		 byte_stream,
+		 print_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset + 4 ] ),
+		 name_size );
+	}
+	else if( internal_record->type == LIBFWPS_RECORD_TYPE_NUMERIC )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset + 4 ] ),
+		 internal_record->entry_type );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 internal_record->size );
+
+		if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+		{
+			libcnotify_printf(
+			 "%s: name size\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 name_size );
+		}
+		else
+		{
+			libcnotify_printf(
+			 "%s: entry type\t\t\t: %" PRIu32 "\n",
+			 function,
+			 internal_record->entry_type );
+		}
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 byte_stream[ byte_stream_offset + 8 ] );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( byte_stream[ byte_stream_offset + 8 ] != 0 )
+	{
+		internal_record->anomaly_flags |= LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG_RESERVED_VALUE;
+	}
+	byte_stream_offset += 9;
+
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		if( ( name_size > byte_stream_size )
+		 || ( byte_stream_offset > ( byte_stream_size - name_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name size value out of bounds.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( parse_limits != NULL )
+		 && ( libfwps_parse_limits_reserve_size(
+		       parse_limits,
+		       (size64_t) name_size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid name size value exceeds maximum total size.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		internal_record->entry_name = (uint8_t *) libfwps_allocator_allocate(
+		                                           sizeof( uint8_t ) * name_size,
+		                                           LIBFWPS_ALLOCATION_TYPE_NAME );
+
+		if( internal_record->entry_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry name.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_record->entry_name,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name data.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+			goto on_error;
+		}
+		internal_record->entry_name_size = name_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfwps_debug_print_utf16_string_value(
+			     function,
+			     "entry name\t\t\t",
+			     internal_record->entry_name,
+			     internal_record->entry_name_size,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy value data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print UTF-16 string value.",
 				 function );
 
-				goto on_error;
-			}
-			byte_stream_offset += internal_record->value_data_size;
-		}
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		byte_stream_offset += name_size;
+	}
+	if( byte_stream_offset > ( byte_stream_size - 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 internal_record->value_type );
+
+	byte_stream_offset += 4;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: value type\t\t\t: 0x%04" PRIx32 "\n",
+		 function,
+		 internal_record->value_type );
+	}
+#endif
+	/* TODO add support for VT_ARRAY and VT_BYREF
+	 */
+	switch( internal_record->value_type & 0xffffefffUL )
+	{
+		case LIBFWPS_VALUE_TYPE_NULL:
+			internal_record->value_data_size = 0;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BOOLEAN:
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
+			internal_record->value_data_size = 1;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			internal_record->value_data_size = 2;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_ERROR:
+		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
+			internal_record->value_data_size = 4;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_APPLICATION_TIME:
+		case LIBFWPS_VALUE_TYPE_CURRENCY:
+		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBFWPS_VALUE_TYPE_FILETIME:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+			internal_record->value_data_size = 8;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FIXED_POINT_128BIT:
+		case LIBFWPS_VALUE_TYPE_GUID:
+			internal_record->value_data_size = 16;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+		case LIBFWPS_VALUE_TYPE_STREAM:
+		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+			has_variable_data_size = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+			 function,
+			 internal_record->value_type );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE;
+
+			goto on_error;
+	}
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STREAM )
+	{
+		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 name_size );
+
+		byte_stream_offset += 4;
+
+		if( ( name_size > byte_stream_size )
+		 || ( byte_stream_offset > ( byte_stream_size - name_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name size value out of bounds.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( parse_limits != NULL )
+		 && ( libfwps_parse_limits_reserve_size(
+		       parse_limits,
+		       (size64_t) name_size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid name size value exceeds maximum total size.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		internal_record->value_name = (uint8_t *) libfwps_allocator_allocate(
+		                                           sizeof( uint8_t ) * name_size,
+		                                           LIBFWPS_ALLOCATION_TYPE_NAME );
+
+		if( internal_record->value_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value name.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_record->value_name,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value name data.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+			goto on_error;
+		}
+		internal_record->value_name_size = name_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfwps_debug_print_utf16_string_value(
+			     function,
+			     "value name\t\t\t",
+			     internal_record->value_name,
+			     internal_record->value_name_size,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print UTF-16 string value.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		byte_stream_offset += name_size;
+
+		if( byte_stream_offset > ( byte_stream_size - 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 value_16bit );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unknown1\t\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 value_16bit );
+		}
+#endif
+		if( value_16bit != 0 )
+		{
+			internal_record->anomaly_flags |= LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG_RESERVED_VALUE;
+		}
+		byte_stream_offset += 2;
+	}
+	if( ( internal_record->value_type & 0x0000f000UL ) == 0x00001000UL )
+	{
+		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 number_of_values );
+
+		internal_record->number_of_values = number_of_values;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( has_variable_data_size == 0 )
+			{
+				libcnotify_printf(
+				 "%s: value data size\t\t\t: %" PRIu32 "\n",
+				 function,
+				 internal_record->value_data_size );
+			}
+			libcnotify_printf(
+			 "%s: number of values\t\t\t: %" PRIu32 "\n",
+			 function,
+			 number_of_values );
+		}
+#endif
+		if( ( parse_limits != NULL )
+		 && ( parse_limits->maximum_number_of_vector_values > 0 )
+		 && ( number_of_values > parse_limits->maximum_number_of_vector_values ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of values value exceeds maximum.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		byte_stream_offset += 4;
+
+		internal_record->value_data_offset = (off64_t) byte_stream_offset;
+
+		if( has_variable_data_size == 0 )
+		{
+			if( ( internal_record->value_data_size > 0 )
+			 && ( number_of_values > ( (size_t) SSIZE_MAX / internal_record->value_data_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of values value out of bounds.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: vector values data:\n",
+				 function,
+				 value_index );
+				libcnotify_print_data(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 internal_record->value_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+#endif
+			internal_record->value_data_size *= number_of_values;
+
+			byte_stream_offset += internal_record->value_data_size;
+		}
+		else
+		{
+			if( ( number_of_values > ( ( byte_stream_size - byte_stream_offset ) / 4 ) )
+			 || ( number_of_values == 0xffffffffUL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid number of values value out of bounds.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+			for( value_index = 0;
+			     value_index < number_of_values;
+			     value_index++ )
+			{
+				if( byte_stream_offset > ( byte_stream_size - 4 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid byte stream size value too small.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+					goto on_error;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 vector_value_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: vector value: %" PRIu32 " data size\t\t: %" PRIu32 "\n",
+					 function,
+					 value_index,
+					 vector_value_data_size );
+				}
+#endif
+				byte_stream_offset += 4;
+
+				if( ( internal_record->value_type & 0x00000fffUL ) == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
+				{
+					if( vector_value_data_size > ( (uint32_t) UINT32_MAX / 2 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid vector value: %" PRIu32 " data size value out of bounds.",
+						 function,
+						 value_index );
+
+						parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+						goto on_error;
+					}
+					vector_value_data_size *= 2;
+				}
+				if( vector_value_data_size > ( (size_t) SSIZE_MAX - internal_record->value_data_size ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid vector value: %" PRIu32 " data size value out of bounds.",
+					 function,
+					 value_index );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: vector value: %" PRIu32 " data:\n",
+					 function,
+					 value_index );
+					libcnotify_print_data(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 vector_value_data_size,
+					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				}
+#endif
+				byte_stream_offset += vector_value_data_size;
+
+				internal_record->value_data_size += 4 + vector_value_data_size;
+
+				if( byte_stream_offset <= ( byte_stream_size - 2 ) )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( byte_stream[ byte_stream_offset ] ),
+					 value_16bit );
+
+					if( value_16bit == 0 )
+					{
+#if defined( HAVE_DEBUG_OUTPUT )
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: alignment padding data:\n",
+							 function );
+							libcnotify_print_data(
+							 &( byte_stream[ byte_stream_offset ] ),
+							 2,
+							 0 );
+						}
+#endif
+						byte_stream_offset += 2;
+
+						internal_record->value_data_size += 2;
+					}
+				}
+			}
+		}
+		if( internal_record->value_data_size > 0 )
+		{
+			if( ( internal_record->value_data_size > byte_stream_size )
+			 || ( (size_t) internal_record->value_data_offset > ( byte_stream_size - internal_record->value_data_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid vector values data size value out of bounds.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+			if( ( value_data_threshold > 0 )
+			 && ( internal_record->value_data_size > value_data_threshold ) )
+			{
+				internal_record->value_data_reference    = &( byte_stream[ internal_record->value_data_offset ] );
+				internal_record->value_data_file_offset  = internal_record->value_data_offset;
+				internal_record->has_deferred_value_data = 1;
+			}
+			else
+			{
+				if( internal_record->value_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid vector values data size value exceeds maximum.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+					goto on_error;
+				}
+				if( ( parse_limits != NULL )
+				 && ( libfwps_parse_limits_reserve_size(
+				       parse_limits,
+				       (size64_t) internal_record->value_data_size,
+				       error ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid vector values data size value exceeds maximum total size.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+					goto on_error;
+				}
+				internal_record->value_data = (uint8_t *) libfwps_allocator_allocate(
+				                                           sizeof( uint8_t ) * internal_record->value_data_size,
+				                                           LIBFWPS_ALLOCATION_TYPE_VALUE );
+
+				if( internal_record->value_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create vector values data.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     internal_record->value_data,
+				     &( byte_stream[ internal_record->value_data_offset ] ),
+				     internal_record->value_data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy vector values data.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	else
+	{
+		if( has_variable_data_size != 0 )
+		{
+			if( byte_stream_offset > ( byte_stream_size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid byte stream size value too small.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( byte_stream[ byte_stream_offset ] ),
+			 internal_record->value_data_size );
+
+			byte_stream_offset += 4;
+
+			if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
+			{
+				if( internal_record->value_data_size > ( (size_t) SSIZE_MAX / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid value data size value out of bounds.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+					goto on_error;
+				}
+				internal_record->value_data_size *= 2;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: value data size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 internal_record->value_data_size );
+		}
+#endif
+		internal_record->value_data_offset = (off64_t) byte_stream_offset;
+
+		if( ( internal_record->value_data_size > 0 )
+		 && ( ( internal_record->value_type == LIBFWPS_VALUE_TYPE_BINARY_DATA )
+		  ||  ( internal_record->value_type == LIBFWPS_VALUE_TYPE_STREAM ) ) )
+		{
+			if( ( internal_record->value_data_size > byte_stream_size )
+			 || ( byte_stream_offset > ( byte_stream_size - internal_record->value_data_size ) ) )
+			{
+				if( ( read_flags & LIBFWPS_READ_FLAG_DEFER_VALUE_DATA ) != 0 )
+				{
+					defer_value_data = 1;
+				}
+			}
+			else if( ( value_data_threshold > 0 )
+			      && ( internal_record->value_data_size > value_data_threshold ) )
+			{
+				defer_value_data = 1;
+			}
+		}
+		if( defer_value_data != 0 )
+		{
+			if( ( internal_record->value_data_size > (size_t) internal_record->size )
+			 || ( byte_stream_offset > ( (size_t) internal_record->size - internal_record->value_data_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value data size value out of bounds.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+			if( ( internal_record->value_data_size <= byte_stream_size )
+			 && ( byte_stream_offset <= ( byte_stream_size - internal_record->value_data_size ) ) )
+			{
+				internal_record->value_data_reference = &( byte_stream[ byte_stream_offset ] );
+			}
+			internal_record->value_data_file_offset  = (off64_t) byte_stream_offset;
+			internal_record->has_deferred_value_data = 1;
+
+			byte_stream_offset += internal_record->value_data_size;
+		}
+		else if( internal_record->value_data_size > 0 )
+		{
+			if( ( internal_record->value_data_size > byte_stream_size )
+			 || ( byte_stream_offset > ( byte_stream_size - internal_record->value_data_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value data size value out of bounds.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: value data:\n",
+				 function );
+				libcnotify_print_data(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 internal_record->value_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+#endif
+			if( internal_record->value_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid value data size value exceeds maximum.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+				goto on_error;
+			}
+			if( ( parse_limits != NULL )
+			 && ( libfwps_parse_limits_reserve_size(
+			       parse_limits,
+			       (size64_t) internal_record->value_data_size,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid value data size value exceeds maximum total size.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+				goto on_error;
+			}
+			internal_record->value_data = (uint8_t *) libfwps_allocator_allocate(
+			                                           sizeof( uint8_t ) * internal_record->value_data_size,
+			                                           LIBFWPS_ALLOCATION_TYPE_VALUE );
+
+			if( internal_record->value_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value data.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     internal_record->value_data,
+			     &( byte_stream[ byte_stream_offset ] ),
+			     internal_record->value_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value data.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+			byte_stream_offset += internal_record->value_data_size;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		print_data_size = internal_record->size;
+
+		if( print_data_size > byte_stream_size )
+		{
+			print_data_size = byte_stream_size;
+		}
+		if( byte_stream_offset < print_data_size )
+		{
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( byte_stream[ byte_stream_offset ] ),
+			 print_data_size - byte_stream_offset,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( byte_stream_offset < (size_t) internal_record->size )
+	{
+		internal_record->anomaly_flags |= LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG_TRAILING_DATA;
+	}
+	internal_record->ascii_codepage = ascii_codepage;
+
+	LIBFWPS_TRACE_COUNT_VALUE_TYPE(
+	 internal_record->value_type,
+	 internal_record->value_data_size );
+
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_RECORD,
+	 NULL,
+	 internal_record->value_type,
+	 byte_stream_size,
+	 1 );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+#endif
+	if( internal_record->value_data != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->value_data );
+
+		internal_record->value_data = NULL;
+	}
+	internal_record->value_data_size         = 0;
+	internal_record->number_of_values        = 0;
+	internal_record->value_data_offset       = 0;
+	internal_record->value_data_reference    = NULL;
+	internal_record->value_data_file_offset  = 0;
+	internal_record->has_deferred_value_data = 0;
+	internal_record->parse_error_code        = parse_error_code;
+	internal_record->parse_error_offset      = byte_stream_offset;
+
+	if( internal_record->value_name != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->value_name );
+
+		internal_record->value_name = NULL;
+	}
+	internal_record->value_name_size = 0;
+
+	if( internal_record->entry_name != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->entry_name );
+
+		internal_record->entry_name = NULL;
+	}
+	internal_record->entry_name_size = 0;
+
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_RECORD,
+	 NULL,
+	 internal_record->value_type,
+	 byte_stream_size,
+	 -1 );
+
+	return( -1 );
+}
+
+/* Reads a record using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_record_read_file_io_handle(
+     libfwps_internal_record_t *internal_record,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t read_size,
+     uint8_t read_flags,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	uint8_t *record_data  = NULL;
+	static char *function = "libfwps_internal_record_read_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record data is only needed while the record is read, but is checked
+	 * against the parse limits since it can be as large as the record
+	 */
+	if( ( parse_limits != NULL )
+	 && ( libfwps_parse_limits_check_size(
+	       parse_limits,
+	       (size64_t) read_size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read size value exceeds maximum total size.",
+		 function );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+		return( -1 );
+	}
+	record_data = (uint8_t *) libfwps_allocator_allocate(
+	                           sizeof( uint8_t ) * read_size,
+	                           LIBFWPS_ALLOCATION_TYPE_VALUE );
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              record_data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+		goto on_error;
+	}
+	if( libfwps_internal_record_read_byte_stream(
+	     internal_record,
+	     record_data,
+	     read_size,
+	     read_flags,
+	     value_data_threshold,
+	     parse_limits,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record data is not retained hence deferred value data is read from the file IO handle
+	 */
+	internal_record->value_data_reference = NULL;
+
+	libfwps_allocator_free(
+	 record_data );
+
+	return( 1 );
+
+on_error:
+	if( record_data != NULL )
+	{
+		libfwps_allocator_free(
+		 record_data );
+	}
+	return( -1 );
+}
+
+/* Reads a record using a Basic File IO (bfio) handle
+ * Records larger than LIBFWPS_RECORD_INITIAL_READ_SIZE are read partially
+ * and their binary data or stream value data is read on demand, as is value
+ * data larger than a non-zero value data threshold, for which the file IO
+ * handle must remain open while the record is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_read_file_io_handle(
+     libfwps_record_t *record,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t record_size,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_read_file_io_handle";
+	size64_t total_size                        = 0;
+	int result                                 = -1;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record - record is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_record->parse_error_offset = 0;
+
+	if( ( internal_record->entry_name != NULL )
+	 || ( internal_record->value_name != NULL )
+	 || ( internal_record->value_data != NULL )
+	 || ( internal_record->has_deferred_value_data != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record - already read.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size < 13 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		return( -1 );
+	}
+	internal_record->parse_error_code = LIBFWPS_PARSE_ERROR_NONE;
+
+	if( parse_limits != NULL )
+	{
+		total_size = parse_limits->total_size;
+	}
+	if( record_size > LIBFWPS_RECORD_INITIAL_READ_SIZE )
+	{
+		result = libfwps_internal_record_read_file_io_handle(
+		          internal_record,
+		          file_io_handle,
+		          file_offset,
+		          (size_t) LIBFWPS_RECORD_INITIAL_READ_SIZE,
+		          LIBFWPS_READ_FLAG_DEFER_VALUE_DATA,
+		          value_data_threshold,
+		          parse_limits,
+		          ascii_codepage,
+		          error );
+
+		if( result != 1 )
+		{
+			/* The record cannot be read from its initial part, for example
+			 * because it contains a large vector, hence read it entirely
+			 */
+			libcerror_error_free(
+			 error );
+
+			if( parse_limits != NULL )
+			{
+				parse_limits->total_size = total_size;
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		if( libfwps_internal_record_read_file_io_handle(
+		     internal_record,
+		     file_io_handle,
+		     file_offset,
+		     (size_t) record_size,
+		     0,
+		     value_data_threshold,
+		     parse_limits,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	if( internal_record->value_data_offset > 0 )
+	{
+		internal_record->value_data_offset += file_offset;
+	}
+	if( internal_record->has_deferred_value_data != 0 )
+	{
+		internal_record->value_data_file_offset += file_offset;
+		internal_record->file_io_handle          = file_io_handle;
+	}
+	return( 1 );
+}
+
+/* Pushes a diagnostic event of a record that was read
+ * The decision is determined by the result and how the value data was read
+ */
+void libfwps_internal_record_push_diagnostic_event(
+      libfwps_internal_record_t *internal_record,
+      off64_t offset,
+      size64_t size,
+      int result )
+{
+	int decision = LIBFWPS_DIAGNOSTIC_DECISION_ACCEPTED;
+
+	if( internal_record == NULL )
+	{
+		return;
+	}
+	if( result != 1 )
+	{
+		decision = LIBFWPS_DIAGNOSTIC_DECISION_REJECTED;
+	}
+	else if( internal_record->value_data_reference != NULL )
+	{
+		decision = LIBFWPS_DIAGNOSTIC_DECISION_REFERENCED;
+	}
+	else if( internal_record->has_deferred_value_data != 0 )
+	{
+		decision = LIBFWPS_DIAGNOSTIC_DECISION_DEFERRED;
+	}
+	libfwps_diagnostics_push_event(
+	 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_RECORD,
+	 offset,
+	 size,
+	 internal_record->value_type,
+	 decision,
+	 internal_record->anomaly_flags,
+	 internal_record->parse_error_code );
+}
+
+/* Retrieves the size of the serialized record
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_serialized_size(
+     libfwps_record_t *record,
+     size_t *serialized_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_serialized_size";
+	size_t safe_serialized_size                = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( serialized_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size, entry type or name size, unknown and value type
+	 */
+	safe_serialized_size = 13;
+
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		safe_serialized_size += internal_record->entry_name_size;
+	}
+	if( ( internal_record->value_type & 0x0000f000UL ) == 0x00001000UL )
+	{
+		safe_serialized_size += 4;
+	}
+	else
+	{
+		if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STREAM )
+		{
+			safe_serialized_size += 4 + internal_record->value_name_size + 2;
+		}
+		switch( internal_record->value_type )
+		{
+			case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+			case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+			case LIBFWPS_VALUE_TYPE_STREAM:
+			case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+			case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+				safe_serialized_size += 4;
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( internal_record->value_data_size > ( (size_t) UINT32_MAX - safe_serialized_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record - value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_serialized_size += internal_record->value_data_size;
+
+	*serialized_size = safe_serialized_size;
+
+	return( 1 );
+}
+
+/* Copies a record to a byte stream
+ * The byte stream must be at least the size returned by libfwps_record_get_serialized_size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_copy_to_byte_stream(
+     libfwps_record_t *record,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_copy_to_byte_stream";
+	size_t byte_stream_offset                  = 0;
+	size_t serialized_size                     = 0;
+	ssize_t read_count                         = 0;
+	uint32_t value_data_size                   = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_record_get_serialized_size(
+	     record,
+	     &serialized_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < serialized_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->value_data_size > 0 )
+	 && ( internal_record->value_data == NULL )
+	 && ( internal_record->has_deferred_value_data == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 byte_stream,
+	 (uint32_t) serialized_size );
+
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 internal_record->entry_name_size );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 internal_record->entry_type );
+	}
+	byte_stream[ 8 ] = 0;
+
+	byte_stream_offset = 9;
+
+	if( internal_record->type == LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		if( internal_record->entry_name_size > 0 )
+		{
+			if( memory_copy(
+			     &( byte_stream[ byte_stream_offset ] ),
+			     internal_record->entry_name,
+			     internal_record->entry_name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy entry name data.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_offset += internal_record->entry_name_size;
+		}
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 internal_record->value_type );
+
+	byte_stream_offset += 4;
+
+	if( ( internal_record->value_type & 0x0000f000UL ) == 0x00001000UL )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 internal_record->number_of_values );
+
+		byte_stream_offset += 4;
+	}
+	else
+	{
+		if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STREAM )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( byte_stream[ byte_stream_offset ] ),
+			 internal_record->value_name_size );
+
+			byte_stream_offset += 4;
+
+			if( internal_record->value_name_size > 0 )
+			{
+				if( memory_copy(
+				     &( byte_stream[ byte_stream_offset ] ),
+				     internal_record->value_name,
+				     internal_record->value_name_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy value name data.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_offset += internal_record->value_name_size;
+			}
+			byte_stream[ byte_stream_offset ]     = 0;
+			byte_stream[ byte_stream_offset + 1 ] = 0;
+
+			byte_stream_offset += 2;
+		}
+		switch( internal_record->value_type )
+		{
+			case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+			case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+			case LIBFWPS_VALUE_TYPE_STREAM:
+			case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+			case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+				value_data_size = (uint32_t) internal_record->value_data_size;
+
+				if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_UNICODE )
+				{
+					value_data_size /= 2;
+				}
+				byte_stream_copy_from_uint32_little_endian(
+				 &( byte_stream[ byte_stream_offset ] ),
+				 value_data_size );
+
+				byte_stream_offset += 4;
+
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( internal_record->value_data_size > 0 )
+	{
+		if( internal_record->has_deferred_value_data != 0 )
+		{
+			read_count = libfwps_record_read_data(
+			              record,
+			              0,
+			              &( byte_stream[ byte_stream_offset ] ),
+			              internal_record->value_data_size,
+			              error );
+
+			if( read_count != (ssize_t) internal_record->value_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( memory_copy(
+		          &( byte_stream[ byte_stream_offset ] ),
+		          internal_record->value_data,
+		          internal_record->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded entry name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf8_entry_name_size(
+     libfwps_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf8_entry_name_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     internal_record->entry_name,
+	     internal_record->entry_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of entry name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded entry name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf8_entry_name(
+     libfwps_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf8_entry_name";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     internal_record->entry_name,
+	     internal_record->entry_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded entry name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf16_entry_name_size(
+     libfwps_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf16_entry_name_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     internal_record->entry_name,
+	     internal_record->entry_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of entry name as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded entry name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf16_entry_name(
+     libfwps_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf16_entry_name";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     internal_record->entry_name,
+	     internal_record->entry_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry name as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the entry type
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwps_record_get_entry_type(
+     libfwps_record_t *record,
+     uint32_t *entry_type,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_entry_type";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( entry_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NUMERIC )
+	{
+		return( 0 );
+	}
+	*entry_type = internal_record->entry_type;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded value name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf8_value_name_size(
+     libfwps_record_t *record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf8_value_name_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_name_size == 0 )
+	 || ( internal_record->value_name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     internal_record->value_name,
+	     internal_record->value_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of value name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded value name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf8_value_name(
+     libfwps_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf8_value_name";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_name_size == 0 )
+	 || ( internal_record->value_name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     internal_record->value_name,
+	     internal_record->value_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value name as UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded value name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf16_value_name_size(
+     libfwps_record_t *record,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf16_value_name_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_name_size == 0 )
+	 || ( internal_record->value_name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     internal_record->value_name,
+	     internal_record->value_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of value name as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded value name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_utf16_value_name(
+     libfwps_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_utf16_value_name";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_name_size == 0 )
+	 || ( internal_record->value_name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     internal_record->value_name,
+	     internal_record->value_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value name as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_value_type(
+     libfwps_record_t *record,
+     uint32_t *value_type,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_value_type";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	*value_type = internal_record->value_type;
+
+	return( 1 );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_data_size(
+     libfwps_record_t *record,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_data_size";
+
+	if( record == NULL )
 	{
-		if( byte_stream_offset < internal_record->size )
-		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( byte_stream[ byte_stream_offset ] ),
-			 internal_record->size - byte_stream_offset,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	internal_record = (libfwps_internal_record_t *) record;
 
-	internal_record->ascii_codepage = ascii_codepage;
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = internal_record->value_data_size;
 
 	return( 1 );
+}
 
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( value_string != NULL )
+/* Retrieves the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_data(
+     libfwps_record_t *record,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_data";
+	ssize_t read_count                         = 0;
+
+	if( record == NULL )
 	{
-		memory_free(
-		 value_string );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( internal_record->value_data != NULL )
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_data == NULL )
+	 && ( internal_record->has_deferred_value_data == 0 ) )
 	{
-		memory_free(
-		 internal_record->value_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
+		 function );
 
-		internal_record->value_data = NULL;
+		return( -1 );
 	}
-	internal_record->value_data_size = 0;
-
-	if( internal_record->value_name != NULL )
+	if( data == NULL )
 	{
-		memory_free(
-		 internal_record->value_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-		internal_record->value_name = NULL;
+		return( -1 );
 	}
-	internal_record->value_name_size = 0;
+	if( ( data_size < internal_record->value_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
-	if( internal_record->entry_name != NULL )
+		return( -1 );
+	}
+	if( internal_record->has_deferred_value_data != 0 )
 	{
-		memory_free(
-		 internal_record->entry_name );
+		read_count = libfwps_record_read_data(
+		              record,
+		              0,
+		              data,
+		              internal_record->value_data_size,
+		              error );
 
-		internal_record->entry_name = NULL;
+		if( read_count != (ssize_t) internal_record->value_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value data.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	internal_record->entry_name_size = 0;
+	else if( memory_copy(
+	          data,
+	          internal_record->value_data,
+	          internal_record->value_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded entry name
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves a pointer to the data
+ * The data is owned by the record and remains valid until the record is freed
+ * or its value is changed
+ * Returns 1 if successful, 0 if the data is not available in memory or -1 on error
  */
-int libfwps_record_get_utf8_entry_name_size(
+int libfwps_record_get_data_pointer(
      libfwps_record_t *record,
-     size_t *utf8_string_size,
+     const uint8_t **data,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf8_entry_name_size";
+	static char *function                      = "libfwps_record_get_data_pointer";
 
 	if( record == NULL )
 	{
@@ -1008,41 +3738,57 @@ int libfwps_record_get_utf8_entry_name_size(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	if( data == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_record->entry_name,
-	     internal_record->entry_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of entry name as UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
+	if( ( internal_record->has_deferred_value_data != 0 )
+	 || ( internal_record->value_data == NULL ) )
+	{
+		return( 0 );
+	}
+	*data      = internal_record->value_data;
+	*data_size = internal_record->value_data_size;
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded entry name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
+/* Reads (a part of) the data at a specific offset
+ * The value data is read from the source byte stream or file IO handle
+ * if it was deferred
+ * Returns the number of bytes read, 0 if the offset is at or beyond the end
+ * of the data or -1 on error
  */
-int libfwps_record_get_utf8_entry_name(
-     libfwps_record_t *record,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
+ssize_t libfwps_record_read_data(
+         libfwps_record_t *record,
+         size_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf8_entry_name";
+	const uint8_t *value_data                  = NULL;
+	static char *function                      = "libfwps_record_read_data";
+	size_t read_size                           = 0;
+	ssize_t read_count                         = 0;
 
 	if( record == NULL )
 	{
@@ -1057,41 +3803,131 @@ int libfwps_record_get_utf8_entry_name(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset >= internal_record->value_data_size )
 	{
 		return( 0 );
 	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     internal_record->entry_name,
-	     internal_record->entry_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
+	read_size = internal_record->value_data_size - data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( ( internal_record->has_deferred_value_data != 0 )
+	 && ( internal_record->file_io_handle != NULL ) )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              internal_record->file_io_handle,
+		              buffer,
+		              read_size,
+		              internal_record->value_data_file_offset + (off64_t) data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_record->value_data_file_offset + (off64_t) data_offset,
+			 internal_record->value_data_file_offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	if( internal_record->has_deferred_value_data != 0 )
+	{
+		value_data = internal_record->value_data_reference;
+	}
+	else
+	{
+		value_data = internal_record->value_data;
+	}
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry name as UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( memory_copy(
+	     buffer,
+	     &( value_data[ data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) read_size );
 }
 
-/* Retrieves the size of the UTF-16 encoded entry name
- * The returned size includes the end of string character
+/* Overwrites the value data in place in the data the record was read from
+ * The byte stream must contain the data the record was read from, that is
+ * the store, set or record byte stream or the file data for records read
+ * using a file IO handle, since the value data offset is relative to it
+ * The byte stream offset is the offset of the byte stream in that data,
+ * for records read using a file IO handle this is the file offset of
+ * the byte stream, since their value data offset is a file offset
+ * The value data in the byte stream is compared with the value data of
+ * the record before it is overwritten, deferred value data is read from
+ * the source byte stream or file IO handle for this comparison
+ * The data size must be equal to or smaller than the value data size,
+ * smaller data is padded with zero bytes and the value data size is not changed
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_utf16_entry_name_size(
+int libfwps_record_patch_value(
      libfwps_record_t *record,
-     size_t *utf16_string_size,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     off64_t byte_stream_offset,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
+	uint8_t value_data_buffer[ 512 ];
+
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf16_entry_name_size";
+	static char *function                      = "libfwps_record_patch_value";
+	size_t data_offset                         = 0;
+	size_t read_size                           = 0;
+	size_t value_data_offset                   = 0;
+	ssize_t read_count                         = 0;
+	uint32_t value_type                        = 0;
 
 	if( record == NULL )
 	{
@@ -1106,184 +3942,266 @@ int libfwps_record_get_utf16_entry_name_size(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	if( internal_record->is_read_only != 0 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record - record is read-only.",
+		 function );
+
+		return( -1 );
 	}
-	if( libuna_utf16_string_size_from_utf16_stream(
-	     internal_record->entry_name,
-	     internal_record->entry_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( ( internal_record->value_data_size == 0 )
+	 || ( internal_record->value_data_offset <= 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of entry name as UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing value data offset.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	if( ( internal_record->value_type & 0x0000f000UL ) == 0x00001000UL )
+	{
+		value_type = internal_record->value_type & 0x00000fffUL;
 
-/* Retrieves the UTF-16 encoded entry name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfwps_record_get_utf16_entry_name(
-     libfwps_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf16_entry_name";
+		switch( value_type )
+		{
+			case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+			case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+			case LIBFWPS_VALUE_TYPE_STREAM:
+			case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+			case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported vector value type: 0x%04" PRIx32 ".",
+				 function,
+				 internal_record->value_type );
 
-	if( record == NULL )
+				return( -1 );
+
+			default:
+				break;
+		}
+	}
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( libuna_utf16_string_copy_from_utf16_stream(
-	     utf16_string,
-	     utf16_string_size,
-	     internal_record->entry_name,
-	     internal_record->entry_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
+	if( ( byte_stream_offset < 0 )
+	 || ( byte_stream_offset > internal_record->value_data_offset ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry name as UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the entry type
- * Returns 1 if successful, 0 if not available or -1 on error
- */
-int libfwps_record_get_entry_type(
-     libfwps_record_t *record,
-     uint32_t *entry_type,
-     libcerror_error_t **error )
-{
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_entry_type";
-
-	if( record == NULL )
+	if( ( (uint64_t) ( internal_record->value_data_offset - byte_stream_offset ) > (uint64_t) byte_stream_size )
+	 || ( internal_record->value_data_size > ( byte_stream_size - (size_t) ( internal_record->value_data_offset - byte_stream_offset ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( entry_type == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry type.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->type != LIBFWPS_RECORD_TYPE_NUMERIC )
-	{
-		return( 0 );
-	}
-	*entry_type = internal_record->entry_type;
-
-	return( 1 );
-}
-
-/* Retrieves the size of the UTF-8 encoded value name
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfwps_record_get_utf8_value_name_size(
-     libfwps_record_t *record,
-     size_t *utf8_string_size,
-     libcerror_error_t **error )
-{
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf8_value_name_size";
-
-	if( record == NULL )
+	if( data_size > internal_record->value_data_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value exceeds value data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
+	value_data_offset = (size_t) ( internal_record->value_data_offset - byte_stream_offset );
 
-	if( ( internal_record->value_name_size == 0 )
-	 || ( internal_record->value_name == NULL ) )
+	/* Make sure the byte stream contains the record value data
+	 * before it is overwritten, deferred value data is read in blocks
+	 * from the source byte stream or file IO handle
+	 */
+	if( internal_record->has_deferred_value_data != 0 )
 	{
-		return( 0 );
+		while( data_offset < internal_record->value_data_size )
+		{
+			read_size = internal_record->value_data_size - data_offset;
+
+			if( read_size > 512 )
+			{
+				read_size = 512;
+			}
+			read_count = libfwps_record_read_data(
+			              record,
+			              data_offset,
+			              value_data_buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value data at offset: %" PRIzu ".",
+				 function,
+				 data_offset );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     &( byte_stream[ value_data_offset + data_offset ] ),
+			     value_data_buffer,
+			     read_size ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: byte stream does not contain the record value data.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += read_size;
+		}
 	}
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_record->value_name,
-	     internal_record->value_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf8_string_size,
-	     error ) != 1 )
+	else if( internal_record->value_data != NULL )
+	{
+		if( memory_compare(
+		     &( byte_stream[ value_data_offset ] ),
+		     internal_record->value_data,
+		     internal_record->value_data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: byte stream does not contain the record value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of value name as UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing value data.",
 		 function );
 
 		return( -1 );
 	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( byte_stream[ value_data_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_size < internal_record->value_data_size )
+	{
+		if( memory_set(
+		     &( byte_stream[ value_data_offset + data_size ] ),
+		     0,
+		     internal_record->value_data_size - data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear remainder of value data in byte stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_record->value_data != NULL )
+	{
+		if( memory_copy(
+		     internal_record->value_data,
+		     &( byte_stream[ value_data_offset ] ),
+		     internal_record->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded value name
- * The size should include the end of string character
+/* Retrieves the data as a boolean value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_utf8_value_name(
+int libfwps_record_get_data_as_boolean(
      libfwps_record_t *record,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint8_t *value_boolean,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf8_value_name";
+	static char *function                      = "libfwps_record_get_data_as_boolean";
 
 	if( record == NULL )
 	{
@@ -1291,99 +4209,73 @@ int libfwps_record_get_utf8_value_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record entry.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_name_size == 0 )
-	 || ( internal_record->value_name == NULL ) )
-	{
-		return( 0 );
-	}
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
-	     utf8_string_size,
-	     internal_record->value_name,
-	     internal_record->value_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
+	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_BOOLEAN )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value name as UTF-8 string.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of the UTF-16 encoded value name
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfwps_record_get_utf16_value_name_size(
-     libfwps_record_t *record,
-     size_t *utf16_string_size,
-     libcerror_error_t **error )
-{
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf16_value_name_size";
+	if( internal_record->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
+		 function );
 
-	if( record == NULL )
+		return( -1 );
+	}
+	if( internal_record->value_data_size != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( ( internal_record->value_name_size == 0 )
-	 || ( internal_record->value_name == NULL ) )
-	{
-		return( 0 );
-	}
-	if( libuna_utf16_string_size_from_utf16_stream(
-	     internal_record->value_name,
-	     internal_record->value_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( value_boolean == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of value name as UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value boolean.",
 		 function );
 
 		return( -1 );
 	}
+	*value_boolean = internal_record->value_data[ 0 ];
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded value name
- * The size should include the end of string character
+/* Retrieves the data as a 8-bit integer value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_utf16_value_name(
+int libfwps_record_get_data_as_8bit_integer(
      libfwps_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t *value_8bit,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_utf16_value_name";
+	static char *function                      = "libfwps_record_get_data_as_8bit_integer";
 
 	if( record == NULL )
 	{
@@ -1391,88 +4283,74 @@ int libfwps_record_get_utf16_value_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record entry.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_name_size == 0 )
-	 || ( internal_record->value_name == NULL ) )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED ) )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
+
+		return( -1 );
 	}
-	if( libuna_utf16_string_copy_from_utf16_stream(
-	     utf16_string,
-	     utf16_string_size,
-	     internal_record->value_name,
-	     internal_record->value_name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
+	if( internal_record->value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value name as UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the value type
- * Returns 1 if successful or -1 on error
- */
-int libfwps_record_get_value_type(
-     libfwps_record_t *record,
-     uint32_t *value_type,
-     libcerror_error_t **error )
-{
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_value_type";
-
-	if( record == NULL )
+	if( internal_record->value_data_size != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( value_type == NULL )
+	if( value_8bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value type.",
+		 "%s: invalid value 8-bit.",
 		 function );
 
 		return( -1 );
 	}
-	*value_type = internal_record->value_type;
+	*value_8bit = internal_record->value_data[ 0 ];
 
 	return( 1 );
 }
 
-/* Retrieves the data size
+/* Retrieves the data as a 16-bit integer value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_size(
+int libfwps_record_get_data_as_16bit_integer(
      libfwps_record_t *record,
-     size_t *data_size,
+     uint16_t *value_16bit,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_size";
+	static char *function                      = "libfwps_record_get_data_as_16bit_integer";
 
 	if( record == NULL )
 	{
@@ -1480,40 +4358,76 @@ int libfwps_record_get_data_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record entry.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( data_size == NULL )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
+
+		return( -1 );
+	}
+	if( internal_record->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->value_data_size != 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_16bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 "%s: invalid value 16-bit.",
 		 function );
 
 		return( -1 );
 	}
-	*data_size = internal_record->value_data_size;
+	byte_stream_copy_to_uint16_little_endian(
+	 internal_record->value_data,
+	 *value_16bit );
 
 	return( 1 );
 }
 
-/* Retrieves the data
+/* Retrieves the data as a 32-bit integer value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data(
+int libfwps_record_get_data_as_32bit_integer(
      libfwps_record_t *record,
-     uint8_t *data,
-     size_t data_size,
+     uint32_t *value_32bit,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data";
+	static char *function                      = "libfwps_record_get_data_as_32bit_integer";
 
 	if( record == NULL )
 	{
@@ -1521,74 +4435,79 @@ int libfwps_record_get_data(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record entry.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->value_data == NULL )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_ERROR )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_SIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
 
 		return( -1 );
 	}
-	if( data == NULL )
+	if( internal_record->value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size < internal_record->value_data_size )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	if( internal_record->value_data_size != 4 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     data,
-	     internal_record->value_data,
-	     internal_record->value_data_size ) == NULL )
+	if( value_32bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
 		 function );
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 internal_record->value_data,
+	 *value_32bit );
+
 	return( 1 );
 }
 
-/* Retrieves the data as a boolean value
+/* Retrieves the data as a 64-bit integer value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_boolean(
+int libfwps_record_get_data_as_64bit_integer(
      libfwps_record_t *record,
-     uint8_t *value_boolean,
+     uint64_t *value_64bit,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_boolean";
+	static char *function                      = "libfwps_record_get_data_as_64bit_integer";
 
 	if( record == NULL )
 	{
@@ -1603,7 +4522,11 @@ int libfwps_record_get_data_as_boolean(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_BOOLEAN )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_CURRENCY )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_FILETIME )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1626,7 +4549,7 @@ int libfwps_record_get_data_as_boolean(
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 1 )
+	if( internal_record->value_data_size != 8 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1637,32 +4560,34 @@ int libfwps_record_get_data_as_boolean(
 
 		return( -1 );
 	}
-	if( value_boolean == NULL )
+	if( value_64bit == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value boolean.",
+		 "%s: invalid value 64-bit.",
 		 function );
 
 		return( -1 );
 	}
-	*value_boolean = internal_record->value_data[ 0 ];
+	byte_stream_copy_to_uint64_little_endian(
+	 internal_record->value_data,
+	 *value_64bit );
 
 	return( 1 );
 }
 
-/* Retrieves the data as a 8-bit integer value
+/* Retrieves the data as a 64-bit floatingtime value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_8bit_integer(
+int libfwps_record_get_data_as_floatingtime(
      libfwps_record_t *record,
-     uint8_t *value_8bit,
+     uint64_t *floatingtime,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_8bit_integer";
+	static char *function                      = "libfwps_record_get_data_as_floatingtime";
 
 	if( record == NULL )
 	{
@@ -1677,8 +4602,7 @@ int libfwps_record_get_data_as_8bit_integer(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED ) )
+	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
 	{
 		libcerror_error_set(
 		 error,
@@ -1701,7 +4625,7 @@ int libfwps_record_get_data_as_8bit_integer(
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 1 )
+	if( internal_record->value_data_size != 8 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1712,32 +4636,34 @@ int libfwps_record_get_data_as_8bit_integer(
 
 		return( -1 );
 	}
-	if( value_8bit == NULL )
+	if( floatingtime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 8-bit.",
+		 "%s: invalid floatingtime.",
 		 function );
 
 		return( -1 );
 	}
-	*value_8bit = internal_record->value_data[ 0 ];
+	byte_stream_copy_to_uint64_little_endian(
+	 internal_record->value_data,
+	 *floatingtime );
 
 	return( 1 );
 }
 
-/* Retrieves the data as a 16-bit integer value
+/* Retrieves the data as a 64-bit FILETIME value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_16bit_integer(
+int libfwps_record_get_data_as_filetime(
      libfwps_record_t *record,
-     uint16_t *value_16bit,
+     uint64_t *filetime,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_16bit_integer";
+	static char *function                      = "libfwps_record_get_data_as_filetime";
 
 	if( record == NULL )
 	{
@@ -1752,8 +4678,7 @@ int libfwps_record_get_data_as_16bit_integer(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED ) )
+	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_FILETIME )
 	{
 		libcerror_error_set(
 		 error,
@@ -1776,7 +4701,7 @@ int libfwps_record_get_data_as_16bit_integer(
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 2 )
+	if( internal_record->value_data_size != 8 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1787,34 +4712,37 @@ int libfwps_record_get_data_as_16bit_integer(
 
 		return( -1 );
 	}
-	if( value_16bit == NULL )
+	if( filetime == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 16-bit.",
+		 "%s: invalid filetime.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint16_little_endian(
+	byte_stream_copy_to_uint64_little_endian(
 	 internal_record->value_data,
-	 *value_16bit );
+	 *filetime );
 
 	return( 1 );
 }
 
-/* Retrieves the data as a 32-bit integer value
+/* Retrieves the floating point value
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_32bit_integer(
+int libfwps_record_get_data_as_floating_point(
      libfwps_record_t *record,
-     uint32_t *value_32bit,
+     double *value_floating_point,
      libcerror_error_t **error )
 {
+	byte_stream_float32_t value_float;
+	byte_stream_float64_t value_double;
+
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_32bit_integer";
+	static char *function                      = "libfwps_record_get_data_as_floating_point";
 
 	if( record == NULL )
 	{
@@ -1829,11 +4757,9 @@ int libfwps_record_get_data_as_32bit_integer(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_ERROR )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_SIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED ) )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_FLOAT_32BIT )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_DOUBLE_64BIT ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1856,45 +4782,64 @@ int libfwps_record_get_data_as_32bit_integer(
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 4 )
+	if( value_floating_point == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value floating point.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_32bit == NULL )
+	/* The value data size of a floating point value is 4 or 8
+	 */
+	if( ( internal_record->value_data_size != 4 )
+	 && ( internal_record->value_data_size != 8 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 32-bit.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 internal_record->value_data,
-	 *value_32bit );
+	if( internal_record->value_data_size == 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 internal_record->value_data,
+		 value_float.integer );
 
+		*value_floating_point = (double) value_float.floating_point;
+	}
+	else if( internal_record->value_data_size == 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 internal_record->value_data,
+		 value_double.integer );
+
+		*value_floating_point = value_double.floating_point;
+	}
 	return( 1 );
 }
 
-/* Retrieves the data as a 64-bit integer value
+/* Retrieves the size of the data formatted as an UTF-8 string
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_64bit_integer(
+int libfwps_record_get_data_as_utf8_string_size(
      libfwps_record_t *record,
-     uint64_t *value_64bit,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_64bit_integer";
+	static char *function                      = "libfwps_record_get_data_as_utf8_string_size";
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -1909,11 +4854,9 @@ int libfwps_record_get_data_as_64bit_integer(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_CURRENCY )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_FILETIME )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED ) )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1925,56 +4868,97 @@ int libfwps_record_get_data_as_64bit_integer(
 
 		return( -1 );
 	}
-	if( internal_record->value_data == NULL )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 8 )
+	if( ( internal_record->value_data == NULL )
+	 || ( internal_record->value_data_size == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
-		 function );
+		*utf8_string_size = 0;
 
-		return( -1 );
+		return( 1 );
 	}
-	if( value_64bit == NULL )
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	/* String is in UTF-16 little-endian
+	 */
+	if( is_ascii_string == 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf8_string_size,
+		          error );
+	}
+	/* Codepage 65000 represents UTF-7
+	 */
+	else if( internal_record->ascii_codepage == 65000 )
+	{
+		result = libuna_utf8_string_size_from_utf7_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  utf8_string_size,
+			  error );
+	}
+	/* Codepage 65001 represents UTF-8
+	 */
+	else if( internal_record->ascii_codepage == 65001 )
+	{
+		result = libuna_utf8_string_size_from_utf8_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  utf8_string_size,
+			  error );
+	}
+	else
+	{
+		result = libuna_utf8_string_size_from_byte_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  internal_record->ascii_codepage,
+			  utf8_string_size,
+			  error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value 64-bit.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of value data as UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint64_little_endian(
-	 internal_record->value_data,
-	 *value_64bit );
-
 	return( 1 );
 }
 
-/* Retrieves the data as a 64-bit floatingtime value
+/* Retrieves the data formatted as an UTF-8 string
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_floatingtime(
+int libfwps_record_get_data_as_utf8_string(
      libfwps_record_t *record,
-     uint64_t *floatingtime,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_floatingtime";
+	static char *function                      = "libfwps_record_get_data_as_utf8_string";
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -1989,7 +4973,9 @@ int libfwps_record_get_data_as_floatingtime(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2001,56 +4987,125 @@ int libfwps_record_get_data_as_floatingtime(
 
 		return( -1 );
 	}
-	if( internal_record->value_data == NULL )
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->value_data == NULL )
+	 || ( internal_record->value_data_size == 0 ) )
+	{
+		utf8_string[ 0 ] = 0;
+
+		return( 1 );
+	}
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	/* String is in UTF-16 little-endian
+	 */
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size );
+
+	if( is_ascii_string == 0 )
+	{
+		result = libuna_utf8_string_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	/* Codepage 65000 represents UTF-7
+	 */
+	else if( internal_record->ascii_codepage == 65000 )
+	{
+		result = libuna_utf8_string_copy_from_utf7_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	/* Codepage 65001 represents UTF-8
+	 */
+	else if( internal_record->ascii_codepage == 65001 )
+	{
+		result = libuna_utf8_string_copy_from_utf8_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
-		 function );
-
-		return( -1 );
+		result = libuna_utf8_string_copy_from_byte_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          internal_record->ascii_codepage,
+		          error );
 	}
-	if( internal_record->value_data_size != 8 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
-		 function );
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size,
+	 result );
 
-		return( -1 );
-	}
-	if( floatingtime == NULL )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid floatingtime.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data to UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint64_little_endian(
-	 internal_record->value_data,
-	 *floatingtime );
-
 	return( 1 );
 }
 
-/* Retrieves the data as a 64-bit FILETIME value
+/* Retrieves the size of the data formatted as an UTF-16 string
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_filetime(
+int libfwps_record_get_data_as_utf16_string_size(
      libfwps_record_t *record,
-     uint64_t *filetime,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_filetime";
+	static char *function                      = "libfwps_record_get_data_as_utf16_string_size";
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -2065,7 +5120,9 @@ int libfwps_record_get_data_as_filetime(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_FILETIME )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2077,59 +5134,97 @@ int libfwps_record_get_data_as_filetime(
 
 		return( -1 );
 	}
-	if( internal_record->value_data == NULL )
+	if( utf16_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_record->value_data_size != 8 )
+	if( ( internal_record->value_data == NULL )
+	 || ( internal_record->value_data_size == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
-		 function );
+		*utf16_string_size = 0;
 
-		return( -1 );
+		return( 1 );
 	}
-	if( filetime == NULL )
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	/* String is in UTF-16 little-endian
+	 */
+	if( is_ascii_string == 0 )
+	{
+		result = libuna_utf16_string_size_from_utf16_stream(
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf16_string_size,
+		          error );
+	}
+	/* Codepage 65000 represents UTF-7
+	 */
+	else if( internal_record->ascii_codepage == 65000 )
+	{
+		result = libuna_utf16_string_size_from_utf7_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  utf16_string_size,
+			  error );
+	}
+	/* Codepage 65001 represents UTF-8
+	 */
+	else if( internal_record->ascii_codepage == 65001 )
+	{
+		result = libuna_utf16_string_size_from_utf8_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  utf16_string_size,
+			  error );
+	}
+	else
+	{
+		result = libuna_utf16_string_size_from_byte_stream(
+			  internal_record->value_data,
+			  internal_record->value_data_size,
+			  internal_record->ascii_codepage,
+			  utf16_string_size,
+			  error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of value data as UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint64_little_endian(
-	 internal_record->value_data,
-	 *filetime );
-
 	return( 1 );
 }
 
-/* Retrieves the floating point value
+/* Retrieves the data formatted as an UTF-16 string
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_floating_point(
+int libfwps_record_get_data_as_utf16_string(
      libfwps_record_t *record,
-     double *value_floating_point,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	byte_stream_float32_t value_float;
-	byte_stream_float64_t value_double;
-
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_floating_point";
+	static char *function                      = "libfwps_record_get_data_as_utf16_string";
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
 
 	if( record == NULL )
 	{
@@ -2144,9 +5239,9 @@ int libfwps_record_get_data_as_floating_point(
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_APPLICATION_TIME )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_FLOAT_32BIT )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_DOUBLE_64BIT ) )
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -2158,73 +5253,124 @@ int libfwps_record_get_data_as_floating_point(
 
 		return( -1 );
 	}
-	if( internal_record->value_data == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_floating_point == NULL )
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value floating point.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	/* The value data size of a floating point value is 4 or 8
-	 */
-	if( ( internal_record->value_data_size != 4 )
-	 && ( internal_record->value_data_size != 8 ) )
+	if( ( internal_record->value_data == NULL )
+	 || ( internal_record->value_data_size == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
-		 function );
+		utf16_string[ 0 ] = 0;
 
-		return( -1 );
+		return( 1 );
 	}
-	if( internal_record->value_data_size == 4 )
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 internal_record->value_data,
-		 value_float.integer );
+		is_ascii_string = 1;
+	}
+	/* String is in UTF-16 little-endian
+	 */
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size );
 
-		*value_floating_point = (double) value_float.floating_point;
+	if( is_ascii_string == 0 )
+	{
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
 	}
-	else if( internal_record->value_data_size == 8 )
+	/* Codepage 65000 represents UTF-7
+	 */
+	else if( internal_record->ascii_codepage == 65000 )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 internal_record->value_data,
-		 value_double.integer );
+		result = libuna_utf16_string_copy_from_utf7_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	/* Codepage 65001 represents UTF-8
+	 */
+	else if( internal_record->ascii_codepage == 65001 )
+	{
+		result = libuna_utf16_string_copy_from_utf8_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          internal_record->ascii_codepage,
+		          error );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size,
+	 result );
 
-		*value_floating_point = value_double.floating_point;
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data to UTF-16 string.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of the data formatted as an UTF-8 string
+/* Retrieves the size of the data formatted as an UTF-8 path string
  * The function uses a codepage if necessary, it uses the codepage set for the library
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf8_string_size(
+int libfwps_record_get_data_as_utf8_path_string_size(
      libfwps_record_t *record,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf8_string_size";
+	static char *function                      = "libfwps_record_get_data_as_utf8_path_string_size";
 	uint8_t is_ascii_string                    = 0;
 	int result                                 = 0;
 
@@ -2284,7 +5430,7 @@ int libfwps_record_get_data_as_utf8_string_size(
 		result = libuna_utf8_string_size_from_utf16_stream(
 		          internal_record->value_data,
 		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
 		          utf8_string_size,
 		          error );
 	}
@@ -2331,19 +5477,20 @@ int libfwps_record_get_data_as_utf8_string_size(
 	return( 1 );
 }
 
-/* Retrieves the data formatted as an UTF-8 string
+/* Retrieves the data formatted as an UTF-8 path string
  * The function uses a codepage if necessary, it uses the codepage set for the library
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
  * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf8_string(
+int libfwps_record_get_data_as_utf8_path_string(
      libfwps_record_t *record,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf8_string";
+	static char *function                      = "libfwps_record_get_data_as_utf8_path_string";
 	uint8_t is_ascii_string                    = 0;
 	int result                                 = 0;
 
@@ -2410,6 +5557,12 @@ int libfwps_record_get_data_as_utf8_string(
 	}
 	/* String is in UTF-16 little-endian
 	 */
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size );
+
 	if( is_ascii_string == 0 )
 	{
 		result = libuna_utf8_string_copy_from_utf16_stream(
@@ -2417,7 +5570,7 @@ int libfwps_record_get_data_as_utf8_string(
 		          utf8_string_size,
 		          internal_record->value_data,
 		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
 		          error );
 	}
 	/* Codepage 65000 represents UTF-7
@@ -2452,6 +5605,13 @@ int libfwps_record_get_data_as_utf8_string(
 		          internal_record->ascii_codepage,
 		          error );
 	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size,
+	 result );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -2466,18 +5626,19 @@ int libfwps_record_get_data_as_utf8_string(
 	return( 1 );
 }
 
-/* Retrieves the size of the data formatted as an UTF-16 string
+/* Retrieves the size of the data formatted as an UTF-16 path string
  * The function uses a codepage if necessary, it uses the codepage set for the library
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf16_string_size(
+int libfwps_record_get_data_as_utf16_path_string_size(
      libfwps_record_t *record,
      size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf16_string_size";
+	static char *function                      = "libfwps_record_get_data_as_utf16_path_string_size";
 	uint8_t is_ascii_string                    = 0;
 	int result                                 = 0;
 
@@ -2537,7 +5698,7 @@ int libfwps_record_get_data_as_utf16_string_size(
 		result = libuna_utf16_string_size_from_utf16_stream(
 		          internal_record->value_data,
 		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
 		          utf16_string_size,
 		          error );
 	}
@@ -2570,13 +5731,271 @@ int libfwps_record_get_data_as_utf16_string_size(
 			  utf16_string_size,
 			  error );
 	}
-	if( result != 1 )
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of value data as UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data formatted as an UTF-16 path string
+ * The function uses a codepage if necessary, it uses the codepage set for the library
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_data_as_utf16_path_string(
+     libfwps_record_t *record,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_data_as_utf16_path_string";
+	uint8_t is_ascii_string                    = 0;
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->value_data == NULL )
+	 || ( internal_record->value_data_size == 0 ) )
+	{
+		utf16_string[ 0 ] = 0;
+
+		return( 1 );
+	}
+	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	{
+		is_ascii_string = 1;
+	}
+	/* String is in UTF-16 little-endian
+	 */
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size );
+
+	if( is_ascii_string == 0 )
+	{
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		          error );
+	}
+	/* Codepage 65000 represents UTF-7
+	 */
+	else if( internal_record->ascii_codepage == 65000 )
+	{
+		result = libuna_utf16_string_copy_from_utf7_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	/* Codepage 65001 represents UTF-8
+	 */
+	else if( internal_record->ascii_codepage == 65001 )
+	{
+		result = libuna_utf16_string_copy_from_utf8_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          error );
+	}
+	else
+	{
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          internal_record->value_data,
+		          internal_record->value_data_size,
+		          internal_record->ascii_codepage,
+		          error );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STRING_CONVERSION,
+	 NULL,
+	 internal_record->value_type,
+	 internal_record->value_data_size,
+	 result );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data as a GUID value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_get_data_as_guid(
+     libfwps_record_t *record,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	static char *function                      = "libfwps_record_get_data_as_guid";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libfwps_internal_record_t *) record;
+
+	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_GUID )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 internal_record->value_type );
+
+		return( -1 );
+	}
+	if( internal_record->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record entry - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record->value_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: GUID data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: GUID data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     internal_record->value_data,
+	     16 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of value data as UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
 		 function );
 
 		return( -1 );
@@ -2584,276 +6003,295 @@ int libfwps_record_get_data_as_utf16_string_size(
 	return( 1 );
 }
 
-/* Retrieves the data formatted as an UTF-16 string
- * The function uses a codepage if necessary, it uses the codepage set for the library
- * The size should include the end of string character
+/* Sets the value data
+ * Any existing value data and value name are replaced
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf16_string(
-     libfwps_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+int libfwps_internal_record_set_value_data(
+     libfwps_internal_record_t *internal_record,
+     uint32_t value_type,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf16_string";
-	uint8_t is_ascii_string                    = 0;
-	int result                                 = 0;
+	uint8_t *value_data   = NULL;
+	static char *function = "libfwps_internal_record_set_value_data";
 
-	if( record == NULL )
+	if( internal_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
-
-		return( -1 );
-	}
-	if( utf16_string == NULL )
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf16_string_size == 0 )
-	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-16 string size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_record->value_data == NULL )
-	 || ( internal_record->value_data_size == 0 ) )
+	if( data_size > 0 )
 	{
-		utf16_string[ 0 ] = 0;
+		value_data = (uint8_t *) libfwps_allocator_allocate(
+		                          sizeof( uint8_t ) * data_size,
+		                          LIBFWPS_ALLOCATION_TYPE_VALUE );
 
-		return( 1 );
-	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	{
-		is_ascii_string = 1;
-	}
-	/* String is in UTF-16 little-endian
-	 */
-	if( is_ascii_string == 0 )
-	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE,
-		          error );
-	}
-	/* Codepage 65000 represents UTF-7
-	 */
-	else if( internal_record->ascii_codepage == 65000 )
-	{
-		result = libuna_utf16_string_copy_from_utf7_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
-	}
-	/* Codepage 65001 represents UTF-8
-	 */
-	else if( internal_record->ascii_codepage == 65001 )
-	{
-		result = libuna_utf16_string_copy_from_utf8_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
+		if( value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     value_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			libfwps_allocator_free(
+			 value_data );
+
+			return( -1 );
+		}
 	}
-	else
+	if( internal_record->value_data != NULL )
 	{
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          internal_record->ascii_codepage,
-		          error );
+		libfwps_allocator_free(
+		 internal_record->value_data );
 	}
-	if( result != 1 )
+	if( internal_record->value_name != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value data to UTF-16 string.",
-		 function );
+		libfwps_allocator_free(
+		 internal_record->value_name );
 
-		return( -1 );
+		internal_record->value_name = NULL;
 	}
+	internal_record->value_name_size         = 0;
+	internal_record->value_type              = value_type;
+	internal_record->value_data              = value_data;
+	internal_record->value_data_size         = data_size;
+	internal_record->number_of_values        = 0;
+	internal_record->value_data_offset       = 0;
+	internal_record->value_data_reference    = NULL;
+	internal_record->value_data_file_offset  = 0;
+	internal_record->file_io_handle          = NULL;
+	internal_record->has_deferred_value_data = 0;
+
 	return( 1 );
 }
 
-/* Retrieves the size of the data formatted as an UTF-8 path string
- * The function uses a codepage if necessary, it uses the codepage set for the library
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
- * The returned size includes the end of string character
+/* Converts an UTF-8 string into an UTF-16 little-endian stream including the end of string character
+ * The allocation type is used for the allocation statistics of the stream
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf8_path_string_size(
-     libfwps_record_t *record,
-     size_t *utf8_string_size,
+int libfwps_internal_record_copy_utf16_stream_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int allocation_type,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
      libcerror_error_t **error )
 {
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf8_path_string_size";
-	uint8_t is_ascii_string                    = 0;
-	int result                                 = 0;
+	uint16_t *utf16_string     = NULL;
+	static char *function      = "libfwps_internal_record_copy_utf16_stream_from_utf8_string";
+	size_t utf16_string_index  = 0;
+	size_t utf16_string_size   = 0;
 
-	if( record == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size == NULL )
+	if( utf16_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string size.",
+		 "%s: invalid UTF-16 stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_record->value_data == NULL )
-	 || ( internal_record->value_data_size == 0 ) )
+	if( *utf16_stream != NULL )
 	{
-		*utf8_string_size = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid UTF-16 stream value already set.",
+		 function );
 
-		return( 1 );
+		return( -1 );
 	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
+	if( utf16_stream_size == NULL )
 	{
-		is_ascii_string = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
 	}
-	/* String is in UTF-16 little-endian
-	 */
-	if( is_ascii_string == 0 )
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length + 1,
+	     &utf16_string_size,
+	     error ) != 1 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-		          utf8_string_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 string size.",
+		 function );
+
+		goto on_error;
 	}
-	/* Codepage 65000 represents UTF-7
-	 */
-	else if( internal_record->ascii_codepage == 65000 )
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
 	{
-		result = libuna_utf8_string_size_from_utf7_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  utf8_string_size,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
+		 function );
+
+		goto on_error;
 	}
-	/* Codepage 65001 represents UTF-8
-	 */
-	else if( internal_record->ascii_codepage == 65001 )
+	utf16_string = (uint16_t *) libfwps_allocator_allocate(
+	                             sizeof( uint16_t ) * utf16_string_size,
+	                             allocation_type );
+
+	if( utf16_string == NULL )
 	{
-		result = libuna_utf8_string_size_from_utf8_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  utf8_string_size,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	if( libuna_utf16_string_copy_from_utf8(
+	     utf16_string,
+	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_length + 1,
+	     error ) != 1 )
 	{
-		result = libuna_utf8_string_size_from_byte_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  internal_record->ascii_codepage,
-			  utf8_string_size,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 string from UTF-8 string.",
+		 function );
+
+		goto on_error;
 	}
-	if( result != 1 )
+	*utf16_stream = (uint8_t *) libfwps_allocator_allocate(
+	                             sizeof( uint8_t ) * utf16_string_size * 2,
+	                             allocation_type );
+
+	if( *utf16_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of value data as UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_size;
+	     utf16_string_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( ( *utf16_stream )[ utf16_string_index * 2 ] ),
+		 utf16_string[ utf16_string_index ] );
 	}
+	*utf16_stream_size = utf16_string_size * 2;
+
+	libfwps_allocator_free(
+	 utf16_string );
+
 	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		libfwps_allocator_free(
+		 utf16_string );
+	}
+	return( -1 );
 }
 
-/* Retrieves the data formatted as an UTF-8 path string
- * The function uses a codepage if necessary, it uses the codepage set for the library
- * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
- * The size should include the end of string character
+/* Sets the entry type
+ * This function is only supported for numeric records
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf8_path_string(
+int libfwps_record_set_entry_type(
      libfwps_record_t *record,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint32_t entry_type,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf8_path_string";
-	uint8_t is_ascii_string                    = 0;
-	int result                                 = 0;
+	static char *function                      = "libfwps_record_set_entry_type";
 
 	if( record == NULL )
 	{
@@ -2861,134 +6299,154 @@ int libfwps_record_get_data_as_utf8_path_string(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
+	if( internal_record->is_read_only != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
+		 "%s: invalid record - record is read-only.",
+		 function );
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NUMERIC )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record type.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf8_string_size == 0 )
-	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	internal_record->entry_type = entry_type;
+
+	if( internal_record->set_records_index_is_valid != NULL )
+	{
+		*( internal_record->set_records_index_is_valid ) = 0;
+	}
+	return( 1 );
+}
+
+/* Sets the entry name from an UTF-8 encoded string
+ * This function is only supported for named records
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_set_utf8_entry_name(
+     libfwps_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwps_internal_record_t *internal_record = NULL;
+	uint8_t *entry_name                        = NULL;
+	static char *function                      = "libfwps_record_set_utf8_entry_name";
+	size_t entry_name_size                     = 0;
+
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-8 string size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_record->value_data == NULL )
-	 || ( internal_record->value_data_size == 0 ) )
-	{
-		utf8_string[ 0 ] = 0;
+	internal_record = (libfwps_internal_record_t *) record;
 
-		return( 1 );
-	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	{
-		is_ascii_string = 1;
-	}
-	/* String is in UTF-16 little-endian
-	 */
-	if( is_ascii_string == 0 )
-	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
-		          utf8_string,
-		          utf8_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-		          error );
-	}
-	/* Codepage 65000 represents UTF-7
-	 */
-	else if( internal_record->ascii_codepage == 65000 )
+	if( internal_record->is_read_only != 0 )
 	{
-		result = libuna_utf8_string_copy_from_utf7_stream(
-		          utf8_string,
-		          utf8_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid record - record is read-only.",
+		 function );
+
+		return( -1 );
 	}
-	/* Codepage 65001 represents UTF-8
-	 */
-	else if( internal_record->ascii_codepage == 65001 )
+	if( internal_record->type != LIBFWPS_RECORD_TYPE_NAMED )
 	{
-		result = libuna_utf8_string_copy_from_utf8_stream(
-		          utf8_string,
-		          utf8_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record type.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( libfwps_internal_record_copy_utf16_stream_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     LIBFWPS_ALLOCATION_TYPE_NAME,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
-		          utf8_string,
-		          utf8_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          internal_record->ascii_codepage,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name from UTF-8 string.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( entry_name_size > (size_t) UINT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value data to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
 		 function );
 
+		libfwps_allocator_free(
+		 entry_name );
+
 		return( -1 );
 	}
+	if( internal_record->entry_name != NULL )
+	{
+		libfwps_allocator_free(
+		 internal_record->entry_name );
+	}
+	internal_record->entry_name      = entry_name;
+	internal_record->entry_name_size = (uint32_t) entry_name_size;
+
+	if( internal_record->set_records_index_is_valid != NULL )
+	{
+		*( internal_record->set_records_index_is_valid ) = 0;
+	}
 	return( 1 );
 }
 
-/* Retrieves the size of the data formatted as an UTF-16 path string
- * The function uses a codepage if necessary, it uses the codepage set for the library
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The returned size includes the end of string character
+/* Sets the data
+ * Vector, array and stream value types are not supported
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf16_path_string_size(
+int libfwps_record_set_data(
      libfwps_record_t *record,
-     size_t *utf16_string_size,
+     uint32_t value_type,
+     const uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf16_path_string_size";
-	uint8_t is_ascii_string                    = 0;
-	int result                                 = 0;
+	static char *function                      = "libfwps_record_set_data";
+	size_t value_size                          = 0;
 
 	if( record == NULL )
 	{
@@ -2996,96 +6454,130 @@ int libfwps_record_get_data_as_utf16_path_string_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
 	internal_record = (libfwps_internal_record_t *) record;
 
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
+	if( internal_record->is_read_only != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
-
-		return( -1 );
-	}
-	if( utf16_string_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string size.",
+		 "%s: invalid record - record is read-only.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_record->value_data == NULL )
-	 || ( internal_record->value_data_size == 0 ) )
+	switch( value_type )
 	{
-		*utf16_string_size = 0;
+		case LIBFWPS_VALUE_TYPE_NULL:
+			value_size = 0;
+			break;
 
-		return( 1 );
-	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	{
-		is_ascii_string = 1;
-	}
-	/* String is in UTF-16 little-endian
-	 */
-	if( is_ascii_string == 0 )
-	{
-		result = libuna_utf16_string_size_from_utf16_stream(
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-		          utf16_string_size,
-		          error );
-	}
-	/* Codepage 65000 represents UTF-7
-	 */
-	else if( internal_record->ascii_codepage == 65000 )
-	{
-		result = libuna_utf16_string_size_from_utf7_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  utf16_string_size,
-			  error );
+		case LIBFWPS_VALUE_TYPE_BOOLEAN:
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_size = 1;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			value_size = 2;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_ERROR:
+		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
+			value_size = 4;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_APPLICATION_TIME:
+		case LIBFWPS_VALUE_TYPE_CURRENCY:
+		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
+		case LIBFWPS_VALUE_TYPE_FILETIME:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+			value_size = 8;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FIXED_POINT_128BIT:
+		case LIBFWPS_VALUE_TYPE_GUID:
+			value_size = 16;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BINARY_DATA:
+		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+			value_size = data_size;
+			break;
+
+		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+			if( ( data_size % 2 ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			value_size = data_size;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: 0x%04" PRIx32 ".",
+			 function,
+			 value_type );
+
+			return( -1 );
 	}
-	/* Codepage 65001 represents UTF-8
-	 */
-	else if( internal_record->ascii_codepage == 65001 )
+	if( data_size != value_size )
 	{
-		result = libuna_utf16_string_size_from_utf8_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  utf16_string_size,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( data_size > (size_t) UINT32_MAX )
 	{
-		result = libuna_utf16_string_size_from_byte_stream(
-			  internal_record->value_data,
-			  internal_record->value_data_size,
-			  internal_record->ascii_codepage,
-			  utf16_string_size,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( libfwps_internal_record_set_value_data(
+	     internal_record,
+	     value_type,
+	     data,
+	     data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of value data as UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value data.",
 		 function );
 
 		return( -1 );
@@ -3093,135 +6585,147 @@ int libfwps_record_get_data_as_utf16_path_string_size(
 	return( 1 );
 }
 
-/* Retrieves the data formatted as an UTF-16 path string
- * The function uses a codepage if necessary, it uses the codepage set for the library
- * This function uses UCS-2 (with surrogates) to support characters outside Unicode
- * The size should include the end of string character
+/* Sets the data as a boolean value
+ * The value type is set to VT_BOOL
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_utf16_path_string(
+int libfwps_record_set_data_as_boolean(
      libfwps_record_t *record,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t value_boolean,
      libcerror_error_t **error )
 {
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_utf16_path_string";
-	uint8_t is_ascii_string                    = 0;
-	int result                                 = 0;
+	uint8_t value_data[ 1 ];
 
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
-		 function );
+	static char *function = "libfwps_record_set_data_as_boolean";
 
-		return( -1 );
+	if( value_boolean != 0 )
+	{
+		value_data[ 0 ] = 0xff;
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( ( internal_record->value_type != LIBFWPS_VALUE_TYPE_BINARY_STRING )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	 && ( internal_record->value_type != LIBFWPS_VALUE_TYPE_STRING_UNICODE ) )
+	else
+	{
+		value_data[ 0 ] = 0;
+	}
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_BOOLEAN,
+	     value_data,
+	     1,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
+		 function );
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	return( 1 );
+}
+
+/* Sets the data as a 32-bit integer value
+ * The value type is set to VT_UI4
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_set_data_as_32bit_integer(
+     libfwps_record_t *record,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 ];
+
+	static char *function = "libfwps_record_set_data_as_32bit_integer";
+
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 value_32bit );
+
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED,
+	     value_data,
+	     4,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( utf16_string_size == 0 )
-	 || ( utf16_string_size > (size_t) SSIZE_MAX ) )
+	return( 1 );
+}
+
+/* Sets the data as a 64-bit integer value
+ * The value type is set to VT_UI8
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_set_data_as_64bit_integer(
+     libfwps_record_t *record,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	static char *function = "libfwps_record_set_data_as_64bit_integer";
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 value_64bit );
+
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED,
+	     value_data,
+	     8,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-16 string size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_record->value_data == NULL )
-	 || ( internal_record->value_data_size == 0 ) )
-	{
-		utf16_string[ 0 ] = 0;
+	return( 1 );
+}
 
-		return( 1 );
-	}
-	if( internal_record->value_type == LIBFWPS_VALUE_TYPE_STRING_ASCII )
-	{
-		is_ascii_string = 1;
-	}
-	/* String is in UTF-16 little-endian
-	 */
-	if( is_ascii_string == 0 )
-	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
-		          error );
-	}
-	/* Codepage 65000 represents UTF-7
-	 */
-	else if( internal_record->ascii_codepage == 65000 )
-	{
-		result = libuna_utf16_string_copy_from_utf7_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
-	}
-	/* Codepage 65001 represents UTF-8
-	 */
-	else if( internal_record->ascii_codepage == 65001 )
-	{
-		result = libuna_utf16_string_copy_from_utf8_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          error );
-	}
-	else
-	{
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          utf16_string,
-		          utf16_string_size,
-		          internal_record->value_data,
-		          internal_record->value_data_size,
-		          internal_record->ascii_codepage,
-		          error );
-	}
-	if( result != 1 )
+/* Sets the data as a FILETIME value
+ * The value type is set to VT_FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_set_data_as_filetime(
+     libfwps_record_t *record,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	static char *function = "libfwps_record_set_data_as_filetime";
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 filetime );
+
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_FILETIME,
+	     value_data,
+	     8,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy value data to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
 		 function );
 
 		return( -1 );
@@ -3229,17 +6733,19 @@ int libfwps_record_get_data_as_utf16_path_string(
 	return( 1 );
 }
 
-/* Retrieves the data as a GUID value
+/* Sets the data as an UTF-8 encoded string
+ * The value type is set to VT_LPWSTR
  * Returns 1 if successful or -1 on error
  */
-int libfwps_record_get_data_as_guid(
+int libfwps_record_set_data_as_utf8_string(
      libfwps_record_t *record,
-     uint8_t *guid_data,
-     size_t guid_data_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      libcerror_error_t **error )
 {
-	libfwps_internal_record_t *internal_record = NULL;
-	static char *function                      = "libfwps_record_get_data_as_guid";
+	uint8_t *value_data    = NULL;
+	static char *function  = "libfwps_record_set_data_as_utf8_string";
+	size_t value_data_size = 0;
 
 	if( record == NULL )
 	{
@@ -3247,47 +6753,71 @@ int libfwps_record_get_data_as_guid(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record entry.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	internal_record = (libfwps_internal_record_t *) record;
-
-	if( internal_record->value_type != LIBFWPS_VALUE_TYPE_GUID )
+	if( libfwps_internal_record_copy_utf16_stream_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     LIBFWPS_ALLOCATION_TYPE_VALUE,
+	     &value_data,
+	     &value_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid record entry - unsupported value type: 0x%04" PRIx32 ".",
-		 function,
-		 internal_record->value_type );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data from UTF-8 string.",
+		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_record->value_data == NULL )
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_STRING_UNICODE,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid record entry - missing value data.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_record->value_data_size != 16 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported value data size.",
-		 function );
+	libfwps_allocator_free(
+	 value_data );
 
-		return( -1 );
+	return( 1 );
+
+on_error:
+	if( value_data != NULL )
+	{
+		libfwps_allocator_free(
+		 value_data );
 	}
+	return( -1 );
+}
+
+/* Sets the data as a GUID value
+ * The GUID is a little-endian GUID and is 16 bytes of size
+ * The value type is set to VT_CLSID
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_record_set_data_as_guid(
+     libfwps_record_t *record,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_record_set_data_as_guid";
+
 	if( guid_data == NULL )
 	{
 		libcerror_error_set(
@@ -3299,38 +6829,29 @@ int libfwps_record_get_data_as_guid(
 
 		return( -1 );
 	}
-	if( guid_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: GUID data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( guid_data_size < 16 )
+	if( guid_data_size != 16 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: GUID data size value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
+	if( libfwps_record_set_data(
+	     record,
+	     LIBFWPS_VALUE_TYPE_GUID,
 	     guid_data,
-	     internal_record->value_data,
-	     16 ) == NULL )
+	     16,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy value data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data.",
 		 function );
 
 		return( -1 );
@@ -26,7 +26,10 @@
 #include <types.h>
 
 #include "libfwps_extern.h"
+#include "libfwps_hash.h"
+#include "libfwps_libbfio.h"
 #include "libfwps_libcerror.h"
+#include "libfwps_parse_limits.h"
 #include "libfwps_types.h"
 
 #if defined( __cplusplus )
@@ -77,9 +80,54 @@ struct libfwps_internal_record
 	 */
 	size_t value_data_size;
 
+	/* The number of values of a vector value
+	 */
+	uint32_t number_of_values;
+
+	/* The value data offset relative to the start of the data the record was read from
+	 */
+	off64_t value_data_offset;
+
+	/* The deferred value data in the source byte stream
+	 */
+	const uint8_t *value_data_reference;
+
+	/* The value data file offset
+	 */
+	off64_t value_data_file_offset;
+
+	/* The file IO handle used to read deferred value data
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate the value data is read on demand
+	 */
+	uint8_t has_deferred_value_data;
+
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The value of the set that manages the record, which indicates
+	 * if the records index of the set is up to date
+	 */
+	uint8_t *set_records_index_is_valid;
+
+	/* Value to indicate if the record is read-only
+	 */
+	uint8_t is_read_only;
+
+	/* The parse error code
+	 */
+	int parse_error_code;
+
+	/* The parse error offset relative to the start of the byte stream
+	 */
+	size_t parse_error_offset;
+
+	/* The anomaly flags, which contains LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG values
+	 */
+	uint8_t anomaly_flags;
 };
 
 int libfwps_record_initialize(
@@ -96,6 +144,43 @@ int libfwps_internal_record_free(
      libfwps_internal_record_t **internal_record,
      libcerror_error_t **error );
 
+int libfwps_internal_record_clear(
+     libfwps_internal_record_t *internal_record,
+     uint8_t record_type,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_compare_with_key(
+     libfwps_internal_record_t *internal_record,
+     uint32_t entry_type,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_compare_by_key(
+     libfwps_internal_record_t *first_internal_record,
+     libfwps_internal_record_t *second_internal_record,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_has_variable_size_vector_values(
+     libfwps_internal_record_t *internal_record );
+
+int libfwps_internal_record_get_vector_value_range(
+     libfwps_internal_record_t *internal_record,
+     size_t *data_offset,
+     size_t *vector_value_data_offset,
+     size_t *vector_value_data_size,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_update_hash_context(
+     libfwps_internal_record_t *internal_record,
+     libfwps_hash_context_t *hash_context,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_compare_value(
+     libfwps_internal_record_t *first_internal_record,
+     libfwps_internal_record_t *second_internal_record,
+     libcerror_error_t **error );
+
 int libfwps_record_copy_from_byte_stream(
      libfwps_record_t *record,
      const uint8_t *byte_stream,
@@ -103,6 +188,61 @@ int libfwps_record_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBFWPS_EXTERN \
+int libfwps_record_get_parse_error(
+     libfwps_record_t *record,
+     int *error_code,
+     size_t *error_offset,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_read_byte_stream(
+     libfwps_internal_record_t *internal_record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint8_t read_flags,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_read_file_io_handle(
+     libfwps_internal_record_t *internal_record,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t read_size,
+     uint8_t read_flags,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwps_record_read_file_io_handle(
+     libfwps_record_t *record,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t record_size,
+     size_t value_data_threshold,
+     libfwps_parse_limits_t *parse_limits,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+void libfwps_internal_record_push_diagnostic_event(
+      libfwps_internal_record_t *internal_record,
+      off64_t offset,
+      size64_t size,
+      int result );
+
+int libfwps_record_get_serialized_size(
+     libfwps_record_t *record,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+int libfwps_record_copy_to_byte_stream(
+     libfwps_record_t *record,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_record_get_utf8_entry_name_size(
      libfwps_record_t *record,
@@ -180,6 +320,31 @@ int libfwps_record_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBFWPS_EXTERN \
+int libfwps_record_get_data_pointer(
+     libfwps_record_t *record,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+ssize_t libfwps_record_read_data(
+         libfwps_record_t *record,
+         size_t data_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_patch_value(
+     libfwps_record_t *record,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     off64_t byte_stream_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_record_get_data_as_boolean(
      libfwps_record_t *record,
@@ -287,6 +452,80 @@ int libfwps_record_get_data_as_guid(
      size_t guid_data_size,
      libcerror_error_t **error );
 
+int libfwps_internal_record_set_value_data(
+     libfwps_internal_record_t *internal_record,
+     uint32_t value_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwps_internal_record_copy_utf16_stream_from_utf8_string(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int allocation_type,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_entry_type(
+     libfwps_record_t *record,
+     uint32_t entry_type,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_utf8_entry_name(
+     libfwps_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data(
+     libfwps_record_t *record,
+     uint32_t value_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_boolean(
+     libfwps_record_t *record,
+     uint8_t value_boolean,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_32bit_integer(
+     libfwps_record_t *record,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_64bit_integer(
+     libfwps_record_t *record,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_filetime(
+     libfwps_record_t *record,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_utf8_string(
+     libfwps_record_t *record,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_record_set_data_as_guid(
+     libfwps_record_t *record,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
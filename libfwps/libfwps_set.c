@@ -25,12 +25,20 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libfwps_allocator.h"
+#include "libfwps_anomaly.h"
 #include "libfwps_definitions.h"
+#include "libfwps_diagnostics.h"
+#include "libfwps_format_class_identifier.h"
+#include "libfwps_hash.h"
+#include "libfwps_libbfio.h"
+#include "libfwps_libcdata.h"
 #include "libfwps_libcerror.h"
 #include "libfwps_libcnotify.h"
 #include "libfwps_record.h"
 #include "libfwps_libfguid.h"
 #include "libfwps_set.h"
+#include "libfwps_trace.h"
 #include "libfwps_types.h"
 
 const char *libfwps_serialized_property_set_signature = "1SPS";
@@ -74,8 +82,9 @@ int libfwps_set_initialize(
 
 		return( -1 );
 	}
-	internal_set = memory_allocate_structure(
-	                libfwps_internal_set_t );
+	internal_set = libfwps_allocator_allocate_structure(
+	                libfwps_internal_set_t,
+	                LIBFWPS_ALLOCATION_TYPE_SET );
 
 	if( internal_set == NULL )
 	{
@@ -100,7 +109,7 @@ int libfwps_set_initialize(
 		 "%s: unable to clear set.",
 		 function );
 
-		memory_free(
+		libfwps_allocator_free(
 		 internal_set );
 
 		return( -1 );
@@ -126,7 +135,7 @@ int libfwps_set_initialize(
 on_error:
 	if( internal_set != NULL )
 	{
-		memory_free(
+		libfwps_allocator_free(
 		 internal_set );
 	}
 	return( -1 );
@@ -216,7 +225,43 @@ int libfwps_internal_set_free(
 
 			result = -1;
 		}
-		memory_free(
+		/* The records in the records index array are managed by the records array
+		 */
+		if( ( *internal_set )->records_index_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *internal_set )->records_index_array ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free records index array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_set )->anomalies_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *internal_set )->anomalies_array ),
+			     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free anomalies array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		libfwps_allocator_free(
 		 *internal_set );
 
 		*internal_set = NULL;
@@ -224,33 +269,18 @@ int libfwps_internal_set_free(
 	return( result );
 }
 
-/* Copies a serialized property set from a byte stream
+/* Appends a record to the records array
  * Returns 1 if successful or -1 on error
  */
-int libfwps_set_copy_from_byte_stream(
-     libfwps_set_t *set,
-     const uint8_t *byte_stream,
-     size_t byte_stream_size,
-     int ascii_codepage,
+int libfwps_internal_set_append_record_to_array(
+     libfwps_internal_set_t *internal_set,
+     libfwps_record_t *record,
      libcerror_error_t **error )
 {
-	libfwps_internal_set_t *internal_set = NULL;
-	libfwps_record_t *property_record    = NULL;
-	static char *function                = "libfwps_set_copy_from_byte_stream";
-	size_t byte_stream_offset            = 0;
-	uint32_t record_data_size            = 0;
-	uint8_t property_record_type         = 0;
-	int entry_index                      = 0;
-	int record_index                     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-        system_character_t guid_string[ 48 ];
-
-        libfguid_identifier_t *guid          = NULL;
-	int result                           = 0;
-#endif
+	static char *function = "libfwps_internal_set_append_record_to_array";
+	int entry_index       = 0;
 
-	if( set == NULL )
+	if( internal_set == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -261,331 +291,3136 @@ int libfwps_set_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	internal_set = (libfwps_internal_set_t *) set;
-
-	if( byte_stream == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte stream.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( byte_stream_size < 24 )
-	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	if( libcdata_array_append_entry(
+	     internal_set->records_array,
+	     &entry_index,
+	     (intptr_t *) record,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid byte stream size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record to array.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* Changing the entry type or entry name of the record invalidates the records index
+	 */
+	( (libfwps_internal_record_t *) record )->set_records_index_is_valid = &( internal_set->records_index_is_valid );
+
+	internal_set->records_index_is_valid = 0;
+
+	return( 1 );
+}
+
+/* Compares two records index entries by the entry type or entry name of their records
+ * Entries with the same key are ordered by the index of their record in the records array
+ * Returns -1, 0 or 1 as required by qsort
+ */
+int libfwps_records_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfwps_records_index_entry_t *first_records_index_entry  = NULL;
+	const libfwps_records_index_entry_t *second_records_index_entry = NULL;
+	int result                                                      = 0;
+
+	first_records_index_entry  = (const libfwps_records_index_entry_t *) first_entry;
+	second_records_index_entry = (const libfwps_records_index_entry_t *) second_entry;
+
+	result = libfwps_internal_record_compare_by_key(
+	          (libfwps_internal_record_t *) first_records_index_entry->record,
+	          (libfwps_internal_record_t *) second_records_index_entry->record,
+	          NULL );
+
+	if( result == LIBCDATA_COMPARE_LESS )
 	{
-		libcnotify_printf(
-		 "%s: property set data:\n",
-		 function );
-		libcnotify_print_data(
-		 byte_stream,
-		 24,
-		 0 );
+		return( -1 );
 	}
-#endif
-	if( memory_compare(
-	     &( byte_stream[ byte_stream_offset + 4 ] ),
-	     libfwps_serialized_property_set_signature,
-	     4 ) != 0 )
+	else if( result == LIBCDATA_COMPARE_GREATER )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
-		 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 byte_stream,
-	 internal_set->size );
+	if( first_records_index_entry->record_index < second_records_index_entry->record_index )
+	{
+		return( -1 );
+	}
+	else if( first_records_index_entry->record_index > second_records_index_entry->record_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
 
-	if( memory_copy(
-	     internal_set->identifier,
-	     &( byte_stream[ byte_stream_offset + 8 ] ),
-	     16 ) == NULL )
+/* Builds the records index array
+ * The records are sorted at once, records with the same key are kept
+ * in order of the records array
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_set_build_records_index(
+     libfwps_internal_set_t *internal_set,
+     libcerror_error_t **error )
+{
+	libfwps_records_index_entry_t *records_index_entries = NULL;
+	libfwps_record_t *record                             = NULL;
+	static char *function                                = "libfwps_internal_set_build_records_index";
+	int number_of_records                                = 0;
+	int record_index                                     = 0;
+
+	if( internal_set == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy identifier.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_set->records_index_array == NULL )
 	{
-		libcnotify_printf(
-		 "%s: size\t\t\t\t\t: %" PRIu16 "\n",
-		 function,
-		 internal_set->size );
-
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t: %c%c%c%c\n",
-		 function,
-		 byte_stream[ byte_stream_offset + 4 ],
-		 byte_stream[ byte_stream_offset + 5 ],
-		 byte_stream[ byte_stream_offset + 6 ],
-		 byte_stream[ byte_stream_offset + 7 ] );
-
-		if( libfguid_identifier_initialize(
-		     &guid,
+		if( libcdata_array_initialize(
+		     &( internal_set->records_index_array ),
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create GUID.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfguid_identifier_copy_from_byte_stream(
-		     guid,
-		     internal_set->identifier,
-		     16,
-		     LIBFGUID_ENDIAN_LITTLE,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy byte stream to GUID.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfguid_identifier_copy_to_utf16_string(
-			  guid,
-			  (uint16_t *) guid_string,
-			  48,
-			  LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-			  error );
-#else
-		result = libfguid_identifier_copy_to_utf8_string(
-			  guid,
-			  (uint8_t *) guid_string,
-			  48,
-			  LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy GUID to string.",
+			 "%s: unable to create records index array.",
 			 function );
 
 			goto on_error;
 		}
-		libcnotify_printf(
-		 "%s: format class identifier\t\t: %" PRIs_SYSTEM "\n",
-		 function,
-		 guid_string );
-
-		if( libfguid_identifier_free(
-		     &guid,
+	}
+	else
+	{
+		if( libcdata_array_empty(
+		     internal_set->records_index_array,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free GUID.",
+			 "%s: unable to empty records index array.",
 			 function );
 
 			goto on_error;
 		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	if( ( internal_set->size < 24 )
-	 || ( (size_t) internal_set->size > byte_stream_size ) )
+	if( libcdata_array_get_number_of_entries(
+	     internal_set->records_array,
+	     &number_of_records,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid property set size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
 		 function );
 
 		goto on_error;
 	}
-	byte_stream_offset += 24;
-
-	if( memory_compare(
-	     internal_set->identifier,
-	     libfwps_format_class_identifier_named_properties,
-	     16 ) == 0 )
-	{
-		property_record_type = LIBFWPS_RECORD_TYPE_NAMED;
-	}
-	else
-	{
-		property_record_type = LIBFWPS_RECORD_TYPE_NUMERIC;
-	}
-	while( byte_stream_offset < byte_stream_size )
+	if( number_of_records > 0 )
 	{
-		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		if( (size_t) number_of_records > ( (size_t) SSIZE_MAX / sizeof( libfwps_records_index_entry_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: invalid byte stream size value too small.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of records value exceeds maximum.",
 			 function );
 
 			goto on_error;
 		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ byte_stream_offset ] ),
-		 record_data_size );
+		records_index_entries = (libfwps_records_index_entry_t *) libfwps_allocator_allocate(
+		                                                           sizeof( libfwps_records_index_entry_t ) * (size_t) number_of_records,
+		                                                           LIBFWPS_ALLOCATION_TYPE_INDEX );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: record: %d data size\t\t\t: %" PRIu32 "\n",
-			 function,
-			 record_index,
-			 record_data_size );
-		}
-#endif
-		if( record_data_size == 0 )
-		{
-			break;
-		}
-		if( ( record_data_size > byte_stream_size )
-		 || ( byte_stream_offset > ( byte_stream_size - record_data_size ) ) )
+		if( records_index_entries == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid record: %d data size value out of bounds.",
-			 function,
-			 record_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records index entries.",
+			 function );
 
 			goto on_error;
 		}
-		if( libfwps_record_initialize(
-		     &property_record,
-		     property_record_type,
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_set->records_array,
+			     record_index,
+			     (intptr_t **) &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			records_index_entries[ record_index ].record       = record;
+			records_index_entries[ record_index ].record_index = record_index;
+		}
+		qsort(
+		 records_index_entries,
+		 (size_t) number_of_records,
+		 sizeof( libfwps_records_index_entry_t ),
+		 &libfwps_records_index_entry_compare );
+
+		if( libcdata_array_resize(
+		     internal_set->records_index_array,
+		     number_of_records,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create property record: %d.",
-			 function,
-			 record_index );
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize records index array.",
+			 function );
 
 			goto on_error;
 		}
-		if( libfwps_record_copy_from_byte_stream(
-		     property_record,
-		     &( byte_stream[ byte_stream_offset ] ),
-		     record_data_size,
-		     ascii_codepage,
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_set->records_index_array,
+			     record_index,
+			     (intptr_t *) records_index_entries[ record_index ].record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set record: %d in records index array.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		libfwps_allocator_free(
+		 records_index_entries );
+
+		records_index_entries = NULL;
+	}
+	internal_set->records_index_is_valid = 1;
+
+	return( 1 );
+
+on_error:
+	if( records_index_entries != NULL )
+	{
+		libfwps_allocator_free(
+		 records_index_entries );
+	}
+	if( internal_set->records_index_array != NULL )
+	{
+		libcdata_array_empty(
+		 internal_set->records_index_array,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific record by its entry type or entry name
+ * The records index array is (re)built if it is not up to date
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfwps_internal_set_get_record_by_key(
+     libfwps_internal_set_t *internal_set,
+     uint32_t entry_type,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     libfwps_record_t **record,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *safe_record = NULL;
+	static char *function         = "libfwps_internal_set_get_record_by_key";
+	int first_index               = 0;
+	int last_index                = 0;
+	int middle_index              = 0;
+	int number_of_records         = 0;
+	int result                    = 0;
+
+	if( internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_set->records_index_is_valid == 0 )
+	{
+		if( libfwps_internal_set_build_records_index(
+		     internal_set,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy property record: %d from byte stream.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build records index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_set->records_index_array,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records in index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Search for the first record that matches the key
+	 */
+	first_index = 0;
+	last_index  = number_of_records;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_set->records_index_array,
+		     middle_index,
+		     (intptr_t **) &safe_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d from index.",
 			 function,
-			 record_index );
+			 middle_index );
 
-			goto on_error;
+			return( -1 );
+		}
+		result = libfwps_internal_record_compare_with_key(
+		          (libfwps_internal_record_t *) safe_record,
+		          entry_type,
+		          entry_name,
+		          entry_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare record: %d with key.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		else if( result == LIBCDATA_COMPARE_LESS )
+		{
+			first_index = middle_index + 1;
+		}
+		else
+		{
+			last_index = middle_index;
 		}
-		if( libcdata_array_append_entry(
+	}
+	if( first_index >= number_of_records )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_set->records_index_array,
+	     first_index,
+	     (intptr_t **) &safe_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d from index.",
+		 function,
+		 first_index );
+
+		return( -1 );
+	}
+	result = libfwps_internal_record_compare_with_key(
+	          (libfwps_internal_record_t *) safe_record,
+	          entry_type,
+	          entry_name,
+	          entry_name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare record: %d with key.",
+		 function,
+		 first_index );
+
+		return( -1 );
+	}
+	else if( result != LIBCDATA_COMPARE_EQUAL )
+	{
+		return( 0 );
+	}
+	*record = safe_record;
+
+	return( 1 );
+}
+
+/* Marks a set and its records as read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_set_set_read_only(
+     libfwps_internal_set_t *internal_set,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *record = NULL;
+	static char *function    = "libfwps_internal_set_set_read_only";
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	if( internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_set->records_array,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
 		     internal_set->records_array,
-		     &entry_index,
-		     (intptr_t *) property_record,
+		     record_index,
+		     (intptr_t **) &record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to append record: %d to array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
 			 function,
 			 record_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		property_record = NULL;
+		if( record == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record: %d.",
+			 function,
+			 record_index );
 
-		byte_stream_offset += record_data_size;
+			return( -1 );
+		}
+		( (libfwps_internal_record_t *) record )->is_read_only = 1;
+	}
+	/* The records index is built in advance since a read-only set
+	 * can be used by multiple threads at the same time
+	 */
+	if( internal_set->records_index_is_valid == 0 )
+	{
+		if( libfwps_internal_set_build_records_index(
+		     internal_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build records index.",
+			 function );
 
-		record_index++;
+			return( -1 );
+		}
 	}
-/* TODO print trailing data */
+	internal_set->is_read_only = 1;
+
+	return( 1 );
+}
+
+/* Compares the identifiers of two sets
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwps_internal_set_compare_by_identifier(
+     libfwps_internal_set_t *first_internal_set,
+     libfwps_internal_set_t *second_internal_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_set_compare_by_identifier";
+	int result            = 0;
+
+	if( first_internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first set.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second set.",
+		 function );
+
+		return( -1 );
+	}
+	result = memory_compare(
+	          first_internal_set->identifier,
+	          second_internal_set->identifier,
+	          16 );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Updates a hash context with the content of a set
+ * The records are hashed in the order of the records index, hence the hash
+ * does not depend on the order of the records in the byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_set_update_hash_context(
+     libfwps_internal_set_t *internal_set,
+     libfwps_hash_context_t *hash_context,
+     libcerror_error_t **error )
+{
+	uint8_t number_of_records_data[ 4 ];
+
+	libfwps_record_t *record = NULL;
+	static char *function    = "libfwps_internal_set_update_hash_context";
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	if( internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_set->records_index_is_valid == 0 )
+	{
+		if( libfwps_internal_set_build_records_index(
+		     internal_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build records index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_set->records_index_array,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records in index.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 number_of_records_data,
+	 (uint32_t) number_of_records );
+
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     internal_set->identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash context with identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_hash_context_update(
+	     hash_context,
+	     number_of_records_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash context with number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_set->records_index_array,
+		     record_index,
+		     (intptr_t **) &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d from index.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( libfwps_internal_record_update_hash_context(
+		     (libfwps_internal_record_t *) record,
+		     hash_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context with record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the differences between the records of two sets
+ * The records are matched by their entry type or entry name using the records
+ * index of both sets, hence the order of the records does not matter
+ * A set can be NULL, in which case all the records of the other set are
+ * reported as added or removed
+ * The difference callback function is called for every record that was added,
+ * removed or changed. The callback function returns 1 to continue, 0 to stop
+ * or -1 on error
+ * Returns 1 if successful, 0 if stopped by the callback function or -1 on error
+ */
+int libfwps_internal_set_diff(
+     libfwps_internal_set_t *first_internal_set,
+     libfwps_internal_set_t *second_internal_set,
+     int (*difference_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *first_record,
+            libfwps_record_t *second_record,
+            int difference_type,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *first_record  = NULL;
+	libfwps_record_t *second_record = NULL;
+	const uint8_t *set_identifier   = NULL;
+	static char *function           = "libfwps_internal_set_diff";
+	int difference_type             = 0;
+	int first_number_of_records     = 0;
+	int first_record_index          = 0;
+	int result                      = 0;
+	int second_number_of_records    = 0;
+	int second_record_index         = 0;
+
+	if( ( first_internal_set == NULL )
+	 && ( second_internal_set == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first and second set.",
+		 function );
+
+		return( -1 );
+	}
+	if( difference_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid difference callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_internal_set != NULL )
+	{
+		if( first_internal_set->records_index_is_valid == 0 )
+		{
+			if( libfwps_internal_set_build_records_index(
+			     first_internal_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build records index of first set.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     first_internal_set->records_index_array,
+		     &first_number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records in index of first set.",
+			 function );
+
+			return( -1 );
+		}
+		set_identifier = first_internal_set->identifier;
+	}
+	if( second_internal_set != NULL )
+	{
+		if( second_internal_set->records_index_is_valid == 0 )
+		{
+			if( libfwps_internal_set_build_records_index(
+			     second_internal_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build records index of second set.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     second_internal_set->records_index_array,
+		     &second_number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records in index of second set.",
+			 function );
+
+			return( -1 );
+		}
+		if( set_identifier == NULL )
+		{
+			set_identifier = second_internal_set->identifier;
+		}
+	}
+	/* Both records indexes are sorted by key hence they can be merged
+	 * in a single pass
+	 */
+	while( ( first_record_index < first_number_of_records )
+	    || ( second_record_index < second_number_of_records ) )
+	{
+		first_record  = NULL;
+		second_record = NULL;
+
+		if( first_record_index < first_number_of_records )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     first_internal_set->records_index_array,
+			     first_record_index,
+			     (intptr_t **) &first_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d from index of first set.",
+				 function,
+				 first_record_index );
+
+				return( -1 );
+			}
+		}
+		if( second_record_index < second_number_of_records )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     second_internal_set->records_index_array,
+			     second_record_index,
+			     (intptr_t **) &second_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d from index of second set.",
+				 function,
+				 second_record_index );
+
+				return( -1 );
+			}
+		}
+		if( first_record == NULL )
+		{
+			result = LIBCDATA_COMPARE_GREATER;
+		}
+		else if( second_record == NULL )
+		{
+			result = LIBCDATA_COMPARE_LESS;
+		}
+		else
+		{
+			result = libfwps_internal_record_compare_by_key(
+			          (libfwps_internal_record_t *) first_record,
+			          (libfwps_internal_record_t *) second_record,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare keys of records: %d and %d.",
+				 function,
+				 first_record_index,
+				 second_record_index );
+
+				return( -1 );
+			}
+		}
+		if( result == LIBCDATA_COMPARE_LESS )
+		{
+			difference_type = LIBFWPS_DIFFERENCE_TYPE_REMOVED;
+			second_record   = NULL;
+
+			first_record_index++;
+		}
+		else if( result == LIBCDATA_COMPARE_GREATER )
+		{
+			difference_type = LIBFWPS_DIFFERENCE_TYPE_ADDED;
+			first_record    = NULL;
+
+			second_record_index++;
+		}
+		else
+		{
+			result = libfwps_internal_record_compare_value(
+			          (libfwps_internal_record_t *) first_record,
+			          (libfwps_internal_record_t *) second_record,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare values of records: %d and %d.",
+				 function,
+				 first_record_index,
+				 second_record_index );
+
+				return( -1 );
+			}
+			first_record_index++;
+			second_record_index++;
+
+			if( result == 1 )
+			{
+				continue;
+			}
+			difference_type = LIBFWPS_DIFFERENCE_TYPE_CHANGED;
+		}
+		result = difference_callback_function(
+		          set_identifier,
+		          first_record,
+		          second_record,
+		          difference_type,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: difference callback function failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the set header data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_set_read_header_data(
+     libfwps_internal_set_t *internal_set,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_set_read_header_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	system_character_t guid_string[ 48 ];
+
+	libfguid_identifier_t *guid = NULL;
+	int result                  = 0;
+#endif
+
+	if( internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 24 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: property set data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 24,
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     libfwps_serialized_property_set_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 internal_set->size );
+
+	if( memory_copy(
+	     internal_set->identifier,
+	     &( data[ 8 ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_set->store_sorted_sets_array_is_valid != NULL )
+	{
+		*( internal_set->store_sorted_sets_array_is_valid ) = 0;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: size\t\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 internal_set->size );
+
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: %c%c%c%c\n",
+		 function,
+		 data[ 4 ],
+		 data[ 5 ],
+		 data[ 6 ],
+		 data[ 7 ] );
+
+		if( libfguid_identifier_initialize(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create GUID.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfguid_identifier_copy_from_byte_stream(
+		     guid,
+		     internal_set->identifier,
+		     16,
+		     LIBFGUID_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to GUID.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfguid_identifier_copy_to_utf16_string(
+			  guid,
+			  (uint16_t *) guid_string,
+			  48,
+			  LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+			  error );
+#else
+		result = libfguid_identifier_copy_to_utf8_string(
+			  guid,
+			  (uint8_t *) guid_string,
+			  48,
+			  LIBFGUID_STRING_FORMAT_FLAG_USE_UPPER_CASE | LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy GUID to string.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: format class identifier\t\t: %" PRIs_SYSTEM "\n",
+		 function,
+		 guid_string );
+
+		if( libfguid_identifier_free(
+		     &guid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free GUID.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Copies a serialized property set from a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_copy_from_byte_stream(
+     libfwps_set_t *set,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	libfwps_record_t *property_record    = NULL;
+	static char *function                = "libfwps_set_copy_from_byte_stream";
+	size_t byte_stream_offset            = 0;
+	uint32_t record_data_size            = 0;
+	uint8_t property_record_type         = 0;
+	uint8_t anomaly_flags                = 0;
+	int parse_error_code                 = LIBFWPS_PARSE_ERROR_GENERIC;
+	int record_index                     = 0;
+	int result                           = 0;
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_set->parse_error_offset = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 24 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		internal_set->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		return( -1 );
+	}
+	internal_set->parse_error_code = LIBFWPS_PARSE_ERROR_NONE;
+
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 NULL,
+	 0,
+	 byte_stream_size );
+
+	if( internal_set->anomalies_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     internal_set->anomalies_array,
+		     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty anomalies array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
+	/* A set that is managed by a store shares the total size of the store
+	 */
+	if( internal_set->is_managed == 0 )
+	{
+		internal_set->parse_limits.total_size = 0;
+	}
+	if( libfwps_internal_set_read_header_data(
+	     internal_set,
+	     byte_stream,
+	     byte_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read set header data.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE;
+
+		goto on_error;
+	}
+	if( ( internal_set->size < 24 )
+	 || ( (size_t) internal_set->size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property set size value out of bounds.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+		goto on_error;
+	}
+	byte_stream_offset += 24;
+
+	if( memory_compare(
+	     internal_set->identifier,
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) == 0 )
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NAMED;
+	}
+	else
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NUMERIC;
+	}
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		{
+			if( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_internal_set_append_anomaly(
+				     internal_set,
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     byte_stream_offset,
+				     LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 record_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record: %d data size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 record_index,
+			 record_data_size );
+		}
+#endif
+		if( record_data_size == 0 )
+		{
+			break;
+		}
+		if( ( record_data_size > byte_stream_size )
+		 || ( byte_stream_offset > ( byte_stream_size - record_data_size ) ) )
+		{
+			/* The next record boundary is not known hence the remaining data is skipped
+			 */
+			if( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_internal_set_append_anomaly(
+				     internal_set,
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     byte_stream_offset,
+				     LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d data size value out of bounds.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( internal_set->parse_limits.maximum_number_of_records_per_set > 0 )
+		 && ( record_index >= internal_set->parse_limits.maximum_number_of_records_per_set ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of records value exceeds maximum.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_parse_limits_reserve_size(
+		     &( internal_set->parse_limits ),
+		     (size64_t) sizeof( libfwps_internal_record_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid record: %d size value exceeds maximum total size.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_record_initialize(
+		     &property_record,
+		     property_record_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create property record: %d.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		result = libfwps_internal_record_read_byte_stream(
+		          (libfwps_internal_record_t *) property_record,
+		          &( byte_stream[ byte_stream_offset ] ),
+		          record_data_size,
+		          0,
+		          internal_set->value_data_threshold,
+		          &( internal_set->parse_limits ),
+		          ascii_codepage,
+		          error );
+
+		if( libfwps_diagnostics_is_enabled() )
+		{
+			libfwps_internal_record_push_diagnostic_event(
+			 (libfwps_internal_record_t *) property_record,
+			 internal_set->offset + (off64_t) byte_stream_offset,
+			 (size64_t) record_data_size,
+			 result );
+		}
+		if( ( result != 1 )
+		 && ( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+		 && ( libfwps_anomaly_is_recoverable_parse_error(
+		       ( (libfwps_internal_record_t *) property_record )->parse_error_code ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			if( libfwps_internal_set_append_anomaly(
+			     internal_set,
+			     LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED,
+			     byte_stream_offset,
+			     ( (libfwps_internal_record_t *) property_record )->parse_error_code,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append anomaly.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+				goto on_error;
+			}
+			if( libfwps_internal_record_free(
+			     (libfwps_internal_record_t **) &property_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property record: %d.",
+				 function,
+				 record_index );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+			byte_stream_offset += record_data_size;
+
+			continue;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy property record: %d from byte stream.",
+			 function,
+			 record_index );
+
+			parse_error_code    = ( (libfwps_internal_record_t *) property_record )->parse_error_code;
+			byte_stream_offset += ( (libfwps_internal_record_t *) property_record )->parse_error_offset;
+
+			goto on_error;
+		}
+		if( ( (libfwps_internal_record_t *) property_record )->value_data_offset > 0 )
+		{
+			( (libfwps_internal_record_t *) property_record )->value_data_offset += internal_set->offset + (off64_t) byte_stream_offset;
+		}
+		if( libfwps_internal_set_append_record_to_array(
+		     internal_set,
+		     property_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to append record: %d to array.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+			goto on_error;
+		}
+		property_record = NULL;
+
+		byte_stream_offset += record_data_size;
+
+		record_index++;
+	}
+/* TODO print trailing data */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( libfwps_diagnostics_is_enabled() )
+	{
+		/* The data following the terminator record is not part of the set
+		 */
+		if( byte_stream_offset < ( byte_stream_size - 4 ) )
+		{
+			anomaly_flags = LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG_TRAILING_DATA;
+		}
+		libfwps_diagnostics_push_event(
+		 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_SET,
+		 internal_set->offset,
+		 (size64_t) byte_stream_size,
+		 0,
+		 LIBFWPS_DIAGNOSTIC_DECISION_ACCEPTED,
+		 anomaly_flags,
+		 LIBFWPS_PARSE_ERROR_NONE );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 internal_set->identifier,
+	 0,
+	 byte_stream_size,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	internal_set->parse_error_code   = parse_error_code;
+	internal_set->parse_error_offset = byte_stream_offset;
+
+	if( libfwps_diagnostics_is_enabled() )
+	{
+		libfwps_diagnostics_push_event(
+		 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_SET,
+		 internal_set->offset,
+		 (size64_t) byte_stream_size,
+		 0,
+		 LIBFWPS_DIAGNOSTIC_DECISION_REJECTED,
+		 0,
+		 parse_error_code );
+	}
+
+	if( property_record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &property_record,
+		 NULL );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 internal_set->identifier,
+	 0,
+	 byte_stream_size,
+	 -1 );
+
+	return( -1 );
+}
+
+/* Scans a serialized property set from a byte stream using a record
+ * The record is reused to read each record of the set
+ * Returns 1 if successful, 0 if the scan was stopped by the callback function or -1 on error
+ */
+int libfwps_internal_set_scan_byte_stream(
+     libfwps_record_t *record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwps_internal_set_scan_byte_stream";
+	size_t byte_stream_offset    = 0;
+	uint32_t record_data_size    = 0;
+	uint32_t set_data_size       = 0;
+	uint8_t property_record_type = 0;
+	int record_index             = 0;
+	int result                   = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 24 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( byte_stream[ 4 ] ),
+	     libfwps_serialized_property_set_signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 byte_stream,
+	 set_data_size );
+
+	if( ( set_data_size < 24 )
+	 || ( (size_t) set_data_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property set size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( byte_stream[ 8 ] ),
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) == 0 )
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NAMED;
+	}
+	else
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NUMERIC;
+	}
+	byte_stream_offset = 24;
+
+	while( byte_stream_offset < (size_t) set_data_size )
+	{
+		if( byte_stream_offset > ( (size_t) set_data_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 record_data_size );
+
+		if( record_data_size == 0 )
+		{
+			break;
+		}
+		if( ( record_data_size > set_data_size )
+		 || ( byte_stream_offset > ( (size_t) set_data_size - record_data_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d data size value out of bounds.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( libfwps_internal_record_clear(
+		     (libfwps_internal_record_t *) record,
+		     property_record_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear property record.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwps_internal_record_read_byte_stream(
+		     (libfwps_internal_record_t *) record,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     record_data_size,
+		     0,
+		     0,
+		     NULL,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy property record: %d from byte stream.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		result = record_callback_function(
+		          &( byte_stream[ 8 ] ),
+		          record,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: record callback function failed for record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_offset += record_data_size;
+
+		record_index++;
+	}
+	return( 1 );
+}
+
+/* Scans a serialized property set from a byte stream without creating a set
+ * The record callback function is called for every record with the identifier
+ * of the set, which is a little-endian GUID of 16 bytes, and a record that is
+ * only valid during the call. The callback function returns 1 to continue the
+ * scan, 0 to stop the scan or -1 on error
+ * Returns 1 if successful, 0 if the scan was stopped by the callback function or -1 on error
+ */
+int libfwps_set_scan_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *record = NULL;
+	static char *function    = "libfwps_set_scan_byte_stream";
+	int result               = 0;
+
+	if( libfwps_record_initialize(
+	     &record,
+	     LIBFWPS_RECORD_TYPE_NUMERIC,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property record.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwps_internal_set_scan_byte_stream(
+	          record,
+	          byte_stream,
+	          byte_stream_size,
+	          ascii_codepage,
+	          record_callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan set.",
+		 function );
+	}
+	if( libfwps_internal_record_free(
+	     (libfwps_internal_record_t **) &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property record.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the parse error of the last copy from byte stream
+ * The error code and offset are set even if no error argument was provided
+ * when parsing, hence failed parses do not require any error allocations
+ * The error offset is relative to the start of the byte stream
+ * Returns 1 if successful, 0 if no parse error is available or -1 on error
+ */
+int libfwps_set_get_parse_error(
+     libfwps_set_t *set,
+     int *error_code,
+     size_t *error_offset,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_parse_error";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_set->parse_error_code == LIBFWPS_PARSE_ERROR_NONE )
+	{
+		return( 0 );
+	}
+	*error_code   = internal_set->parse_error_code;
+	*error_offset = internal_set->parse_error_offset;
+
+	return( 1 );
+}
+
+/* Appends an anomaly found while parsing
+ * The byte stream offset is relative to the start of the set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_set_append_anomaly(
+     libfwps_internal_set_t *internal_set,
+     int anomaly_type,
+     size_t byte_stream_offset,
+     int parse_error_code,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_set_append_anomaly";
+
+	if( internal_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_anomaly_append_to_array(
+	     &( internal_set->anomalies_array ),
+	     anomaly_type,
+	     internal_set->offset + (off64_t) byte_stream_offset,
+	     parse_error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append anomaly to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of anomalies found by the last lenient copy from byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_get_number_of_anomalies(
+     libfwps_set_t *set,
+     int *number_of_anomalies,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_number_of_anomalies";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( libfwps_anomaly_array_get_number_of_anomalies(
+	     internal_set->anomalies_array,
+	     number_of_anomalies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of anomalies.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific anomaly found by the last lenient copy from byte stream
+ * The offset is relative to the start of the data the set was read from
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_get_anomaly_by_index(
+     libfwps_set_t *set,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_anomaly_by_index";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( libfwps_anomaly_array_get_anomaly_by_index(
+	     internal_set->anomalies_array,
+	     anomaly_index,
+	     anomaly_type,
+	     offset,
+	     parse_error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve anomaly: %d.",
+		 function,
+		 anomaly_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a serialized property set using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_read_file_io_handle(
+     libfwps_set_t *set,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t set_data_size,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 24 ];
+	uint8_t record_data_size_data[ 4 ];
+
+	libfwps_internal_set_t *internal_set = NULL;
+	libfwps_record_t *property_record    = NULL;
+	static char *function                = "libfwps_set_read_file_io_handle";
+	size_t set_data_offset               = 0;
+	ssize_t read_count                   = 0;
+	uint32_t record_data_size            = 0;
+	uint8_t property_record_type         = 0;
+	uint8_t anomaly_flags                = 0;
+	int parse_error_code                 = LIBFWPS_PARSE_ERROR_GENERIC;
+	int record_index                     = 0;
+	int result                           = 0;
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_set->parse_error_offset = 0;
+
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( set_data_size < 24 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid set data size value out of bounds.",
+		 function );
+
+		internal_set->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		return( -1 );
+	}
+	internal_set->parse_error_code = LIBFWPS_PARSE_ERROR_NONE;
+
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 NULL,
+	 0,
+	 (size_t) set_data_size );
+
+	if( internal_set->anomalies_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     internal_set->anomalies_array,
+		     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty anomalies array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
+	/* A set that is managed by a store shares the total size of the store
+	 */
+	if( internal_set->is_managed == 0 )
+	{
+		internal_set->parse_limits.total_size = 0;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              header_data,
+	              24,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) 24 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read set header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libfwps_internal_set_read_header_data(
+	     internal_set,
+	     header_data,
+	     24,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read set header data.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE;
+
+		goto on_error;
+	}
+	if( ( internal_set->size < 24 )
+	 || ( internal_set->size > set_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid property set size value out of bounds.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+		goto on_error;
+	}
+	set_data_offset += 24;
+
+	if( memory_compare(
+	     internal_set->identifier,
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) == 0 )
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NAMED;
+	}
+	else
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NUMERIC;
+	}
+	while( set_data_offset < set_data_size )
+	{
+		if( set_data_offset > ( set_data_size - 4 ) )
+		{
+			if( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_internal_set_append_anomaly(
+				     internal_set,
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     set_data_offset,
+				     LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid set data size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              record_data_size_data,
+		              4,
+		              file_offset + set_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d data size.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 record_data_size_data,
+		 record_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record: %d data size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 record_index,
+			 record_data_size );
+		}
+#endif
+		if( record_data_size == 0 )
+		{
+			break;
+		}
+		if( ( record_data_size > set_data_size )
+		 || ( set_data_offset > ( set_data_size - record_data_size ) ) )
+		{
+			/* The next record boundary is not known hence the remaining data is skipped
+			 */
+			if( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_internal_set_append_anomaly(
+				     internal_set,
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     set_data_offset,
+				     LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record: %d data size value out of bounds.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( internal_set->parse_limits.maximum_number_of_records_per_set > 0 )
+		 && ( record_index >= internal_set->parse_limits.maximum_number_of_records_per_set ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of records value exceeds maximum.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_parse_limits_reserve_size(
+		     &( internal_set->parse_limits ),
+		     (size64_t) sizeof( libfwps_internal_record_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid record: %d size value exceeds maximum total size.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_record_initialize(
+		     &property_record,
+		     property_record_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create property record: %d.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		result = libfwps_record_read_file_io_handle(
+		          property_record,
+		          file_io_handle,
+		          file_offset + set_data_offset,
+		          record_data_size,
+		          internal_set->value_data_threshold,
+		          &( internal_set->parse_limits ),
+		          ascii_codepage,
+		          error );
+
+		if( libfwps_diagnostics_is_enabled() )
+		{
+			libfwps_internal_record_push_diagnostic_event(
+			 (libfwps_internal_record_t *) property_record,
+			 file_offset + (off64_t) set_data_offset,
+			 (size64_t) record_data_size,
+			 result );
+		}
+		if( ( result != 1 )
+		 && ( ( internal_set->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+		 && ( libfwps_anomaly_is_recoverable_parse_error(
+		       ( (libfwps_internal_record_t *) property_record )->parse_error_code ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			if( libfwps_internal_set_append_anomaly(
+			     internal_set,
+			     LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED,
+			     set_data_offset,
+			     ( (libfwps_internal_record_t *) property_record )->parse_error_code,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append anomaly.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+				goto on_error;
+			}
+			if( libfwps_internal_record_free(
+			     (libfwps_internal_record_t **) &property_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free property record: %d.",
+				 function,
+				 record_index );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+			set_data_offset += record_data_size;
+
+			continue;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read property record: %d.",
+			 function,
+			 record_index );
+
+			parse_error_code = ( (libfwps_internal_record_t *) property_record )->parse_error_code;
+			set_data_offset += ( (libfwps_internal_record_t *) property_record )->parse_error_offset;
+
+			goto on_error;
+		}
+		if( libfwps_internal_set_append_record_to_array(
+		     internal_set,
+		     property_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to append record: %d to array.",
+			 function,
+			 record_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+			goto on_error;
+		}
+		property_record = NULL;
+
+		set_data_offset += record_data_size;
+
+		record_index++;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( libfwps_diagnostics_is_enabled() )
+	{
+		/* The data following the terminator record is not part of the set
+		 */
+		if( set_data_offset < ( (size_t) set_data_size - 4 ) )
+		{
+			anomaly_flags = LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG_TRAILING_DATA;
+		}
+		libfwps_diagnostics_push_event(
+		 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_SET,
+		 file_offset,
+		 (size64_t) set_data_size,
+		 0,
+		 LIBFWPS_DIAGNOSTIC_DECISION_ACCEPTED,
+		 anomaly_flags,
+		 LIBFWPS_PARSE_ERROR_NONE );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 internal_set->identifier,
+	 0,
+	 (size_t) set_data_size,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	internal_set->parse_error_code   = parse_error_code;
+	internal_set->parse_error_offset = set_data_offset;
+
+	if( libfwps_diagnostics_is_enabled() )
+	{
+		libfwps_diagnostics_push_event(
+		 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_SET,
+		 file_offset,
+		 (size64_t) set_data_size,
+		 0,
+		 LIBFWPS_DIAGNOSTIC_DECISION_REJECTED,
+		 0,
+		 parse_error_code );
+	}
+	if( property_record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &property_record,
+		 NULL );
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_SET,
+	 internal_set->identifier,
+	 0,
+	 (size_t) set_data_size,
+	 -1 );
+
+	return( -1 );
+}
+
+/* Sets the value data threshold
+ * Binary data, stream and vector value data larger than the threshold is not copied
+ * but read on demand from the source byte stream or file IO handle,
+ * which must remain available while the set is used
+ * A threshold of 0 disables deferred reading of value data, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_set_value_data_threshold(
+     libfwps_set_t *set,
+     size_t value_data_threshold,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_set_value_data_threshold";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_threshold > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data threshold value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set->value_data_threshold = value_data_threshold;
+
+	return( 1 );
+}
+
+/* Sets the parse limits
+ * The limits apply to subsequent reads of the set, where a read that exceeds
+ * a limit fails before the corresponding memory is allocated
+ * The maximum total size covers the records, names and value data
+ * A limit of 0 represents no limit, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_set_parse_limits(
+     libfwps_set_t *set,
+     size64_t maximum_total_size,
+     int maximum_number_of_records,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_set_parse_limits";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_parse_limits_set(
+	     &( internal_set->parse_limits ),
+	     maximum_total_size,
+	     0,
+	     maximum_number_of_records,
+	     maximum_number_of_vector_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parse limits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the parse flags
+ * If LIBFWPS_PARSE_FLAG_LENIENT is set a copy from byte stream skips records
+ * that cannot be parsed and stops at data that is truncated, instead of
+ * failing, and records an anomaly for each
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_set_parse_flags(
+     libfwps_set_t *set,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_set_parse_flags";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_flags & ~( LIBFWPS_PARSE_FLAG_LENIENT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags: 0x%02" PRIx8 ".",
+		 function,
+		 parse_flags );
+
+		return( -1 );
+	}
+	internal_set->parse_flags = parse_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier
+ * The identifier is a little-endian GUID and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_get_identifier(
+     libfwps_set_t *set,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_identifier";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     internal_set->identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_get_number_of_records(
+     libfwps_set_t *set,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_number_of_records";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_set->records_array,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_set_get_record_by_index(
+     libfwps_set_t *set,
+     int record_index,
+     libfwps_record_t **record,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_record_by_index";
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_set->records_array,
+	     record_index,
+	     (intptr_t **) record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific record by its entry type
+ * This function is only supported for sets of numeric records
+ * The records are looked up using an index that is built on first use
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfwps_set_get_record_by_entry_type(
+     libfwps_set_t *set,
+     uint32_t entry_type,
+     libfwps_record_t **record,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	static char *function                = "libfwps_set_get_record_by_entry_type";
+	int result                           = 0;
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( memory_compare(
+	     internal_set->identifier,
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported set of named records.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwps_internal_set_get_record_by_key(
+	          internal_set,
+	          entry_type,
+	          NULL,
+	          0,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: 0x%08" PRIx32 ".",
+		 function,
+		 entry_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific record by its UTF-8 encoded entry name
+ * This function is only supported for sets of named records
+ * The records are looked up using an index that is built on first use
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfwps_set_get_record_by_utf8_entry_name(
+     libfwps_set_t *set,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfwps_record_t **record,
+     libcerror_error_t **error )
+{
+	libfwps_internal_set_t *internal_set = NULL;
+	uint8_t *entry_name                  = NULL;
+	static char *function                = "libfwps_set_get_record_by_utf8_entry_name";
+	size_t entry_name_size               = 0;
+	int result                           = 0;
+
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_set = (libfwps_internal_set_t *) set;
+
+	if( memory_compare(
+	     internal_set->identifier,
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported set of numeric records.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry names are stored as UTF-16 little-endian streams
+	 */
+	if( libfwps_internal_record_copy_utf16_stream_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     LIBFWPS_ALLOCATION_TYPE_NAME,
+	     &entry_name,
+	     &entry_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name from UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfwps_internal_set_get_record_by_key(
+	          internal_set,
+	          0,
+	          entry_name,
+	          entry_name_size,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record by entry name.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
+		goto on_error;
 	}
-#endif
-	return( 1 );
+	libfwps_allocator_free(
+	 entry_name );
+
+	return( result );
 
 on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( guid != NULL )
-	{
-		libfguid_identifier_free(
-		 &guid,
-		 NULL );
-	}
-#endif
-	if( property_record != NULL )
+	if( entry_name != NULL )
 	{
-		libfwps_internal_record_free(
-		 (libfwps_internal_record_t **) &property_record,
-		 NULL );
+		libfwps_allocator_free(
+		 entry_name );
 	}
 	return( -1 );
 }
 
-/* Retrieves the identifier
- * The identifier is a little-endian GUID and is 16 bytes of size
+/* Appends a new record
+ * The record type is determined by the identifier of the set
+ * The record is managed by the set and is set to VT_NULL
  * Returns 1 if successful or -1 on error
  */
-int libfwps_set_get_identifier(
+int libfwps_set_append_record(
      libfwps_set_t *set,
-     uint8_t *guid_data,
-     size_t guid_data_size,
+     libfwps_record_t **record,
      libcerror_error_t **error )
 {
 	libfwps_internal_set_t *internal_set = NULL;
-	static char *function                = "libfwps_set_get_identifier";
+	libfwps_record_t *property_record    = NULL;
+	static char *function                = "libfwps_set_append_record";
+	uint8_t property_record_type         = 0;
 
 	if( set == NULL )
 	{
@@ -600,56 +3435,109 @@ int libfwps_set_get_identifier(
 	}
 	internal_set = (libfwps_internal_set_t *) set;
 
-	if( guid_data == NULL )
+	if( internal_set->is_read_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid set - set is read-only.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid GUID data.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( guid_data_size < 16 )
-	 || ( guid_data_size > SSIZE_MAX ) )
+	if( *record != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid GUID data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     guid_data,
+	if( memory_compare(
 	     internal_set->identifier,
-	     16 ) == NULL )
+	     libfwps_format_class_identifier_named_properties,
+	     16 ) == 0 )
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NAMED;
+	}
+	else
+	{
+		property_record_type = LIBFWPS_RECORD_TYPE_NUMERIC;
+	}
+	if( libfwps_record_initialize(
+	     &property_record,
+	     property_record_type,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy identifier.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property record.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	( (libfwps_internal_record_t *) property_record )->value_type = LIBFWPS_VALUE_TYPE_NULL;
+
+	if( libfwps_internal_set_append_record_to_array(
+	     internal_set,
+	     property_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record to array.",
+		 function );
+
+		goto on_error;
 	}
+	*record = property_record;
+
 	return( 1 );
+
+on_error:
+	if( property_record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &property_record,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the number of records
+/* Retrieves the size of the set when serialized
  * Returns 1 if successful or -1 on error
  */
-int libfwps_set_get_number_of_records(
+int libfwps_set_get_serialized_size(
      libfwps_set_t *set,
-     int *number_of_records,
+     size_t *serialized_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_set_t *internal_set = NULL;
-	static char *function                = "libfwps_set_get_number_of_records";
+	libfwps_record_t *property_record    = NULL;
+	static char *function                = "libfwps_set_get_serialized_size";
+	size_t record_size                   = 0;
+	size_t safe_serialized_size          = 0;
+	int number_of_records                = 0;
+	int record_index                     = 0;
 
 	if( set == NULL )
 	{
@@ -664,9 +3552,20 @@ int libfwps_set_get_number_of_records(
 	}
 	internal_set = (libfwps_internal_set_t *) set;
 
+	if( serialized_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_set->records_array,
-	     number_of_records,
+	     &number_of_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -678,20 +3577,81 @@ int libfwps_set_get_number_of_records(
 
 		return( -1 );
 	}
+	/* The set header and the record list terminator
+	 */
+	safe_serialized_size = 24 + 4;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_set->records_array,
+		     record_index,
+		     (intptr_t **) &property_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( libfwps_record_get_serialized_size(
+		     property_record,
+		     &record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d serialized size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( record_size > ( (size_t) UINT32_MAX - safe_serialized_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid serialized size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_serialized_size += record_size;
+	}
+	*serialized_size = safe_serialized_size;
+
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Copies the set to a byte stream
+ * The byte stream must be at least the size returned by libfwps_set_get_serialized_size
  * Returns 1 if successful or -1 on error
  */
-int libfwps_set_get_record_by_index(
+int libfwps_set_copy_to_byte_stream(
      libfwps_set_t *set,
-     int record_index,
-     libfwps_record_t **record,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
      libcerror_error_t **error )
 {
 	libfwps_internal_set_t *internal_set = NULL;
-	static char *function                = "libfwps_set_get_record_by_index";
+	libfwps_record_t *property_record    = NULL;
+	static char *function                = "libfwps_set_copy_to_byte_stream";
+	size_t byte_stream_offset            = 0;
+	size_t record_size                   = 0;
+	size_t serialized_size               = 0;
+	int number_of_records                = 0;
+	int record_index                     = 0;
 
 	if( set == NULL )
 	{
@@ -706,22 +3666,158 @@ int libfwps_set_get_record_by_index(
 	}
 	internal_set = (libfwps_internal_set_t *) set;
 
-	if( libcdata_array_get_entry_by_index(
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_set_get_serialized_size(
+	     set,
+	     &serialized_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < serialized_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
 	     internal_set->records_array,
-	     record_index,
-	     (intptr_t **) record,
+	     &number_of_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record: %d.",
-		 function,
-		 record_index );
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 byte_stream,
+	 (uint32_t) serialized_size );
+
+	if( memory_copy(
+	     &( byte_stream[ 4 ] ),
+	     libfwps_serialized_property_set_signature,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( byte_stream[ 8 ] ),
+	     internal_set->identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
 
 		return( -1 );
 	}
+	byte_stream_offset = 24;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_set->records_array,
+		     record_index,
+		     (intptr_t **) &property_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( libfwps_record_get_serialized_size(
+		     property_record,
+		     &record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d serialized size.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( libfwps_record_copy_to_byte_stream(
+		     property_record,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy record: %d to byte stream.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += record_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 0 );
+
 	return( 1 );
 }
 
@@ -26,14 +26,30 @@
 #include <types.h>
 
 #include "libfwps_extern.h"
+#include "libfwps_hash.h"
+#include "libfwps_libbfio.h"
 #include "libfwps_libcdata.h"
 #include "libfwps_libcerror.h"
+#include "libfwps_parse_limits.h"
 #include "libfwps_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libfwps_records_index_entry libfwps_records_index_entry_t;
+
+struct libfwps_records_index_entry
+{
+	/* The record
+	 */
+	libfwps_record_t *record;
+
+	/* The index of the record in the records array
+	 */
+	int record_index;
+};
+
 typedef struct libfwps_internal_set libfwps_internal_set_t;
 
 struct libfwps_internal_set
@@ -46,13 +62,59 @@ struct libfwps_internal_set
 	 */
 	uint8_t identifier[ 16 ];
 
+	/* The offset of the set relative to the start of the data the store was read from
+	 */
+	off64_t offset;
+
 	/* The records array
 	 */
 	libcdata_array_t *records_array;
 
+	/* The records index array, which contains the records sorted by entry type
+	 * or entry name
+	 */
+	libcdata_array_t *records_index_array;
+
+	/* Value to indicate the records index array is up to date
+	 */
+	uint8_t records_index_is_valid;
+
+	/* The value of the store that manages the set, which indicates
+	 * if the sorted sets array of the store is up to date
+	 */
+	uint8_t *store_sorted_sets_array_is_valid;
+
+	/* The value data threshold
+	 */
+	size_t value_data_threshold;
+
 	/* Value to indicate if the set is managed by a store
 	 */
 	uint8_t is_managed;
+
+	/* Value to indicate if the set and its records are read-only
+	 */
+	uint8_t is_read_only;
+
+	/* The parse limits
+	 */
+	libfwps_parse_limits_t parse_limits;
+
+	/* The parse flags
+	 */
+	uint8_t parse_flags;
+
+	/* The anomalies array, which is NULL if no anomalies were found
+	 */
+	libcdata_array_t *anomalies_array;
+
+	/* The parse error code
+	 */
+	int parse_error_code;
+
+	/* The parse error offset relative to the start of the byte stream
+	 */
+	size_t parse_error_offset;
 };
 
 LIBFWPS_EXTERN \
@@ -69,6 +131,12 @@ int libfwps_internal_set_free(
      libfwps_internal_set_t **internal_set,
      libcerror_error_t **error );
 
+int libfwps_internal_set_read_header_data(
+     libfwps_internal_set_t *internal_set,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_set_copy_from_byte_stream(
      libfwps_set_t *set,
@@ -77,6 +145,89 @@ int libfwps_set_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwps_internal_set_scan_byte_stream(
+     libfwps_record_t *record,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_scan_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_get_parse_error(
+     libfwps_set_t *set,
+     int *error_code,
+     size_t *error_offset,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_append_anomaly(
+     libfwps_internal_set_t *internal_set,
+     int anomaly_type,
+     size_t byte_stream_offset,
+     int parse_error_code,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_get_number_of_anomalies(
+     libfwps_set_t *set,
+     int *number_of_anomalies,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_get_anomaly_by_index(
+     libfwps_set_t *set,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error );
+
+int libfwps_set_read_file_io_handle(
+     libfwps_set_t *set,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t set_data_size,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_set_value_data_threshold(
+     libfwps_set_t *set,
+     size_t value_data_threshold,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_set_parse_limits(
+     libfwps_set_t *set,
+     size64_t maximum_total_size,
+     int maximum_number_of_records,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_set_parse_flags(
+     libfwps_set_t *set,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_set_get_identifier(
      libfwps_set_t *set,
@@ -84,6 +235,54 @@ int libfwps_set_get_identifier(
      size_t guid_data_size,
      libcerror_error_t **error );
 
+int libfwps_internal_set_append_record_to_array(
+     libfwps_internal_set_t *internal_set,
+     libfwps_record_t *record,
+     libcerror_error_t **error );
+
+int libfwps_records_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfwps_internal_set_build_records_index(
+     libfwps_internal_set_t *internal_set,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_get_record_by_key(
+     libfwps_internal_set_t *internal_set,
+     uint32_t entry_type,
+     const uint8_t *entry_name,
+     size_t entry_name_size,
+     libfwps_record_t **record,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_set_read_only(
+     libfwps_internal_set_t *internal_set,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_compare_by_identifier(
+     libfwps_internal_set_t *first_internal_set,
+     libfwps_internal_set_t *second_internal_set,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_update_hash_context(
+     libfwps_internal_set_t *internal_set,
+     libfwps_hash_context_t *hash_context,
+     libcerror_error_t **error );
+
+int libfwps_internal_set_diff(
+     libfwps_internal_set_t *first_internal_set,
+     libfwps_internal_set_t *second_internal_set,
+     int (*difference_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *first_record,
+            libfwps_record_t *second_record,
+            int difference_type,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_set_get_number_of_records(
      libfwps_set_t *set,
@@ -97,6 +296,40 @@ int libfwps_set_get_record_by_index(
      libfwps_record_t **record,
      libcerror_error_t **error );
 
+LIBFWPS_EXTERN \
+int libfwps_set_get_record_by_entry_type(
+     libfwps_set_t *set,
+     uint32_t entry_type,
+     libfwps_record_t **record,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_get_record_by_utf8_entry_name(
+     libfwps_set_t *set,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfwps_record_t **record,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_append_record(
+     libfwps_set_t *set,
+     libfwps_record_t **record,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_get_serialized_size(
+     libfwps_set_t *set,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_set_copy_to_byte_stream(
+     libfwps_set_t *set,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
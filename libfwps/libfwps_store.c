@@ -24,12 +24,20 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwps_allocator.h"
+#include "libfwps_anomaly.h"
+#include "libfwps_definitions.h"
+#include "libfwps_hash.h"
+#include "libfwps_libbfio.h"
 #include "libfwps_libcdata.h"
 #include "libfwps_libcerror.h"
 #include "libfwps_libcnotify.h"
+#include "libfwps_record.h"
 #include "libfwps_set.h"
 #include "libfwps_store.h"
+#include "libfwps_trace.h"
 #include "libfwps_types.h"
+#include "libfwps_unused.h"
 
 /* Creates a store
  * Make sure the value store is referencing, is set to NULL
@@ -64,8 +72,9 @@ int libfwps_store_initialize(
 
 		return( -1 );
 	}
-	internal_store = memory_allocate_structure(
-	                  libfwps_internal_store_t );
+	internal_store = libfwps_allocator_allocate_structure(
+	                  libfwps_internal_store_t,
+	                  LIBFWPS_ALLOCATION_TYPE_STORE );
 
 	if( internal_store == NULL )
 	{
@@ -90,7 +99,7 @@ int libfwps_store_initialize(
 		 "%s: unable to clear store.",
 		 function );
 
-		memory_free(
+		libfwps_allocator_free(
 		 internal_store );
 
 		return( -1 );
@@ -116,13 +125,14 @@ int libfwps_store_initialize(
 on_error:
 	if( internal_store != NULL )
 	{
-		memory_free(
+		libfwps_allocator_free(
 		 internal_store );
 	}
 	return( -1 );
 }
 
 /* Frees a store
+ * A store that is managed by a store cache is not freed
  * Returns 1 if successful or -1 on error
  */
 int libfwps_store_free(
@@ -147,10 +157,53 @@ int libfwps_store_free(
 	if( *store != NULL )
 	{
 		internal_store = (libfwps_internal_store_t *) *store;
-		*store         = NULL;
 
+		if( internal_store->is_managed == 0 )
+		{
+			if( libfwps_internal_store_free(
+			     &internal_store,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free store.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*store = NULL;
+	}
+	return( result );
+}
+
+/* Frees a store
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_store_free(
+     libfwps_internal_store_t **internal_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_store_free";
+	int result            = 1;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *internal_store != NULL )
+	{
 		if( libcdata_array_free(
-		     &( internal_store->sets_array ),
+		     &( ( *internal_store )->sets_array ),
 		     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_internal_set_free,
 		     error ) != 1 )
 		{
@@ -163,8 +216,44 @@ int libfwps_store_free(
 
 			result = -1;
 		}
-		memory_free(
-		 internal_store );
+		if( ( *internal_store )->sorted_sets_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *internal_store )->sorted_sets_array ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sorted sets array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_store )->anomalies_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *internal_store )->anomalies_array ),
+			     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free anomalies array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		libfwps_allocator_free(
+		 *internal_store );
+
+		*internal_store = NULL;
 	}
 	return( result );
 }
@@ -185,6 +274,8 @@ int libfwps_store_copy_from_byte_stream(
 	size_t byte_stream_offset                = 0;
 	uint32_t set_data_size                   = 0;
 	int entry_index                          = 0;
+	int parse_error_code                     = LIBFWPS_PARSE_ERROR_GENERIC;
+	int result                               = 0;
 	int set_index                            = 0;
 
 	if( store == NULL )
@@ -200,6 +291,21 @@ int libfwps_store_copy_from_byte_stream(
 	}
 	internal_store = (libfwps_internal_store_t *) store;
 
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	internal_store->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_store->parse_error_offset = 0;
+
 	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
@@ -221,12 +327,62 @@ int libfwps_store_copy_from_byte_stream(
 		 "%s: invalid byte stream size value out of bounds.",
 		 function );
 
+		internal_store->parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
 		return( -1 );
 	}
+	internal_store->parse_error_code        = LIBFWPS_PARSE_ERROR_NONE;
+	internal_store->parse_limits.total_size = 0;
+
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 byte_stream_size );
+
+	if( internal_store->anomalies_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     internal_store->anomalies_array,
+		     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty anomalies array.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( byte_stream_offset < byte_stream_size )
 	{
 		if( byte_stream_offset > ( byte_stream_size - 4 ) )
 		{
+			if( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_anomaly_append_to_array(
+				     &( internal_store->anomalies_array ),
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     (off64_t) byte_stream_offset,
+				     LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
@@ -234,6 +390,8 @@ int libfwps_store_copy_from_byte_stream(
 			 "%s: invalid byte stream size value too small.",
 			 function );
 
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
 			goto on_error;
 		}
 		byte_stream_copy_to_uint32_little_endian(
@@ -257,6 +415,30 @@ int libfwps_store_copy_from_byte_stream(
 		if( ( set_data_size > byte_stream_size )
 		 || ( byte_stream_offset > ( byte_stream_size - set_data_size ) ) )
 		{
+			/* The next set boundary is not known hence the remaining data is skipped
+			 */
+			if( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_anomaly_append_to_array(
+				     &( internal_store->anomalies_array ),
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     (off64_t) byte_stream_offset,
+				     LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
@@ -265,6 +447,39 @@ int libfwps_store_copy_from_byte_stream(
 			 function,
 			 set_index );
 
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( internal_store->parse_limits.maximum_number_of_sets > 0 )
+		 && ( set_index >= internal_store->parse_limits.maximum_number_of_sets ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sets value exceeds maximum.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_parse_limits_reserve_size(
+		     &( internal_store->parse_limits ),
+		     (size64_t) sizeof( libfwps_internal_set_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid set: %d size value exceeds maximum total size.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
 			goto on_error;
 		}
 		if( libfwps_set_initialize(
@@ -279,16 +494,70 @@ int libfwps_store_copy_from_byte_stream(
 			 function,
 			 set_index );
 
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
 			goto on_error;
 		}
-		( (libfwps_internal_set_t *) set )->is_managed = 1;
+		( (libfwps_internal_set_t *) set )->offset               = (off64_t) byte_stream_offset;
+		( (libfwps_internal_set_t *) set )->is_managed           = 1;
+		( (libfwps_internal_set_t *) set )->value_data_threshold = internal_store->value_data_threshold;
+		( (libfwps_internal_set_t *) set )->parse_limits         = internal_store->parse_limits;
+		( (libfwps_internal_set_t *) set )->parse_flags          = internal_store->parse_flags;
 
-		if( libfwps_set_copy_from_byte_stream(
-		     set,
-		     &( byte_stream[ byte_stream_offset ] ),
-		     (size_t) set_data_size,
-		     ascii_codepage,
-		     error ) != 1 )
+		result = libfwps_set_copy_from_byte_stream(
+		          set,
+		          &( byte_stream[ byte_stream_offset ] ),
+		          (size_t) set_data_size,
+		          ascii_codepage,
+		          error );
+
+		if( ( result != 1 )
+		 && ( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+		 && ( libfwps_anomaly_is_recoverable_parse_error(
+		       ( (libfwps_internal_set_t *) set )->parse_error_code ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			if( libfwps_anomaly_append_to_array(
+			     &( internal_store->anomalies_array ),
+			     LIBFWPS_ANOMALY_TYPE_SET_SKIPPED,
+			     (off64_t) byte_stream_offset,
+			     ( (libfwps_internal_set_t *) set )->parse_error_code,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append anomaly.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+				goto on_error;
+			}
+			if( libfwps_internal_set_free(
+			     (libfwps_internal_set_t **) &set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free set: %d.",
+				 function,
+				 set_index );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+			byte_stream_offset += set_data_size;
+
+			continue;
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -298,6 +567,28 @@ int libfwps_store_copy_from_byte_stream(
 			 function,
 			 set_index );
 
+			parse_error_code    = ( (libfwps_internal_set_t *) set )->parse_error_code;
+			byte_stream_offset += ( (libfwps_internal_set_t *) set )->parse_error_offset;
+
+			goto on_error;
+		}
+		internal_store->parse_limits.total_size = ( (libfwps_internal_set_t *) set )->parse_limits.total_size;
+
+		if( libfwps_anomaly_append_array_to_array(
+		     &( internal_store->anomalies_array ),
+		     ( (libfwps_internal_set_t *) set )->anomalies_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append anomalies of set: %d.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
 			goto on_error;
 		}
 		if( libcdata_array_append_entry(
@@ -314,17 +605,35 @@ int libfwps_store_copy_from_byte_stream(
 			 function,
 			 set_index );
 
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
 			goto on_error;
 		}
+		/* Changing the identifier of the set invalidates the sorted sets array
+		 */
+		( (libfwps_internal_set_t *) set )->store_sorted_sets_array_is_valid = &( internal_store->sorted_sets_array_is_valid );
+
+		internal_store->sorted_sets_array_is_valid = 0;
+
 		set = NULL;
 
 		byte_stream_offset += set_data_size;
 
 		set_index++;
 	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 byte_stream_size,
+	 1 );
+
 	return( 1 );
 
 on_error:
+	internal_store->parse_error_code   = parse_error_code;
+	internal_store->parse_error_offset = byte_stream_offset;
+
 	if( set != NULL )
 	{
 		libfwps_internal_set_free(
@@ -336,61 +645,195 @@ on_error:
 	 (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_internal_set_free,
 	 NULL );
 
+	internal_store->sorted_sets_array_is_valid = 0;
+
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 byte_stream_size,
+	 -1 );
+
 	return( -1 );
 }
 
-/* Retrieves the number of sets
- * Returns 1 if successful or -1 on error
+/* Scans a serialized store from a byte stream without creating a store
+ * The record callback function is called for every record of every set
+ * as described by libfwps_set_scan_byte_stream
+ * Returns 1 if successful, 0 if the scan was stopped by the callback function or -1 on error
  */
-int libfwps_store_get_number_of_sets(
-     libfwps_store_t *store,
-     int *number_of_sets,
+int libfwps_store_scan_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      libcerror_error_t **error )
 {
-	libfwps_internal_store_t *internal_store = NULL;
-	static char *function                    = "libfwps_store_get_number_of_sets";
+	libfwps_record_t *record  = NULL;
+	static char *function     = "libfwps_store_scan_byte_stream";
+	size_t byte_stream_offset = 0;
+	uint32_t set_data_size    = 0;
+	int result                = 1;
+	int set_index             = 0;
 
-	if( store == NULL )
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid store.",
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	internal_store = (libfwps_internal_store_t *) store;
+	if( ( byte_stream_size < 4 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_store->sets_array,
-	     number_of_sets,
+		return( -1 );
+	}
+	if( record_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record callback function.",
+		 function );
+
+		return( -1 );
+	}
+	/* A single record is reused for all the records in the store
+	 */
+	if( libfwps_record_initialize(
+	     &record,
+	     LIBFWPS_RECORD_TYPE_NUMERIC,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sets.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property record.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
+	while( byte_stream_offset < byte_stream_size )
+	{
+		if( byte_stream_offset > ( byte_stream_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 set_data_size );
+
+		if( set_data_size == 0 )
+		{
+			break;
+		}
+		if( ( set_data_size > byte_stream_size )
+		 || ( byte_stream_offset > ( byte_stream_size - set_data_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid set: %d data size value out of bounds.",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		result = libfwps_internal_set_scan_byte_stream(
+		          record,
+		          &( byte_stream[ byte_stream_offset ] ),
+		          (size_t) set_data_size,
+		          ascii_codepage,
+		          record_callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan set: %d.",
+			 function,
+			 set_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		byte_stream_offset += set_data_size;
+
+		set_index++;
+	}
+	if( libfwps_internal_record_free(
+	     (libfwps_internal_record_t **) &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property record.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific set
- * Returns 1 if successful or -1 on error
+/* Retrieves the parse error of the last copy from byte stream or open
+ * The error code and offset are set even if no error argument was provided
+ * when parsing, hence failed parses do not require any error allocations
+ * The error offset is relative to the start of the byte stream or
+ * the file offset the store was opened at
+ * Returns 1 if successful, 0 if no parse error is available or -1 on error
  */
-int libfwps_store_get_set_by_index(
+int libfwps_store_get_parse_error(
      libfwps_store_t *store,
-     int set_index,
-     libfwps_set_t **set,
+     int *error_code,
+     size_t *error_offset,
      libcerror_error_t **error )
 {
 	libfwps_internal_store_t *internal_store = NULL;
-	static char *function                    = "libfwps_store_get_set_by_index";
+	static char *function                    = "libfwps_store_get_parse_error";
 
 	if( store == NULL )
 	{
@@ -405,22 +848,2273 @@ int libfwps_store_get_set_by_index(
 	}
 	internal_store = (libfwps_internal_store_t *) store;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_store->sets_array,
-	     set_index,
-	     (intptr_t **) set,
-	     error ) != 1 )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve set: %d.",
-		 function,
-		 set_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	if( error_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error offset.",
+		 function );
 
+		return( -1 );
+	}
+	if( internal_store->parse_error_code == LIBFWPS_PARSE_ERROR_NONE )
+	{
+		return( 0 );
+	}
+	*error_code   = internal_store->parse_error_code;
+	*error_offset = internal_store->parse_error_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of anomalies found by the last lenient copy from byte stream or open
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_number_of_anomalies(
+     libfwps_store_t *store,
+     int *number_of_anomalies,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_get_number_of_anomalies";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( libfwps_anomaly_array_get_number_of_anomalies(
+	     internal_store->anomalies_array,
+	     number_of_anomalies,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of anomalies.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific anomaly found by the last lenient copy from byte stream or open
+ * The anomalies of the sets are included in order of the sets
+ * The offset is relative to the start of the byte stream or
+ * the file offset the store was opened at
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_anomaly_by_index(
+     libfwps_store_t *store,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_get_anomaly_by_index";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( libfwps_anomaly_array_get_anomaly_by_index(
+	     internal_store->anomalies_array,
+	     anomaly_index,
+	     anomaly_type,
+	     offset,
+	     parse_error_code,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve anomaly: %d.",
+		 function,
+		 anomaly_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a store using a Basic File IO (bfio) handle
+ * The store is read from the file offset up to the terminating set size
+ * or the end of the file, the file IO handle must remain open while
+ * the store is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_open_file_io_handle(
+     libfwps_store_t *store,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	uint8_t set_data_size_data[ 4 ];
+
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *set                       = NULL;
+	static char *function                    = "libfwps_store_open_file_io_handle";
+	off64_t store_file_offset                = 0;
+	size64_t file_size                       = 0;
+	ssize_t read_count                       = 0;
+	uint32_t set_data_size                   = 0;
+	int entry_index                          = 0;
+	int parse_error_code                     = LIBFWPS_PARSE_ERROR_GENERIC;
+	int result                               = 0;
+	int set_index                            = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	internal_store->parse_error_code   = LIBFWPS_PARSE_ERROR_INVALID_ARGUMENT;
+	internal_store->parse_error_offset = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	store_file_offset = file_offset;
+
+	LIBFWPS_TRACE_BEGIN(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 0 );
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < 4 )
+	 || ( (size64_t) file_offset > ( file_size - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+		goto on_error;
+	}
+	internal_store->parse_error_code        = LIBFWPS_PARSE_ERROR_NONE;
+	internal_store->parse_limits.total_size = 0;
+
+	if( internal_store->anomalies_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     internal_store->anomalies_array,
+		     (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty anomalies array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
+	while( (size64_t) file_offset < file_size )
+	{
+		if( (size64_t) file_offset > ( file_size - 4 ) )
+		{
+			if( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_anomaly_append_to_array(
+				     &( internal_store->anomalies_array ),
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     file_offset - store_file_offset,
+				     LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file size value too small.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL;
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              set_data_size_data,
+		              4,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read set: %d data size at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 set_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 set_data_size_data,
+		 set_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: set: %d data size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 set_index,
+			 set_data_size );
+		}
+#endif
+		if( set_data_size == 0 )
+		{
+			break;
+		}
+		if( (size64_t) set_data_size > ( file_size - (size64_t) file_offset ) )
+		{
+			/* The next set boundary is not known hence the remaining data is skipped
+			 */
+			if( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+			{
+				if( libfwps_anomaly_append_to_array(
+				     &( internal_store->anomalies_array ),
+				     LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+				     file_offset - store_file_offset,
+				     LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append anomaly.",
+					 function );
+
+					parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+					goto on_error;
+				}
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid set: %d data size value out of bounds.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS;
+
+			goto on_error;
+		}
+		if( ( internal_store->parse_limits.maximum_number_of_sets > 0 )
+		 && ( set_index >= internal_store->parse_limits.maximum_number_of_sets ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sets value exceeds maximum.",
+			 function );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_parse_limits_reserve_size(
+		     &( internal_store->parse_limits ),
+		     (size64_t) sizeof( libfwps_internal_set_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid set: %d size value exceeds maximum total size.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED;
+
+			goto on_error;
+		}
+		if( libfwps_set_initialize(
+		     &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create set: %d.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		( (libfwps_internal_set_t *) set )->offset               = file_offset - store_file_offset;
+		( (libfwps_internal_set_t *) set )->is_managed           = 1;
+		( (libfwps_internal_set_t *) set )->value_data_threshold = internal_store->value_data_threshold;
+		( (libfwps_internal_set_t *) set )->parse_limits         = internal_store->parse_limits;
+		( (libfwps_internal_set_t *) set )->parse_flags          = internal_store->parse_flags;
+
+		result = libfwps_set_read_file_io_handle(
+		          set,
+		          file_io_handle,
+		          file_offset,
+		          set_data_size,
+		          ascii_codepage,
+		          error );
+
+		if( ( result != 1 )
+		 && ( ( internal_store->parse_flags & LIBFWPS_PARSE_FLAG_LENIENT ) != 0 )
+		 && ( libfwps_anomaly_is_recoverable_parse_error(
+		       ( (libfwps_internal_set_t *) set )->parse_error_code ) != 0 ) )
+		{
+			libcerror_error_free(
+			 error );
+
+			if( libfwps_anomaly_append_to_array(
+			     &( internal_store->anomalies_array ),
+			     LIBFWPS_ANOMALY_TYPE_SET_SKIPPED,
+			     file_offset - store_file_offset,
+			     ( (libfwps_internal_set_t *) set )->parse_error_code,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append anomaly.",
+				 function );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+				goto on_error;
+			}
+			if( libfwps_internal_set_free(
+			     (libfwps_internal_set_t **) &set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free set: %d.",
+				 function,
+				 set_index );
+
+				parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+				goto on_error;
+			}
+			file_offset += set_data_size;
+
+			continue;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read set: %d.",
+			 function,
+			 set_index );
+
+			parse_error_code = ( (libfwps_internal_set_t *) set )->parse_error_code;
+			file_offset     += (off64_t) ( (libfwps_internal_set_t *) set )->parse_error_offset;
+
+			goto on_error;
+		}
+		internal_store->parse_limits.total_size = ( (libfwps_internal_set_t *) set )->parse_limits.total_size;
+
+		if( libfwps_anomaly_append_array_to_array(
+		     &( internal_store->anomalies_array ),
+		     ( (libfwps_internal_set_t *) set )->anomalies_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append anomalies of set: %d.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY;
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_store->sets_array,
+		     &entry_index,
+		     (intptr_t *) set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to append set: %d to array.",
+			 function,
+			 set_index );
+
+			parse_error_code = LIBFWPS_PARSE_ERROR_GENERIC;
+
+			goto on_error;
+		}
+		/* Changing the identifier of the set invalidates the sorted sets array
+		 */
+		( (libfwps_internal_set_t *) set )->store_sorted_sets_array_is_valid = &( internal_store->sorted_sets_array_is_valid );
+
+		internal_store->sorted_sets_array_is_valid = 0;
+
+		set = NULL;
+
+		file_offset += set_data_size;
+
+		set_index++;
+	}
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 (size_t) file_size,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	internal_store->parse_error_code   = parse_error_code;
+	internal_store->parse_error_offset = (size_t) ( file_offset - store_file_offset );
+
+	if( set != NULL )
+	{
+		libfwps_internal_set_free(
+		 (libfwps_internal_set_t **) &set,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_store->sets_array,
+	 (int(*)(intptr_t **, libcerror_error_t **)) &libfwps_internal_set_free,
+	 NULL );
+
+	internal_store->sorted_sets_array_is_valid = 0;
+
+	LIBFWPS_TRACE_END(
+	 LIBFWPS_TRACE_STAGE_STORE,
+	 NULL,
+	 0,
+	 (size_t) file_size,
+	 -1 );
+
+	return( -1 );
+}
+
+/* Sets the value data threshold
+ * Binary data, stream and vector value data larger than the threshold is not copied
+ * but read on demand from the source byte stream or file IO handle,
+ * which must remain available while the store is used
+ * A threshold of 0 disables deferred reading of value data, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_set_value_data_threshold(
+     libfwps_store_t *store,
+     size_t value_data_threshold,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_set_value_data_threshold";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( value_data_threshold > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data threshold value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store->value_data_threshold = value_data_threshold;
+
+	return( 1 );
+}
+
+/* Sets the parse limits
+ * The limits apply to subsequent reads of the store, where a read that exceeds
+ * a limit fails before the corresponding memory is allocated
+ * The maximum total size covers the sets, records, names and value data
+ * A limit of 0 represents no limit, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_set_parse_limits(
+     libfwps_store_t *store,
+     size64_t maximum_total_size,
+     int maximum_number_of_sets,
+     int maximum_number_of_records_per_set,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_set_parse_limits";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libfwps_parse_limits_set(
+	     &( internal_store->parse_limits ),
+	     maximum_total_size,
+	     maximum_number_of_sets,
+	     maximum_number_of_records_per_set,
+	     maximum_number_of_vector_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set parse limits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the parse flags
+ * If LIBFWPS_PARSE_FLAG_LENIENT is set a copy from byte stream or open skips
+ * sets and records that cannot be parsed and stops at data that is truncated,
+ * instead of failing, and records an anomaly for each
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_set_parse_flags(
+     libfwps_store_t *store,
+     uint8_t parse_flags,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_set_parse_flags";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( ( parse_flags & ~( LIBFWPS_PARSE_FLAG_LENIENT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported parse flags: 0x%02" PRIx8 ".",
+		 function,
+		 parse_flags );
+
+		return( -1 );
+	}
+	internal_store->parse_flags = parse_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sets
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_number_of_sets(
+     libfwps_store_t *store,
+     int *number_of_sets,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_get_number_of_sets";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_set_by_index(
+     libfwps_store_t *store,
+     int set_index,
+     libfwps_set_t **set,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	static char *function                    = "libfwps_store_get_set_by_index";
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_store->sets_array,
+	     set_index,
+	     (intptr_t **) set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve set: %d.",
+		 function,
+		 set_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific set by its identifier
+ * The identifier is a little-endian GUID stored in a byte stream
+ * Returns 1 if successful, 0 if no such set or -1 on error
+ */
+int libfwps_store_get_set_by_identifier(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfwps_set_t **set,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *safe_set                  = NULL;
+	static char *function                    = "libfwps_store_get_set_by_identifier";
+	int number_of_sets                       = 0;
+	int set_index                            = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	/* A store contains only a few sets hence a linear search is sufficient
+	 */
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->sets_array,
+		     set_index,
+		     (intptr_t **) &safe_set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     ( (libfwps_internal_set_t *) safe_set )->identifier,
+		     guid_data,
+		     16 ) == 0 )
+		{
+			*set = safe_set;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves a specific record by its property key
+ * The property key consists of the identifier of the set, which is a little-endian
+ * GUID stored in a byte stream, and the entry type of a numeric record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libfwps_store_get_record_by_property_key(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint32_t entry_type,
+     libfwps_record_t **record,
+     libcerror_error_t **error )
+{
+	libfwps_set_t *set    = NULL;
+	static char *function = "libfwps_store_get_record_by_property_key";
+	int result            = 0;
+
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          guid_data,
+	          guid_data_size,
+	          &set,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve set by identifier.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          entry_type,
+	          record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: 0x%08" PRIx32 ".",
+		 function,
+		 entry_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a new set
+ * The GUID is a little-endian GUID and is 16 bytes of size
+ * The set is managed by the store
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_append_set(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfwps_set_t **set,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *safe_set                  = NULL;
+	static char *function                    = "libfwps_store_append_set";
+	int entry_index                          = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( internal_store->is_managed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid store - store is managed by a store cache.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_set_initialize(
+	     &safe_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create set.",
+		 function );
+
+		goto on_error;
+	}
+	( (libfwps_internal_set_t *) safe_set )->is_managed           = 1;
+	( (libfwps_internal_set_t *) safe_set )->value_data_threshold = internal_store->value_data_threshold;
+	( (libfwps_internal_set_t *) safe_set )->parse_limits         = internal_store->parse_limits;
+
+	if( memory_copy(
+	     ( (libfwps_internal_set_t *) safe_set )->identifier,
+	     guid_data,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_store->sets_array,
+	     &entry_index,
+	     (intptr_t *) safe_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append set to array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Changing the identifier of the set invalidates the sorted sets array
+	 */
+	( (libfwps_internal_set_t *) safe_set )->store_sorted_sets_array_is_valid = &( internal_store->sorted_sets_array_is_valid );
+
+	internal_store->sorted_sets_array_is_valid = 0;
+
+	*set = safe_set;
+
+	return( 1 );
+
+on_error:
+	if( safe_set != NULL )
+	{
+		libfwps_internal_set_free(
+		 (libfwps_internal_set_t **) &safe_set,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the store when serialized
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_serialized_size(
+     libfwps_store_t *store,
+     size_t *serialized_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *set                       = NULL;
+	static char *function                    = "libfwps_store_get_serialized_size";
+	size_t safe_serialized_size              = 0;
+	size_t set_size                          = 0;
+	int number_of_sets                       = 0;
+	int set_index                            = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( serialized_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	/* The set list terminator
+	 */
+	safe_serialized_size = 4;
+
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->sets_array,
+		     set_index,
+		     (intptr_t **) &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( libfwps_set_get_serialized_size(
+		     set,
+		     &set_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d serialized size.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( set_size > ( (size_t) SSIZE_MAX - safe_serialized_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid serialized size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_serialized_size += set_size;
+	}
+	*serialized_size = safe_serialized_size;
+
+	return( 1 );
+}
+
+/* Copies the store to a byte stream
+ * The byte stream must be at least the size returned by libfwps_store_get_serialized_size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_copy_to_byte_stream(
+     libfwps_store_t *store,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *set                       = NULL;
+	static char *function                    = "libfwps_store_copy_to_byte_stream";
+	size_t byte_stream_offset                = 0;
+	size_t serialized_size                   = 0;
+	size_t set_size                          = 0;
+	int number_of_sets                       = 0;
+	int set_index                            = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_store_get_serialized_size(
+	     store,
+	     &serialized_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serialized size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < serialized_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->sets_array,
+		     set_index,
+		     (intptr_t **) &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( libfwps_set_get_serialized_size(
+		     set,
+		     &set_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d serialized size.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( libfwps_set_copy_to_byte_stream(
+		     set,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     byte_stream_size - byte_stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy set: %d to byte stream.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += set_size;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ byte_stream_offset ] ),
+	 0 );
+
+	return( 1 );
+}
+
+/* Marks the sets of a store and their records as read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_store_set_read_only(
+     libfwps_internal_store_t *internal_store,
+     libcerror_error_t **error )
+{
+	libfwps_set_t *set    = NULL;
+	static char *function = "libfwps_internal_store_set_read_only";
+	int number_of_sets    = 0;
+	int set_index         = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_store->sets_array,
+		     set_index,
+		     (intptr_t **) &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( libfwps_internal_set_set_read_only(
+		     (libfwps_internal_set_t *) set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to mark set: %d as read-only.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+	}
+	/* The sorted sets array is built in advance since a read-only store
+	 * can be used by multiple threads at the same time
+	 */
+	if( internal_store->sorted_sets_array_is_valid == 0 )
+	{
+		if( libfwps_internal_store_build_sorted_sets_array(
+		     internal_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build sorted sets array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two sorted sets entries by the identifier of their sets
+ * Entries with the same identifier are ordered by the index of their set in the sets array
+ * Returns -1, 0 or 1 as required by qsort
+ */
+int libfwps_sorted_sets_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfwps_sorted_sets_entry_t *first_sorted_sets_entry  = NULL;
+	const libfwps_sorted_sets_entry_t *second_sorted_sets_entry = NULL;
+	int result                                                  = 0;
+
+	first_sorted_sets_entry  = (const libfwps_sorted_sets_entry_t *) first_entry;
+	second_sorted_sets_entry = (const libfwps_sorted_sets_entry_t *) second_entry;
+
+	result = libfwps_internal_set_compare_by_identifier(
+	          (libfwps_internal_set_t *) first_sorted_sets_entry->set,
+	          (libfwps_internal_set_t *) second_sorted_sets_entry->set,
+	          NULL );
+
+	if( result == LIBCDATA_COMPARE_LESS )
+	{
+		return( -1 );
+	}
+	else if( result == LIBCDATA_COMPARE_GREATER )
+	{
+		return( 1 );
+	}
+	if( first_sorted_sets_entry->set_index < second_sorted_sets_entry->set_index )
+	{
+		return( -1 );
+	}
+	else if( first_sorted_sets_entry->set_index > second_sorted_sets_entry->set_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Builds the sorted sets array
+ * The sets are sorted at once, sets with the same identifier are kept
+ * in order of the sets array
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_store_build_sorted_sets_array(
+     libfwps_internal_store_t *internal_store,
+     libcerror_error_t **error )
+{
+	libfwps_sorted_sets_entry_t *sorted_sets_entries = NULL;
+	libfwps_set_t *set                               = NULL;
+	static char *function                            = "libfwps_internal_store_build_sorted_sets_array";
+	int number_of_sets                               = 0;
+	int set_index                                    = 0;
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->sorted_sets_array == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_store->sorted_sets_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sorted sets array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libcdata_array_empty(
+		     internal_store->sorted_sets_array,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty sorted sets array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_store->sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sets > 0 )
+	{
+		if( (size_t) number_of_sets > ( (size_t) SSIZE_MAX / sizeof( libfwps_sorted_sets_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sets value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		sorted_sets_entries = (libfwps_sorted_sets_entry_t *) libfwps_allocator_allocate(
+		                                                       sizeof( libfwps_sorted_sets_entry_t ) * (size_t) number_of_sets,
+		                                                       LIBFWPS_ALLOCATION_TYPE_INDEX );
+
+		if( sorted_sets_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted sets entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( set_index = 0;
+		     set_index < number_of_sets;
+		     set_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_store->sets_array,
+			     set_index,
+			     (intptr_t **) &set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve set: %d.",
+				 function,
+				 set_index );
+
+				goto on_error;
+			}
+			sorted_sets_entries[ set_index ].set       = set;
+			sorted_sets_entries[ set_index ].set_index = set_index;
+		}
+		qsort(
+		 sorted_sets_entries,
+		 (size_t) number_of_sets,
+		 sizeof( libfwps_sorted_sets_entry_t ),
+		 &libfwps_sorted_sets_entry_compare );
+
+		if( libcdata_array_resize(
+		     internal_store->sorted_sets_array,
+		     number_of_sets,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize sorted sets array.",
+			 function );
+
+			goto on_error;
+		}
+		for( set_index = 0;
+		     set_index < number_of_sets;
+		     set_index++ )
+		{
+			if( libcdata_array_set_entry_by_index(
+			     internal_store->sorted_sets_array,
+			     set_index,
+			     (intptr_t *) sorted_sets_entries[ set_index ].set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set set: %d in sorted sets array.",
+				 function,
+				 set_index );
+
+				goto on_error;
+			}
+		}
+		libfwps_allocator_free(
+		 sorted_sets_entries );
+
+		sorted_sets_entries = NULL;
+	}
+	internal_store->sorted_sets_array_is_valid = 1;
+
+	return( 1 );
+
+on_error:
+	if( sorted_sets_entries != NULL )
+	{
+		libfwps_allocator_free(
+		 sorted_sets_entries );
+	}
+	if( internal_store->sorted_sets_array != NULL )
+	{
+		libcdata_array_empty(
+		 internal_store->sorted_sets_array,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the array of the sets sorted by identifier
+ * The sorted sets array is (re)built if it is not up to date,
+ * the array is managed by the store and does not manage the sets
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_internal_store_get_sorted_sets_array(
+     libfwps_internal_store_t *internal_store,
+     libcdata_array_t **sorted_sets_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_internal_store_get_sorted_sets_array";
+
+	if( internal_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_sets_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted sets array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_store->sorted_sets_array_is_valid == 0 )
+	{
+		if( libfwps_internal_store_build_sorted_sets_array(
+		     internal_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build sorted sets array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*sorted_sets_array = internal_store->sorted_sets_array;
+
+	return( 1 );
+}
+
+/* Retrieves the content hash
+ * The content hash is a 128-bit non-cryptographic hash of the sets, in order
+ * of their identifier, and of their records, in order of their entry type or
+ * entry name. Stores with the same properties have the same content hash,
+ * regardless of the order of the sets and records, padding or trailing data
+ * The hash requires 16 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_get_content_hash(
+     libfwps_store_t *store,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libfwps_hash_context_t hash_context;
+	uint8_t number_of_sets_data[ 4 ];
+
+	libcdata_array_t *sorted_sets_array      = NULL;
+	libfwps_internal_store_t *internal_store = NULL;
+	libfwps_set_t *set                       = NULL;
+	static char *function                    = "libfwps_store_get_content_hash";
+	int number_of_sets                       = 0;
+	int set_index                            = 0;
+
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store = (libfwps_internal_store_t *) store;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size < LIBFWPS_HASH_SIZE )
+	 || ( hash_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_internal_store_get_sorted_sets_array(
+	     internal_store,
+	     &sorted_sets_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sorted sets array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sorted_sets_array,
+	     &number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	libfwps_hash_context_reset(
+	 &hash_context );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 number_of_sets_data,
+	 (uint32_t) number_of_sets );
+
+	if( libfwps_hash_context_update(
+	     &hash_context,
+	     number_of_sets_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update hash context with number of sets.",
+		 function );
+
+		return( -1 );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sorted_sets_array,
+		     set_index,
+		     (intptr_t **) &set,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve set: %d from sorted sets array.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+		if( libfwps_internal_set_update_hash_context(
+		     (libfwps_internal_set_t *) set,
+		     &hash_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update hash context with set: %d.",
+			 function,
+			 set_index );
+
+			return( -1 );
+		}
+	}
+	if( libfwps_hash_context_finalize(
+	     &hash_context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize hash context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the differences between two stores
+ * The sets are matched by their identifier and the records by their entry type
+ * or entry name, hence differences in the order of the sets and records,
+ * padding or trailing data are ignored
+ * The difference callback function is called for every record that was added
+ * to or removed from the first store to obtain the second store, or that has
+ * a different value, with the identifier of the set, which is a little-endian
+ * GUID of 16 bytes. The first record is NULL for an added record and the second
+ * record is NULL for a removed record. The callback function returns 1 to
+ * continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if stopped by the callback function or -1 on error
+ */
+int libfwps_store_diff(
+     libfwps_store_t *first_store,
+     libfwps_store_t *second_store,
+     int (*difference_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *first_record,
+            libfwps_record_t *second_record,
+            int difference_type,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *first_sorted_sets_array  = NULL;
+	libcdata_array_t *second_sorted_sets_array = NULL;
+	libfwps_set_t *first_set                   = NULL;
+	libfwps_set_t *second_set                  = NULL;
+	static char *function                      = "libfwps_store_diff";
+	int first_number_of_sets                   = 0;
+	int first_set_index                        = 0;
+	int result                                 = 1;
+	int second_number_of_sets                  = 0;
+	int second_set_index                       = 0;
+
+	if( first_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first store.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second store.",
+		 function );
+
+		return( -1 );
+	}
+	if( difference_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid difference callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_internal_store_get_sorted_sets_array(
+	     (libfwps_internal_store_t *) first_store,
+	     &first_sorted_sets_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sorted sets array of first store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_internal_store_get_sorted_sets_array(
+	     (libfwps_internal_store_t *) second_store,
+	     &second_sorted_sets_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sorted sets array of second store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     first_sorted_sets_array,
+	     &first_number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets of first store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     second_sorted_sets_array,
+	     &second_number_of_sets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sets of second store.",
+		 function );
+
+		return( -1 );
+	}
+	/* Both sorted sets arrays are sorted by identifier hence they can be merged
+	 * in a single pass
+	 */
+	while( ( first_set_index < first_number_of_sets )
+	    || ( second_set_index < second_number_of_sets ) )
+	{
+		first_set  = NULL;
+		second_set = NULL;
+
+		if( first_set_index < first_number_of_sets )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     first_sorted_sets_array,
+			     first_set_index,
+			     (intptr_t **) &first_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve set: %d of first store.",
+				 function,
+				 first_set_index );
+
+				return( -1 );
+			}
+		}
+		if( second_set_index < second_number_of_sets )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     second_sorted_sets_array,
+			     second_set_index,
+			     (intptr_t **) &second_set,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve set: %d of second store.",
+				 function,
+				 second_set_index );
+
+				return( -1 );
+			}
+		}
+		if( first_set == NULL )
+		{
+			result = LIBCDATA_COMPARE_GREATER;
+		}
+		else if( second_set == NULL )
+		{
+			result = LIBCDATA_COMPARE_LESS;
+		}
+		else
+		{
+			result = libfwps_internal_set_compare_by_identifier(
+			          (libfwps_internal_set_t *) first_set,
+			          (libfwps_internal_set_t *) second_set,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare identifiers of sets: %d and %d.",
+				 function,
+				 first_set_index,
+				 second_set_index );
+
+				return( -1 );
+			}
+		}
+		if( result == LIBCDATA_COMPARE_LESS )
+		{
+			second_set = NULL;
+
+			first_set_index++;
+		}
+		else if( result == LIBCDATA_COMPARE_GREATER )
+		{
+			first_set = NULL;
+
+			second_set_index++;
+		}
+		else
+		{
+			first_set_index++;
+			second_set_index++;
+		}
+		result = libfwps_internal_set_diff(
+		          (libfwps_internal_set_t *) first_set,
+		          (libfwps_internal_set_t *) second_set,
+		          difference_callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine differences between sets.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Stops the determination of differences at the first difference
+ * Returns 0 to stop
+ */
+int libfwps_internal_store_compare_difference_callback(
+     const uint8_t *set_identifier LIBFWPS_ATTRIBUTE_UNUSED,
+     libfwps_record_t *first_record LIBFWPS_ATTRIBUTE_UNUSED,
+     libfwps_record_t *second_record LIBFWPS_ATTRIBUTE_UNUSED,
+     int difference_type LIBFWPS_ATTRIBUTE_UNUSED,
+     void *callback_data LIBFWPS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error LIBFWPS_ATTRIBUTE_UNUSED )
+{
+	LIBFWPS_UNREFERENCED_PARAMETER( set_identifier )
+	LIBFWPS_UNREFERENCED_PARAMETER( first_record )
+	LIBFWPS_UNREFERENCED_PARAMETER( second_record )
+	LIBFWPS_UNREFERENCED_PARAMETER( difference_type )
+	LIBFWPS_UNREFERENCED_PARAMETER( callback_data )
+	LIBFWPS_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+}
+
+/* Compares two stores
+ * The stores are equal if they contain the same properties, as determined
+ * by libfwps_store_diff
+ * Returns 1 if the stores are equal, 0 if not or -1 on error
+ */
+int libfwps_store_compare(
+     libfwps_store_t *first_store,
+     libfwps_store_t *second_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_store_compare";
+	int result            = 0;
+
+	result = libfwps_store_diff(
+	          first_store,
+	          second_store,
+	          &libfwps_internal_store_compare_difference_callback,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine differences between stores.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
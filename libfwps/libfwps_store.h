@@ -26,14 +26,29 @@
 #include <types.h>
 
 #include "libfwps_extern.h"
+#include "libfwps_libbfio.h"
 #include "libfwps_libcdata.h"
 #include "libfwps_libcerror.h"
+#include "libfwps_parse_limits.h"
 #include "libfwps_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libfwps_sorted_sets_entry libfwps_sorted_sets_entry_t;
+
+struct libfwps_sorted_sets_entry
+{
+	/* The set
+	 */
+	libfwps_set_t *set;
+
+	/* The index of the set in the sets array
+	 */
+	int set_index;
+};
+
 typedef struct libfwps_internal_store libfwps_internal_store_t;
 
 struct libfwps_internal_store
@@ -45,6 +60,42 @@ struct libfwps_internal_store
 	/* The sets array
 	 */
 	libcdata_array_t *sets_array;
+
+	/* The sorted sets array, which contains the sets sorted by identifier
+	 */
+	libcdata_array_t *sorted_sets_array;
+
+	/* Value to indicate the sorted sets array is up to date
+	 */
+	uint8_t sorted_sets_array_is_valid;
+
+	/* The value data threshold
+	 */
+	size_t value_data_threshold;
+
+	/* The parse limits
+	 */
+	libfwps_parse_limits_t parse_limits;
+
+	/* The parse flags
+	 */
+	uint8_t parse_flags;
+
+	/* The anomalies array, which is NULL if no anomalies were found
+	 */
+	libcdata_array_t *anomalies_array;
+
+	/* The parse error code
+	 */
+	int parse_error_code;
+
+	/* The parse error offset relative to the start of the byte stream
+	 */
+	size_t parse_error_offset;
+
+	/* Value to indicate if the store is managed by a store cache
+	 */
+	uint8_t is_managed;
 };
 
 LIBFWPS_EXTERN \
@@ -57,6 +108,10 @@ int libfwps_store_free(
      libfwps_store_t **store,
      libcerror_error_t **error );
 
+int libfwps_internal_store_free(
+     libfwps_internal_store_t **internal_store,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_store_copy_from_byte_stream(
      libfwps_store_t *store,
@@ -65,6 +120,70 @@ int libfwps_store_copy_from_byte_stream(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBFWPS_EXTERN \
+int libfwps_store_scan_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     int (*record_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_parse_error(
+     libfwps_store_t *store,
+     int *error_code,
+     size_t *error_offset,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_number_of_anomalies(
+     libfwps_store_t *store,
+     int *number_of_anomalies,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_anomaly_by_index(
+     libfwps_store_t *store,
+     int anomaly_index,
+     int *anomaly_type,
+     off64_t *offset,
+     int *parse_error_code,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_open_file_io_handle(
+     libfwps_store_t *store,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_set_value_data_threshold(
+     libfwps_store_t *store,
+     size_t value_data_threshold,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_set_parse_limits(
+     libfwps_store_t *store,
+     size64_t maximum_total_size,
+     int maximum_number_of_sets,
+     int maximum_number_of_records_per_set,
+     uint32_t maximum_number_of_vector_values,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_set_parse_flags(
+     libfwps_store_t *store,
+     uint8_t parse_flags,
+     libcerror_error_t **error );
+
 LIBFWPS_EXTERN \
 int libfwps_store_get_number_of_sets(
      libfwps_store_t *store,
@@ -78,6 +197,96 @@ int libfwps_store_get_set_by_index(
      libfwps_set_t **set,
      libcerror_error_t **error );
 
+LIBFWPS_EXTERN \
+int libfwps_store_get_set_by_identifier(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfwps_set_t **set,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_record_by_property_key(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     uint32_t entry_type,
+     libfwps_record_t **record,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_append_set(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libfwps_set_t **set,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_serialized_size(
+     libfwps_store_t *store,
+     size_t *serialized_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_copy_to_byte_stream(
+     libfwps_store_t *store,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libfwps_internal_store_set_read_only(
+     libfwps_internal_store_t *internal_store,
+     libcerror_error_t **error );
+
+int libfwps_sorted_sets_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfwps_internal_store_build_sorted_sets_array(
+     libfwps_internal_store_t *internal_store,
+     libcerror_error_t **error );
+
+int libfwps_internal_store_get_sorted_sets_array(
+     libfwps_internal_store_t *internal_store,
+     libcdata_array_t **sorted_sets_array,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_get_content_hash(
+     libfwps_store_t *store,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_diff(
+     libfwps_store_t *first_store,
+     libfwps_store_t *second_store,
+     int (*difference_callback_function)(
+            const uint8_t *set_identifier,
+            libfwps_record_t *first_record,
+            libfwps_record_t *second_record,
+            int difference_type,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwps_internal_store_compare_difference_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *first_record,
+     libfwps_record_t *second_record,
+     int difference_type,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_compare(
+     libfwps_store_t *first_store,
+     libfwps_store_t *second_store,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
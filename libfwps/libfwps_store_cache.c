@@ -0,0 +1,597 @@
+/*
+ * Store cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwps_allocator.h"
+#include "libfwps_definitions.h"
+#include "libfwps_hash.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_store.h"
+#include "libfwps_store_cache.h"
+#include "libfwps_types.h"
+
+/* Creates a store cache
+ * Make sure the value store_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_cache_initialize(
+     libfwps_store_cache_t **store_cache,
+     int maximum_number_of_stores,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_cache_t *internal_store_cache = NULL;
+	static char *function                                = "libfwps_store_cache_initialize";
+	size_t entries_size                                  = 0;
+	int number_of_entries                                = 0;
+
+	if( store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *store_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid store cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_stores <= 0 )
+	 || ( maximum_number_of_stores > LIBFWPS_STORE_CACHE_MAXIMUM_NUMBER_OF_STORES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of stores value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the hash table at most half full to keep the probe sequences short
+	 */
+	number_of_entries = 2;
+
+	while( number_of_entries < ( maximum_number_of_stores * 2 ) )
+	{
+		number_of_entries *= 2;
+	}
+	entries_size = sizeof( libfwps_store_cache_entry_t ) * (size_t) number_of_entries;
+
+	internal_store_cache = libfwps_allocator_allocate_structure(
+	                        libfwps_internal_store_cache_t,
+	                        LIBFWPS_ALLOCATION_TYPE_STORE_CACHE );
+
+	if( internal_store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create store cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_store_cache,
+	     0,
+	     sizeof( libfwps_internal_store_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear store cache.",
+		 function );
+
+		libfwps_allocator_free(
+		 internal_store_cache );
+
+		return( -1 );
+	}
+	internal_store_cache->entries = (libfwps_store_cache_entry_t *) libfwps_allocator_allocate(
+	                                                                 entries_size,
+	                                                                 LIBFWPS_ALLOCATION_TYPE_STORE_CACHE );
+
+	if( internal_store_cache->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_store_cache->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_store_cache->number_of_entries        = number_of_entries;
+	internal_store_cache->maximum_number_of_stores = maximum_number_of_stores;
+
+	*store_cache = (libfwps_store_cache_t *) internal_store_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_store_cache != NULL )
+	{
+		if( internal_store_cache->entries != NULL )
+		{
+			libfwps_allocator_free(
+			 internal_store_cache->entries );
+		}
+		libfwps_allocator_free(
+		 internal_store_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a store cache
+ * The stores retrieved from the store cache are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_cache_free(
+     libfwps_store_cache_t **store_cache,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_cache_t *internal_store_cache = NULL;
+	libfwps_internal_store_t *internal_store             = NULL;
+	static char *function                                = "libfwps_store_cache_free";
+	int entry_index                                      = 0;
+	int result                                           = 1;
+
+	if( store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *store_cache != NULL )
+	{
+		internal_store_cache = (libfwps_internal_store_cache_t *) *store_cache;
+		*store_cache         = NULL;
+
+		for( entry_index = 0;
+		     entry_index < internal_store_cache->number_of_entries;
+		     entry_index++ )
+		{
+			internal_store = (libfwps_internal_store_t *) internal_store_cache->entries[ entry_index ].store;
+
+			if( internal_store == NULL )
+			{
+				continue;
+			}
+			if( libfwps_internal_store_free(
+			     &internal_store,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free store: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+			libfwps_allocator_free(
+			 internal_store_cache->entries[ entry_index ].data );
+		}
+		libfwps_allocator_free(
+		 internal_store_cache->entries );
+
+		libfwps_allocator_free(
+		 internal_store_cache );
+	}
+	return( result );
+}
+
+/* Retrieves a store from a byte stream
+ * If the store cache contains a store read from the same data that store
+ * is returned, otherwise the store is read from the byte stream and added
+ * to the store cache if it is not full
+ * A store that is added to the store cache is read from a copy of the byte
+ * stream and remains valid until the store cache is freed. It is shared
+ * and must not be modified
+ * The store must be freed with libfwps_store_free, which does not free
+ * stores that are managed by the store cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_cache_get_store(
+     libfwps_store_cache_t *store_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwps_store_t **store,
+     libcerror_error_t **error )
+{
+	uint8_t hash[ LIBFWPS_HASH_SIZE ];
+
+	libfwps_internal_store_cache_t *internal_store_cache = NULL;
+	libfwps_store_cache_entry_t *entry                   = NULL;
+	libfwps_store_t *safe_store                          = NULL;
+	uint8_t *data                                        = NULL;
+	static char *function                                = "libfwps_store_cache_get_store";
+	uint32_t entry_index                                 = 0;
+	uint32_t entry_index_mask                            = 0;
+
+	if( store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store_cache = (libfwps_internal_store_cache_t *) store_cache;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size == 0 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwps_hash_calculate(
+	     byte_stream,
+	     byte_stream_size,
+	     hash,
+	     LIBFWPS_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 hash,
+	 entry_index );
+
+	entry_index_mask = (uint32_t) internal_store_cache->number_of_entries - 1;
+	entry_index     &= entry_index_mask;
+
+	/* The hash table is at most half full hence an unused entry is always found
+	 */
+	while( internal_store_cache->entries[ entry_index ].store != NULL )
+	{
+		entry = &( internal_store_cache->entries[ entry_index ] );
+
+		if( ( entry->data_size == byte_stream_size )
+		 && ( entry->ascii_codepage == ascii_codepage )
+		 && ( memory_compare(
+		       entry->hash,
+		       hash,
+		       LIBFWPS_HASH_SIZE ) == 0 )
+		 && ( memory_compare(
+		       entry->data,
+		       byte_stream,
+		       byte_stream_size ) == 0 ) )
+		{
+			internal_store_cache->number_of_hits += 1;
+
+			*store = entry->store;
+
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) & entry_index_mask;
+	}
+	if( internal_store_cache->number_of_stores >= internal_store_cache->maximum_number_of_stores )
+	{
+		if( libfwps_store_initialize(
+		     &safe_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create store.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwps_store_copy_from_byte_stream(
+		     safe_store,
+		     byte_stream,
+		     byte_stream_size,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy store from byte stream.",
+			 function );
+
+			goto on_error;
+		}
+		*store = safe_store;
+
+		return( 1 );
+	}
+	data = (uint8_t *) libfwps_allocator_allocate(
+	                    sizeof( uint8_t ) * byte_stream_size,
+	                    LIBFWPS_ALLOCATION_TYPE_STORE_CACHE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     data,
+	     byte_stream,
+	     byte_stream_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_store_initialize(
+	     &safe_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create store.",
+		 function );
+
+		goto on_error;
+	}
+	/* The store is read from the copy of the data since deferred value data
+	 * references the byte stream
+	 */
+	if( libfwps_store_copy_from_byte_stream(
+	     safe_store,
+	     data,
+	     byte_stream_size,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy store from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwps_internal_store_set_read_only(
+	     (libfwps_internal_store_t *) safe_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark store as read-only.",
+		 function );
+
+		goto on_error;
+	}
+	( (libfwps_internal_store_t *) safe_store )->is_managed = 1;
+
+	entry = &( internal_store_cache->entries[ entry_index ] );
+
+	if( memory_copy(
+	     entry->hash,
+	     hash,
+	     LIBFWPS_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		goto on_error;
+	}
+	entry->data           = data;
+	entry->data_size      = byte_stream_size;
+	entry->ascii_codepage = ascii_codepage;
+	entry->store          = safe_store;
+
+	internal_store_cache->number_of_stores += 1;
+
+	*store = safe_store;
+
+	return( 1 );
+
+on_error:
+	if( safe_store != NULL )
+	{
+		libfwps_internal_store_free(
+		 (libfwps_internal_store_t **) &safe_store,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		libfwps_allocator_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of stores in the store cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_cache_get_number_of_stores(
+     libfwps_store_cache_t *store_cache,
+     int *number_of_stores,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_cache_t *internal_store_cache = NULL;
+	static char *function                                = "libfwps_store_cache_get_number_of_stores";
+
+	if( store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store_cache = (libfwps_internal_store_cache_t *) store_cache;
+
+	if( number_of_stores == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of stores.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_stores = internal_store_cache->number_of_stores;
+
+	return( 1 );
+}
+
+/* Retrieves the number of times a cached store was returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfwps_store_cache_get_number_of_hits(
+     libfwps_store_cache_t *store_cache,
+     uint64_t *number_of_hits,
+     libcerror_error_t **error )
+{
+	libfwps_internal_store_cache_t *internal_store_cache = NULL;
+	static char *function                                = "libfwps_store_cache_get_number_of_hits";
+
+	if( store_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid store cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_store_cache = (libfwps_internal_store_cache_t *) store_cache;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits = internal_store_cache->number_of_hits;
+
+	return( 1 );
+}
+
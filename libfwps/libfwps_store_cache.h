@@ -0,0 +1,128 @@
+/*
+ * Store cache functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_STORE_CACHE_H )
+#define _LIBFWPS_STORE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_extern.h"
+#include "libfwps_hash.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of stores in a store cache
+ */
+#define LIBFWPS_STORE_CACHE_MAXIMUM_NUMBER_OF_STORES	( 1 << 24 )
+
+typedef struct libfwps_store_cache_entry libfwps_store_cache_entry_t;
+
+struct libfwps_store_cache_entry
+{
+	/* The hash of the byte stream
+	 */
+	uint8_t hash[ LIBFWPS_HASH_SIZE ];
+
+	/* The copy of the byte stream the store was read from
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The store, which is NULL if the entry is not used
+	 */
+	libfwps_store_t *store;
+};
+
+typedef struct libfwps_internal_store_cache libfwps_internal_store_cache_t;
+
+struct libfwps_internal_store_cache
+{
+	/* The entries, which are used as an open addressing hash table
+	 */
+	libfwps_store_cache_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	int number_of_entries;
+
+	/* The maximum number of stores
+	 */
+	int maximum_number_of_stores;
+
+	/* The number of stores
+	 */
+	int number_of_stores;
+
+	/* The number of lookups that returned a cached store
+	 */
+	uint64_t number_of_hits;
+};
+
+LIBFWPS_EXTERN \
+int libfwps_store_cache_initialize(
+     libfwps_store_cache_t **store_cache,
+     int maximum_number_of_stores,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_cache_free(
+     libfwps_store_cache_t **store_cache,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_cache_get_store(
+     libfwps_store_cache_t *store_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int ascii_codepage,
+     libfwps_store_t **store,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_cache_get_number_of_stores(
+     libfwps_store_cache_t *store_cache,
+     int *number_of_stores,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_store_cache_get_number_of_hits(
+     libfwps_store_cache_t *store_cache,
+     uint64_t *number_of_hits,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_STORE_CACHE_H ) */
+
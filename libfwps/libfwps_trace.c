@@ -0,0 +1,254 @@
+/*
+ * Parse tracing functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PARSE_TRACING ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libfwps_atomic.h"
+#include "libfwps_definitions.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_trace.h"
+#include "libfwps_types.h"
+#include "libfwps_unused.h"
+
+#if defined( HAVE_PARSE_TRACING )
+
+/* The number of value type counters, where the last counter is shared
+ * by the value types without a known basic type
+ */
+#define LIBFWPS_TRACE_NUMBER_OF_VALUE_TYPE_COUNTERS	( LIBFWPS_VALUE_TYPE_VERSIONED_STREAM + 2 )
+
+/* The trace function, NULL if not set
+ */
+static void (*libfwps_trace_function)(
+               const libfwps_trace_event_t *event,
+               void *context ) = NULL;
+
+/* The trace function context
+ */
+static void *libfwps_trace_context = NULL;
+
+/* The number of records per value type
+ */
+static uint64_t libfwps_trace_number_of_records[ LIBFWPS_TRACE_NUMBER_OF_VALUE_TYPE_COUNTERS ];
+
+/* The value data size per value type
+ */
+static uint64_t libfwps_trace_value_data_size[ LIBFWPS_TRACE_NUMBER_OF_VALUE_TYPE_COUNTERS ];
+
+/* Retrieves the index of the counters of a value type
+ * Returns the counter index
+ */
+static int libfwps_trace_get_counter_index(
+            uint32_t value_type )
+{
+	value_type &= 0x00000fffUL;
+
+	if( value_type > LIBFWPS_VALUE_TYPE_VERSIONED_STREAM )
+	{
+		return( LIBFWPS_TRACE_NUMBER_OF_VALUE_TYPE_COUNTERS - 1 );
+	}
+	return( (int) value_type );
+}
+
+/* Retrieves a monotonic timestamp in nanoseconds
+ * Returns the timestamp
+ */
+static uint64_t libfwps_trace_get_timestamp(
+                 void )
+{
+#if defined( WINAPI )
+	static LARGE_INTEGER frequency = { 0 };
+	LARGE_INTEGER counter;
+
+	if( frequency.QuadPart == 0 )
+	{
+		QueryPerformanceFrequency(
+		 &frequency );
+	}
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) ( ( (double) clock() * 1000000000.0 ) / (double) CLOCKS_PER_SEC ) );
+
+#endif
+}
+
+/* Emits a trace event to the trace function
+ * The timestamp is only determined if a trace function is set
+ */
+void libfwps_trace_emit_event(
+      int stage,
+      int event_type,
+      const uint8_t *format_class_identifier,
+      uint32_t value_type,
+      size_t data_size,
+      int result )
+{
+	libfwps_trace_event_t event;
+
+	if( libfwps_trace_function == NULL )
+	{
+		return;
+	}
+	event.stage                   = stage;
+	event.event_type              = event_type;
+	event.timestamp               = libfwps_trace_get_timestamp();
+	event.format_class_identifier = format_class_identifier;
+	event.value_type              = value_type;
+	event.data_size               = data_size;
+	event.result                  = result;
+
+	libfwps_trace_function(
+	 &event,
+	 libfwps_trace_context );
+}
+
+/* Counts a record of a specific value type
+ */
+void libfwps_trace_count_value_type(
+      uint32_t value_type,
+      size_t value_data_size )
+{
+	int counter_index = libfwps_trace_get_counter_index(
+	                     value_type );
+
+	libfwps_atomic_add(
+	 &( libfwps_trace_number_of_records[ counter_index ] ),
+	 1 );
+
+	libfwps_atomic_add(
+	 &( libfwps_trace_value_data_size[ counter_index ] ),
+	 (uint64_t) value_data_size );
+}
+
+#endif /* defined( HAVE_PARSE_TRACING ) */
+
+/* Sets the trace function
+ * The trace function is called at the begin and end of reading a store,
+ * a set and a record and of converting value data to a string.
+ * NULL removes the trace function. The context is passed to the function as is
+ * The trace function must not be changed while libfwps is used by other threads
+ * Returns 1 if successful, 0 if parse tracing is not available or -1 on error
+ */
+int libfwps_set_trace_function(
+     void (*trace_function)(
+             const libfwps_trace_event_t *event,
+             void *context ),
+     void *context,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_PARSE_TRACING )
+	libfwps_trace_function = trace_function;
+
+	if( trace_function != NULL )
+	{
+		libfwps_trace_context = context;
+	}
+	else
+	{
+		libfwps_trace_context = NULL;
+	}
+	return( 1 );
+#else
+	LIBFWPS_UNREFERENCED_PARAMETER( trace_function )
+	LIBFWPS_UNREFERENCED_PARAMETER( context )
+	LIBFWPS_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+#endif
+}
+
+/* Retrieves the number of records and the total value data size read of a value type
+ * Vector and array values are counted with their basic value type and value types
+ * that are not known share a single counter
+ * Returns 1 if successful, 0 if parse tracing is not available or -1 on error
+ */
+int libfwps_get_value_type_statistics(
+     uint32_t value_type,
+     uint64_t *number_of_records,
+     uint64_t *value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwps_get_value_type_statistics";
+
+#if defined( HAVE_PARSE_TRACING )
+	int counter_index     = 0;
+#endif
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PARSE_TRACING )
+	counter_index = libfwps_trace_get_counter_index(
+	                 value_type );
+
+	*number_of_records = libfwps_atomic_load( &( libfwps_trace_number_of_records[ counter_index ] ) );
+	*value_data_size   = libfwps_atomic_load( &( libfwps_trace_value_data_size[ counter_index ] ) );
+
+	return( 1 );
+#else
+	LIBFWPS_UNREFERENCED_PARAMETER( value_type )
+
+	*number_of_records = 0;
+	*value_data_size   = 0;
+
+	return( 0 );
+#endif
+}
+
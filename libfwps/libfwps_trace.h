@@ -0,0 +1,89 @@
+/*
+ * Parse tracing functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWPS_TRACE_H )
+#define _LIBFWPS_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwps_definitions.h"
+#include "libfwps_extern.h"
+#include "libfwps_libcerror.h"
+#include "libfwps_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_PARSE_TRACING )
+
+#define LIBFWPS_TRACE_BEGIN( stage, format_class_identifier, value_type, data_size ) \
+	libfwps_trace_emit_event( stage, LIBFWPS_TRACE_EVENT_TYPE_BEGIN, format_class_identifier, value_type, data_size, 0 )
+
+#define LIBFWPS_TRACE_END( stage, format_class_identifier, value_type, data_size, result ) \
+	libfwps_trace_emit_event( stage, LIBFWPS_TRACE_EVENT_TYPE_END, format_class_identifier, value_type, data_size, result )
+
+#define LIBFWPS_TRACE_COUNT_VALUE_TYPE( value_type, value_data_size ) \
+	libfwps_trace_count_value_type( value_type, value_data_size )
+
+void libfwps_trace_emit_event(
+      int stage,
+      int event_type,
+      const uint8_t *format_class_identifier,
+      uint32_t value_type,
+      size_t data_size,
+      int result );
+
+void libfwps_trace_count_value_type(
+      uint32_t value_type,
+      size_t value_data_size );
+
+#else
+#define LIBFWPS_TRACE_BEGIN( stage, format_class_identifier, value_type, data_size )
+
+#define LIBFWPS_TRACE_END( stage, format_class_identifier, value_type, data_size, result )
+
+#define LIBFWPS_TRACE_COUNT_VALUE_TYPE( value_type, value_data_size )
+
+#endif /* defined( HAVE_PARSE_TRACING ) */
+
+LIBFWPS_EXTERN \
+int libfwps_set_trace_function(
+     void (*trace_function)(
+             const libfwps_trace_event_t *event,
+             void *context ),
+     void *context,
+     libcerror_error_t **error );
+
+LIBFWPS_EXTERN \
+int libfwps_get_value_type_statistics(
+     uint32_t value_type,
+     uint64_t *number_of_records,
+     uint64_t *value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWPS_TRACE_H ) */
+
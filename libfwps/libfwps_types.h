@@ -37,14 +37,141 @@
 typedef struct libfwps_record {}	libfwps_record_t;
 typedef struct libfwps_set {}		libfwps_set_t;
 typedef struct libfwps_store {}		libfwps_store_t;
+typedef struct libfwps_store_cache {}	libfwps_store_cache_t;
 
 #else
 typedef intptr_t libfwps_record_t;
 typedef intptr_t libfwps_set_t;
 typedef intptr_t libfwps_store_t;
+typedef intptr_t libfwps_store_cache_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The allocation statistics
+ */
+typedef struct libfwps_statistics libfwps_statistics_t;
+
+struct libfwps_statistics
+{
+	/* The total number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The total number of bytes allocated
+	 */
+	uint64_t allocated_size;
+
+	/* The number of bytes currently allocated
+	 */
+	uint64_t live_size;
+
+	/* The peak number of bytes allocated at the same time
+	 */
+	uint64_t peak_live_size;
+
+	/* The number of allocations of store, set and record structures
+	 */
+	uint64_t number_of_store_allocations;
+	uint64_t number_of_set_allocations;
+	uint64_t number_of_record_allocations;
+
+	/* The number of allocations of entry and value names
+	 */
+	uint64_t number_of_name_allocations;
+
+	/* The number of allocations of value data
+	 */
+	uint64_t number_of_value_allocations;
+
+	/* The number of allocations of store caches and their entries and data
+	 */
+	uint64_t number_of_store_cache_allocations;
+
+	/* The number of allocations of hash contexts
+	 */
+	uint64_t number_of_hash_context_allocations;
+
+	/* The number of allocations of anomalies
+	 */
+	uint64_t number_of_anomaly_allocations;
+
+	/* The number of allocations of entries used to sort records and sets
+	 */
+	uint64_t number_of_index_allocations;
+};
+
+/* The parse trace event
+ */
+typedef struct libfwps_trace_event libfwps_trace_event_t;
+
+struct libfwps_trace_event
+{
+	/* The stage, which contains a LIBFWPS_TRACE_STAGE value
+	 */
+	int stage;
+
+	/* The event type, which contains a LIBFWPS_TRACE_EVENT_TYPE value
+	 */
+	int event_type;
+
+	/* The timestamp of a monotonic clock in nanoseconds
+	 */
+	uint64_t timestamp;
+
+	/* The format class identifier of the set or NULL if not available
+	 * The identifier is a little-endian GUID and is 16 bytes of size
+	 */
+	const uint8_t *format_class_identifier;
+
+	/* The value type of the record or 0 if not available
+	 */
+	uint32_t value_type;
+
+	/* The size of the data being read or converted
+	 */
+	size_t data_size;
+
+	/* The result, which is 1 if successful or -1 on error and
+	 * only set for end events
+	 */
+	int result;
+};
+
+/* The diagnostic event
+ */
+typedef struct libfwps_diagnostic_event libfwps_diagnostic_event_t;
+
+struct libfwps_diagnostic_event
+{
+	/* The event type, which contains a LIBFWPS_DIAGNOSTIC_EVENT_TYPE value
+	 */
+	int event_type;
+
+	/* The offset of the set or record relative to the start of the data it was read from
+	 */
+	off64_t offset;
+
+	/* The size of the set or record
+	 */
+	size64_t size;
+
+	/* The value type of the record or 0 if not available
+	 */
+	uint32_t value_type;
+
+	/* The decision, which contains a LIBFWPS_DIAGNOSTIC_DECISION value
+	 */
+	int decision;
+
+	/* The anomaly flags, which contains LIBFWPS_DIAGNOSTIC_ANOMALY_FLAG values
+	 */
+	uint8_t anomaly_flags;
+
+	/* The parse error code, which contains a LIBFWPS_PARSE_ERROR value
+	 */
+	int parse_error_code;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFWPS ) */
 
 #endif /* !defined( _LIBFWPS_INTERNAL_TYPES_H ) */
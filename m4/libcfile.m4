@@ -0,0 +1,213 @@
+dnl Checks for libcfile required headers and functions
+dnl
+dnl Version: 20240519
+
+dnl Function to detect if libcfile is available
+dnl ac_libcfile_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBCFILE_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_libcfile" = xno],
+    [ac_cv_libcfile=no],
+    [ac_cv_libcfile=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-libcfile which returns "yes" and --with-libcfile= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_libcfile" != x && test "x$ac_cv_with_libcfile" != xauto-detect && test "x$ac_cv_with_libcfile" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([libcfile])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [libcfile],
+          [libcfile >= 20160409],
+          [ac_cv_libcfile=yes],
+          [ac_cv_libcfile=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_libcfile" = xyes],
+        [ac_cv_libcfile_CPPFLAGS="$pkg_cv_libcfile_CFLAGS"
+        ac_cv_libcfile_LIBADD="$pkg_cv_libcfile_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_libcfile" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([libcfile.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_libcfile_h" = xno],
+        [ac_cv_libcfile=no],
+        [ac_cv_libcfile=yes
+
+        AX_CHECK_LIB_FUNCTIONS(
+          [libcfile],
+          [cfile],
+          [[libcfile_get_version],
+           [libcfile_file_initialize],
+           [libcfile_file_free],
+           [libcfile_file_open],
+           [libcfile_file_open_with_error_code],
+           [libcfile_file_close],
+           [libcfile_file_read_buffer],
+           [libcfile_file_read_buffer_with_error_code],
+           [libcfile_file_write_buffer],
+           [libcfile_file_write_buffer_with_error_code],
+           [libcfile_file_seek_offset],
+           [libcfile_file_resize],
+           [libcfile_file_is_open],
+           [libcfile_file_get_offset],
+           [libcfile_file_get_size],
+           [libcfile_file_is_device],
+           [libcfile_file_io_control_read],
+           [libcfile_file_io_control_read_with_error_code],
+           [libcfile_file_exists],
+           [libcfile_file_remove]])
+
+        ac_cv_libcfile_LIBADD="-lcfile"])
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([libcfile])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcfile" = xyes],
+    [AC_DEFINE(
+      [HAVE_LIBCFILE],
+      [1],
+      [Define to 1 if you have the `cfile' library (-lcfile).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcfile" = xyes],
+    [AC_SUBST(
+      [HAVE_LIBCFILE],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBCFILE],
+      [0])
+    ])
+  ])
+
+dnl Function to detect if libcfile dependencies are available
+AC_DEFUN([AX_LIBCFILE_CHECK_LOCAL],
+  [dnl Headers included in libcfile/libcfile_file.c and libcfile/libcfile_support.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/stat.h unistd.h])
+
+  dnl Functions used in libcfile/libcfile_file.c and libcfile/libcfile_support.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([close fstat ftruncate lseek open read stat unlink write])
+
+    AS_IF(
+      [test "x$ac_cv_func_close" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: close],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_fstat" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: fstat],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_lseek" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: lseek],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_open" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: open],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_read" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: read],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_stat" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing function: stat],
+        [1])
+      ])
+
+    AC_CHECK_FUNCS([posix_fadvise])
+    ])
+
+  ac_cv_libcfile_CPPFLAGS="-I../libcfile -I\$(top_srcdir)/libcfile";
+  ac_cv_libcfile_LIBADD="../libcfile/libcfile.la";
+
+  ac_cv_libcfile=local
+  ])
+
+
+dnl Function to detect how to enable libcfile
+AC_DEFUN([AX_LIBCFILE_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [libcfile],
+    [libcfile],
+    [search for libcfile in includedir and libdir or in the specified DIR, or no if to use local version],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBCFILE_CHECK_LIB
+
+  dnl Check if the dependencies for the local library version
+  AS_IF(
+    [test "x$ac_cv_libcfile" != xyes],
+    [AX_LIBCFILE_CHECK_LOCAL
+
+    AC_DEFINE(
+      [HAVE_LOCAL_LIBCFILE],
+      [1],
+      [Define to 1 if the local version of libcfile is used.])
+    AC_SUBST(
+      [HAVE_LOCAL_LIBCFILE],
+      [1])
+    ])
+
+  AM_CONDITIONAL(
+    [HAVE_LOCAL_LIBCFILE],
+    [test "x$ac_cv_libcfile" = xlocal])
+  AS_IF(
+    [test "x$ac_cv_libcfile_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBCFILE_CPPFLAGS],
+      [$ac_cv_libcfile_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libcfile_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBCFILE_LIBADD],
+      [$ac_cv_libcfile_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcfile" = xyes],
+    [AC_SUBST(
+      [ax_libcfile_pc_libs_private],
+      [-lcfile])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcfile" = xyes],
+    [AC_SUBST(
+      [ax_libcfile_spec_requires],
+      [libcfile])
+    AC_SUBST(
+      [ax_libcfile_spec_build_requires],
+      [libcfile-devel])
+    ])
+  ])
+
@@ -0,0 +1,173 @@
+dnl Checks for libcpath required headers and functions
+dnl
+dnl Version: 20240519
+
+dnl Function to detect if libcpath is available
+dnl ac_libcpath_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_LIBCPATH_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_shared_libs" = xno || test "x$ac_cv_with_libcpath" = xno],
+    [ac_cv_libcpath=no],
+    [ac_cv_libcpath=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-libcpath which returns "yes" and --with-libcpath= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_libcpath" != x && test "x$ac_cv_with_libcpath" != xauto-detect && test "x$ac_cv_with_libcpath" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([libcpath])],
+      [dnl Check for a pkg-config file
+      AS_IF(
+        [test "x$cross_compiling" != "xyes" && test "x$PKGCONFIG" != "x"],
+        [PKG_CHECK_MODULES(
+          [libcpath],
+          [libcpath >= 20180716],
+          [ac_cv_libcpath=yes],
+          [ac_cv_libcpath=check])
+        ])
+      AS_IF(
+        [test "x$ac_cv_libcpath" = xyes],
+        [ac_cv_libcpath_CPPFLAGS="$pkg_cv_libcpath_CFLAGS"
+        ac_cv_libcpath_LIBADD="$pkg_cv_libcpath_LIBS"])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_libcpath" = xcheck],
+      [dnl Check for headers
+      AC_CHECK_HEADERS([libcpath.h])
+
+      AS_IF(
+        [test "x$ac_cv_header_libcpath_h" = xno],
+        [ac_cv_libcpath=no],
+        [ac_cv_libcpath=yes
+
+        AX_CHECK_LIB_FUNCTIONS(
+          [libcpath],
+          [cpath],
+          [[libcpath_get_version],
+           [libcpath_path_change_directory],
+           [libcpath_path_get_current_working_directory],
+           [libcpath_path_get_full_path],
+           [libcpath_path_get_sanitized_filename],
+           [libcpath_path_get_sanitized_path],
+           [libcpath_path_join],
+           [libcpath_path_make_directory]])
+
+        ac_cv_libcpath_LIBADD="-lcpath"])
+      ])
+
+    AX_CHECK_LIB_DIRECTORY_MSG_ON_FAILURE([libcpath])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcpath" = xyes],
+    [AC_DEFINE(
+      [HAVE_LIBCPATH],
+      [1],
+      [Define to 1 if you have the `cpath' library (-lcpath).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcpath" = xyes],
+    [AC_SUBST(
+      [HAVE_LIBCPATH],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_LIBCPATH],
+      [0])
+    ])
+  ])
+
+dnl Function to detect if libcpath dependencies are available
+AC_DEFUN([AX_LIBCPATH_CHECK_LOCAL],
+  [dnl Headers included in libcpath/libcpath_path.h
+  AC_CHECK_HEADERS([errno.h sys/stat.h sys/syslimits.h])
+
+  dnl Functions used in libcpath/libcpath_path.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([chdir getcwd])
+
+    AS_IF(
+      [test "x$ac_cv_func_chdir" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing functions: chdir],
+        [1])
+      ])
+
+    AS_IF(
+      [test "x$ac_cv_func_getcwd" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing functions: getcwd],
+        [1])
+      ])
+    ])
+
+  AC_CHECK_FUNCS([mkdir])
+
+  ac_cv_libcpath_CPPFLAGS="-I../libcpath -I\$(top_srcdir)/libcpath";
+  ac_cv_libcpath_LIBADD="../libcpath/libcpath.la";
+
+  ac_cv_libcpath=local
+  ])
+
+
+dnl Function to detect how to enable libcpath
+AC_DEFUN([AX_LIBCPATH_CHECK_ENABLE],
+  [AX_COMMON_ARG_WITH(
+    [libcpath],
+    [libcpath],
+    [search for libcpath in includedir and libdir or in the specified DIR, or no if to use local version],
+    [auto-detect],
+    [DIR])
+
+  dnl Check for a shared library version
+  AX_LIBCPATH_CHECK_LIB
+
+  dnl Check if the dependencies for the local library version
+  AS_IF(
+    [test "x$ac_cv_libcpath" != xyes],
+    [AX_LIBCPATH_CHECK_LOCAL
+
+    AC_DEFINE(
+      [HAVE_LOCAL_LIBCPATH],
+      [1],
+      [Define to 1 if the local version of libcpath is used.])
+    AC_SUBST(
+      [HAVE_LOCAL_LIBCPATH],
+      [1])
+    ])
+
+  AM_CONDITIONAL(
+    [HAVE_LOCAL_LIBCPATH],
+    [test "x$ac_cv_libcpath" = xlocal])
+  AS_IF(
+    [test "x$ac_cv_libcpath_CPPFLAGS" != "x"],
+    [AC_SUBST(
+      [LIBCPATH_CPPFLAGS],
+      [$ac_cv_libcpath_CPPFLAGS])
+    ])
+  AS_IF(
+    [test "x$ac_cv_libcpath_LIBADD" != "x"],
+    [AC_SUBST(
+      [LIBCPATH_LIBADD],
+      [$ac_cv_libcpath_LIBADD])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcpath" = xyes],
+    [AC_SUBST(
+      [ax_libcpath_pc_libs_private],
+      [-lcpath])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_libcpath" = xyes],
+    [AC_SUBST(
+      [ax_libcpath_spec_requires],
+      [libcpath])
+    AC_SUBST(
+      [ax_libcpath_spec_build_requires],
+      [libcpath-devel])
+    ])
+  ])
+
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -30,9 +31,11 @@
 #include "pyfwps.h"
 #include "pyfwps_error.h"
 #include "pyfwps_libcerror.h"
+#include "pyfwps_libcthreads.h"
 #include "pyfwps_libfwps.h"
 #include "pyfwps_python.h"
 #include "pyfwps_record.h"
+#include "pyfwps_record_scanner.h"
 #include "pyfwps_records.h"
 #include "pyfwps_set.h"
 #include "pyfwps_sets.h"
@@ -49,6 +52,27 @@ PyMethodDef pyfwps_module_methods[] = {
 	  "\n"
 	  "Retrieves the version." },
 
+	{ "parse_many",
+	  (PyCFunction) pyfwps_parse_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "parse_many(byte_streams, threads=1) -> List\n"
+	  "\n"
+	  "Parses a store from each byte stream and returns a list of stores.\n"
+	  "The byte streams can be any object that supports the buffer protocol.\n"
+	  "The stores are parsed without holding the GIL, using a native thread\n"
+	  "pool when threads is larger than 1." },
+
+	{ "iter_records",
+	  (PyCFunction) pyfwps_iter_records,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_records(byte_stream) -> Iterator\n"
+	  "\n"
+	  "Iterates over the records of a store in the byte stream without creating\n"
+	  "store, set or record objects. Each record is returned as a tuple of\n"
+	  "the set identifier, the entry type or entry name, the value type and the value.\n"
+	  "The byte stream can be any object that supports the buffer protocol,\n"
+	  "and is scanned one set at a time." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -85,6 +109,382 @@ PyObject *pyfwps_get_version(
 	         NULL ) );
 }
 
+/* Parses the store of a parse job
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_parse_job_run(
+     pyfwps_parse_job_t *parse_job,
+     void *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( parse_job == NULL )
+	{
+		return( -1 );
+	}
+	parse_job->result = libfwps_store_copy_from_byte_stream(
+	                     parse_job->store,
+	                     parse_job->byte_stream,
+	                     parse_job->byte_stream_size,
+	                     LIBFWPS_CODEPAGE_WINDOWS_1252,
+	                     &( parse_job->error ) );
+
+	/* The result of the job is checked after the thread pool was joined
+	 */
+	return( 1 );
+}
+
+/* Parses stores from multiple byte streams
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_parse_many(
+           PyObject *self PYFWPS_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *list_object            = NULL;
+	PyObject *sequence_object        = NULL;
+	PyObject *store_object           = NULL;
+	PyObject *byte_streams_object    = NULL;
+	Py_buffer *buffers               = NULL;
+	libcerror_error_t *error         = NULL;
+	pyfwps_parse_job_t *parse_jobs   = NULL;
+	static char *function            = "pyfwps_parse_many";
+	static char *keyword_list[]      = { "byte_streams", "threads", NULL };
+	Py_ssize_t job_index             = 0;
+	Py_ssize_t number_of_buffers     = 0;
+	Py_ssize_t number_of_jobs        = 0;
+	int number_of_threads            = 1;
+	int result                       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	PYFWPS_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &byte_streams_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_threads < 1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   byte_streams_object,
+	                   "byte streams must be a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_jobs = PySequence_Fast_GET_SIZE(
+	                  sequence_object );
+
+	if( ( number_of_jobs < 0 )
+	 || ( number_of_jobs > (Py_ssize_t) INT_MAX )
+	 || ( (size_t) number_of_jobs > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( pyfwps_parse_job_t ) ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of byte streams value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               number_of_jobs );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_jobs == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	parse_jobs = (pyfwps_parse_job_t *) PyMem_Malloc(
+	                                     sizeof( pyfwps_parse_job_t ) * number_of_jobs );
+
+	if( parse_jobs == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create parse jobs.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 parse_jobs,
+	 0,
+	 sizeof( pyfwps_parse_job_t ) * number_of_jobs );
+
+	buffers = (Py_buffer *) PyMem_Malloc(
+	                         sizeof( Py_buffer ) * number_of_jobs );
+
+	if( buffers == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffers remain pinned until all parse jobs have completed
+	 */
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( PyObject_GetBuffer(
+		     PySequence_Fast_GET_ITEM(
+		      sequence_object,
+		      job_index ),
+		     &( buffers[ job_index ] ),
+		     PyBUF_SIMPLE ) != 0 )
+		{
+			pyfwps_error_fetch_and_raise(
+			 PyExc_TypeError,
+			 "%s: unsupported byte stream object type of byte stream: %" PRIzd ".",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+		number_of_buffers++;
+
+		if( libfwps_store_initialize(
+		     &( parse_jobs[ job_index ].store ),
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to initialize store.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		parse_jobs[ job_index ].byte_stream      = (uint8_t *) buffers[ job_index ].buf;
+		parse_jobs[ job_index ].byte_stream_size = (size_t) buffers[ job_index ].len;
+	}
+	if( (Py_ssize_t) number_of_threads > number_of_jobs )
+	{
+		number_of_threads = (int) number_of_jobs;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		result = libcthreads_thread_pool_create(
+		          &thread_pool,
+		          NULL,
+		          number_of_threads,
+		          (int) number_of_jobs,
+		          (int (*)(intptr_t *, void *)) &pyfwps_parse_job_run,
+		          NULL,
+		          &error );
+
+		for( job_index = 0;
+		     ( result == 1 ) && ( job_index < number_of_jobs );
+		     job_index++ )
+		{
+			result = libcthreads_thread_pool_push(
+			          thread_pool,
+			          (intptr_t *) &( parse_jobs[ job_index ] ),
+			          &error );
+		}
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     ( result == 1 ) ? &error : NULL ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			pyfwps_parse_job_run(
+			 &( parse_jobs[ job_index ] ),
+			 NULL );
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_RuntimeError,
+		 "%s: unable to run parse jobs.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( parse_jobs[ job_index ].result != 1 )
+		{
+			pyfwps_error_raise(
+			 parse_jobs[ job_index ].error,
+			 PyExc_IOError,
+			 "%s: unable to copy store: %" PRIzd " from byte stream.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		store_object = pyfwps_store_new(
+		                parse_jobs[ job_index ].store );
+
+		if( store_object == NULL )
+		{
+			goto on_error;
+		}
+		parse_jobs[ job_index ].store = NULL;
+
+		/* PyList_SET_ITEM steals the reference to the store object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 job_index,
+		 store_object );
+	}
+	for( job_index = 0;
+	     job_index < number_of_buffers;
+	     job_index++ )
+	{
+		PyBuffer_Release(
+		 &( buffers[ job_index ] ) );
+	}
+	PyMem_Free(
+	 buffers );
+
+	PyMem_Free(
+	 parse_jobs );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( buffers != NULL )
+	{
+		for( job_index = 0;
+		     job_index < number_of_buffers;
+		     job_index++ )
+		{
+			PyBuffer_Release(
+			 &( buffers[ job_index ] ) );
+		}
+		PyMem_Free(
+		 buffers );
+	}
+	if( parse_jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( parse_jobs[ job_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( parse_jobs[ job_index ].error ) );
+			}
+			if( parse_jobs[ job_index ].store != NULL )
+			{
+				libfwps_store_free(
+				 &( parse_jobs[ job_index ].store ),
+				 NULL );
+			}
+		}
+		PyMem_Free(
+		 parse_jobs );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
+/* Iterates over the records of a store in a byte stream
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_iter_records(
+           PyObject *self PYFWPS_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *bytes_object      = NULL;
+	static char *keyword_list[] = { "byte_stream", NULL };
+
+	PYFWPS_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &bytes_object ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyfwps_record_scanner_new(
+	         bytes_object,
+	         LIBFWPS_CODEPAGE_WINDOWS_1252 ) );
+}
+
 #if PY_MAJOR_VERSION >= 3
 
 /* The pyfwps module definition
@@ -193,6 +593,23 @@ PyMODINIT_FUNC initpyfwps(
 	 "records",
 	 (PyObject *) &pyfwps_records_type_object );
 
+	/* Setup the record scanner type object
+	 */
+	pyfwps_record_scanner_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfwps_record_scanner_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfwps_record_scanner_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "record_scanner",
+	 (PyObject *) &pyfwps_record_scanner_type_object );
+
 	/* Setup the set type object
 	 */
 	pyfwps_set_type_object.tp_new = PyType_GenericNew;
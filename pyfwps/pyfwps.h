@@ -25,16 +25,57 @@
 #include <common.h>
 #include <types.h>
 
+#include "pyfwps_libcerror.h"
+#include "pyfwps_libfwps.h"
 #include "pyfwps_python.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct pyfwps_parse_job pyfwps_parse_job_t;
+
+struct pyfwps_parse_job
+{
+	/* The libfwps store
+	 */
+	libfwps_store_t *store;
+
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The parse result
+	 */
+	int result;
+
+	/* The parse error
+	 */
+	libcerror_error_t *error;
+};
+
 PyObject *pyfwps_get_version(
            PyObject *self,
            PyObject *arguments );
 
+int pyfwps_parse_job_run(
+     pyfwps_parse_job_t *parse_job,
+     void *arguments );
+
+PyObject *pyfwps_parse_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwps_iter_records(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if PY_MAJOR_VERSION >= 3
 PyMODINIT_FUNC PyInit_pyfwps(
                 void );
@@ -0,0 +1,131 @@
+/*
+ * Date and time functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfwps_datetime.h"
+#include "pyfwps_python.h"
+
+#include <datetime.h>
+
+/* Creates a new datetime object from a FILETIME
+ * The FILETIME is the number of 100th nano seconds since January 1, 1601 (UTC)
+ * The datetime object is in UTC, and has a UTC timezone on Python 3.7 or later
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_datetime_new_from_filetime(
+           uint64_t filetime )
+{
+	PyObject *datetime_object = NULL;
+	static char *function     = "pyfwps_datetime_new_from_filetime";
+	uint64_t day_of_era       = 0;
+	uint64_t day_of_year      = 0;
+	uint64_t era              = 0;
+	uint64_t number_of_days   = 0;
+	uint64_t year             = 0;
+	uint64_t year_of_era      = 0;
+	uint32_t micro_seconds    = 0;
+	uint8_t day_of_month      = 0;
+	uint8_t hours             = 0;
+	uint8_t minutes           = 0;
+	uint8_t month             = 0;
+	uint8_t month_from_march  = 0;
+	uint8_t seconds           = 0;
+
+	/* The timestamp is in units of 100 nano seconds correct the value to micro seconds
+	 */
+	micro_seconds = (uint32_t) ( ( filetime % 10000000 ) / 10 );
+	filetime     /= 10000000;
+
+	seconds   = (uint8_t) ( filetime % 60 );
+	filetime /= 60;
+
+	minutes   = (uint8_t) ( filetime % 60 );
+	filetime /= 60;
+
+	hours     = (uint8_t) ( filetime % 24 );
+	filetime /= 24;
+
+	/* Determine the date from the number of days relative to March 1, 0000
+	 * in eras of 400 years, where January 1, 1601 is 584694 days after March 1, 0000
+	 */
+	number_of_days = filetime + 584694;
+
+	era         = number_of_days / 146097;
+	day_of_era  = number_of_days - ( era * 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+	month_from_march = (uint8_t) ( ( ( 5 * day_of_year ) + 2 ) / 153 );
+	day_of_month     = (uint8_t) ( day_of_year - ( ( ( 153 * month_from_march ) + 2 ) / 5 ) + 1 );
+
+	if( month_from_march < 10 )
+	{
+		month = month_from_march + 3;
+	}
+	else
+	{
+		month = month_from_march - 9;
+	}
+	year = year_of_era + ( era * 400 );
+
+	if( month <= 2 )
+	{
+		year += 1;
+	}
+	/* The datetime object only supports years up to 9999
+	 */
+	if( year > 9999 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid FILETIME value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	PyDateTime_IMPORT;
+
+#if PY_VERSION_HEX >= 0x03070000
+	datetime_object = (PyObject *) PyDateTimeAPI->DateTime_FromDateAndTime(
+	                                (int) year,
+	                                (int) month,
+	                                (int) day_of_month,
+	                                (int) hours,
+	                                (int) minutes,
+	                                (int) seconds,
+	                                (int) micro_seconds,
+	                                PyDateTime_TimeZone_UTC,
+	                                PyDateTimeAPI->DateTimeType );
+#else
+	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
+	                                (int) year,
+	                                (int) month,
+	                                (int) day_of_month,
+	                                (int) hours,
+	                                (int) minutes,
+	                                (int) seconds,
+	                                (int) micro_seconds );
+#endif
+	return( datetime_object );
+}
+
@@ -0,0 +1,42 @@
+/*
+ * Date and time functions
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFWPS_DATETIME_H )
+#define _PYFWPS_DATETIME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfwps_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+PyObject *pyfwps_datetime_new_from_filetime(
+           uint64_t filetime );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFWPS_DATETIME_H ) */
+
@@ -128,3 +128,231 @@ on_error:
 	return( NULL );
 }
 
+/* Copies a GUID string to a byte stream
+ * The string can be formatted with or without surrounding braces
+ * The byte stream contains a little-endian GUID and must be 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_guid_copy_from_utf8_string(
+     const char *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *guid_buffer,
+     size_t guid_buffer_size )
+{
+	libcerror_error_t *error     = NULL;
+	libfguid_identifier_t *guid  = NULL;
+	static char *function        = "pyfwps_guid_copy_from_utf8_string";
+	uint32_t string_format_flags = LIBFGUID_STRING_FORMAT_FLAG_USE_MIXED_CASE;
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ 0 ] == '{' ) )
+	{
+		string_format_flags |= LIBFGUID_STRING_FORMAT_FLAG_USE_SURROUNDING_BRACES;
+	}
+	if( libfguid_identifier_initialize(
+	     &guid,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to create GUID.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_utf8_string(
+	     guid,
+	     (uint8_t *) utf8_string,
+	     utf8_string_length,
+	     string_format_flags,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_ValueError,
+		 "%s: unsupported GUID string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_to_byte_stream(
+	     guid,
+	     guid_buffer,
+	     guid_buffer_size,
+	     LIBFGUID_ENDIAN_LITTLE,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to copy GUID to byte stream.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_free(
+	     &guid,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to free GUID.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( guid != NULL )
+	{
+		libfguid_identifier_free(
+		 &guid,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a new UUID object from a GUID
+ * The UUID type object is imported from the uuid module if not provided
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_uuid_new_from_guid(
+           PyObject *uuid_type_object,
+           const uint8_t *guid_buffer,
+           size_t guid_buffer_size )
+{
+	PyObject *arguments_object = NULL;
+	PyObject *bytes_object     = NULL;
+	PyObject *keywords_object  = NULL;
+	PyObject *module_object    = NULL;
+	PyObject *uuid_object      = NULL;
+	static char *function      = "pyfwps_uuid_new_from_guid";
+
+	if( guid_buffer == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid GUID buffer.",
+		 function );
+
+		return( NULL );
+	}
+	if( guid_buffer_size < 16 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid GUID buffer size value too small.",
+		 function );
+
+		return( NULL );
+	}
+	if( uuid_type_object == NULL )
+	{
+		module_object = PyImport_ImportModule(
+		                 "uuid" );
+
+		if( module_object == NULL )
+		{
+			goto on_error;
+		}
+		uuid_type_object = PyObject_GetAttrString(
+		                    module_object,
+		                    "UUID" );
+
+		Py_DecRef(
+		 module_object );
+
+		if( uuid_type_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	else
+	{
+		Py_IncRef(
+		 uuid_type_object );
+	}
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                (char *) guid_buffer,
+	                16 );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                (char *) guid_buffer,
+	                16 );
+#endif
+	if( bytes_object == NULL )
+	{
+		goto on_error;
+	}
+	/* The GUID is stored in little-endian as expected by the bytes_le argument
+	 */
+	keywords_object = Py_BuildValue(
+	                   "{s:O}",
+	                   "bytes_le",
+	                   bytes_object );
+
+	if( keywords_object == NULL )
+	{
+		goto on_error;
+	}
+	arguments_object = PyTuple_New(
+	                    0 );
+
+	if( arguments_object == NULL )
+	{
+		goto on_error;
+	}
+	uuid_object = PyObject_Call(
+	               uuid_type_object,
+	               arguments_object,
+	               keywords_object );
+
+on_error:
+	if( arguments_object != NULL )
+	{
+		Py_DecRef(
+		 arguments_object );
+	}
+	if( keywords_object != NULL )
+	{
+		Py_DecRef(
+		 keywords_object );
+	}
+	if( bytes_object != NULL )
+	{
+		Py_DecRef(
+		 bytes_object );
+	}
+	if( uuid_type_object != NULL )
+	{
+		Py_DecRef(
+		 uuid_type_object );
+	}
+	return( uuid_object );
+}
+
@@ -35,6 +35,17 @@ PyObject *pyfwps_string_new_from_guid(
            const uint8_t *guid_buffer,
            size_t guid_buffer_size );
 
+PyObject *pyfwps_uuid_new_from_guid(
+           PyObject *uuid_type_object,
+           const uint8_t *guid_buffer,
+           size_t guid_buffer_size );
+
+int pyfwps_guid_copy_from_utf8_string(
+     const char *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *guid_buffer,
+     size_t guid_buffer_size );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -19,13 +19,16 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "pyfwps_datetime.h"
 #include "pyfwps_error.h"
 #include "pyfwps_guid.h"
 #include "pyfwps_integer.h"
@@ -33,11 +36,21 @@
 #include "pyfwps_libfwps.h"
 #include "pyfwps_python.h"
 #include "pyfwps_record.h"
+#include "pyfwps_set.h"
+#include "pyfwps_store.h"
 #include "pyfwps_string.h"
 #include "pyfwps_unused.h"
 
 PyMethodDef pyfwps_record_object_methods[] = {
 
+	{ "__reduce__",
+	  (PyCFunction) pyfwps_record_reduce,
+	  METH_NOARGS,
+	  "__reduce__() -> Tuple\n"
+	  "\n"
+	  "Reduces the record for pickling.\n"
+	  "The record is pickled as its set and its index in that set." },
+
 	{ "get_entry_name",
 	  (PyCFunction) pyfwps_record_get_entry_name,
 	  METH_NOARGS,
@@ -73,6 +86,23 @@ PyMethodDef pyfwps_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the data." },
 
+	{ "get_data_view",
+	  (PyCFunction) pyfwps_record_get_data_view,
+	  METH_NOARGS,
+	  "get_data_view() -> memoryview or None\n"
+	  "\n"
+	  "Retrieves a read-only view of the data.\n"
+	  "\n"
+	  "The view refers directly to the data of the record when it is available in memory\n"
+	  "otherwise it refers to a copy of the data." },
+
+	{ "get_data_as_array",
+	  (PyCFunction) pyfwps_record_get_data_as_array,
+	  METH_NOARGS,
+	  "get_data_as_array() -> array.array\n"
+	  "\n"
+	  "Retrieves the data of a fixed-size value or vector of values as an array." },
+
 	{ "get_data_as_boolean",
 	  (PyCFunction) pyfwps_record_get_data_as_boolean,
 	  METH_NOARGS,
@@ -115,6 +145,34 @@ PyMethodDef pyfwps_record_object_methods[] = {
 	  "\n"
 	  "Retrieves the data as a GUID value." },
 
+	{ "get_data_as_datetime",
+	  (PyCFunction) pyfwps_record_get_data_as_datetime,
+	  METH_NOARGS,
+	  "get_data_as_datetime() -> Datetime\n"
+	  "\n"
+	  "Retrieves the data as a datetime object in UTC." },
+
+	{ "get_data_as_datetimes",
+	  (PyCFunction) pyfwps_record_get_data_as_datetimes,
+	  METH_NOARGS,
+	  "get_data_as_datetimes() -> List of datetimes\n"
+	  "\n"
+	  "Retrieves the data of a FILETIME value or vector of values as datetime objects in UTC." },
+
+	{ "get_data_as_uuid",
+	  (PyCFunction) pyfwps_record_get_data_as_uuid,
+	  METH_NOARGS,
+	  "get_data_as_uuid() -> UUID\n"
+	  "\n"
+	  "Retrieves the data as an UUID object." },
+
+	{ "get_data_as_uuids",
+	  (PyCFunction) pyfwps_record_get_data_as_uuids,
+	  METH_NOARGS,
+	  "get_data_as_uuids() -> List of UUIDs\n"
+	  "\n"
+	  "Retrieves the data of a GUID value or vector of values as UUID objects." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -151,6 +209,12 @@ PyGetSetDef pyfwps_record_object_get_set_definitions[] = {
 	  "The data.",
 	  NULL },
 
+	{ "data_view",
+	  (getter) pyfwps_record_get_data_view,
+	  (setter) 0,
+	  "The data as a read-only view.",
+	  NULL },
+
 	{ "data_as_boolean",
 	  (getter) pyfwps_record_get_data_as_boolean,
 	  (setter) 0,
@@ -191,6 +255,15 @@ PyGetSetDef pyfwps_record_object_get_set_definitions[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+#if PY_MAJOR_VERSION >= 3
+PyBufferProcs pyfwps_record_buffer_procs = {
+	/* bf_getbuffer */
+	(getbufferproc) pyfwps_record_get_buffer,
+	/* bf_releasebuffer */
+	(releasebufferproc) pyfwps_record_release_buffer
+};
+#endif
+
 PyTypeObject pyfwps_record_type_object = {
 	PyVarObject_HEAD_INIT( NULL, 0 )
 
@@ -229,13 +302,17 @@ PyTypeObject pyfwps_record_type_object = {
 	/* tp_setattro */
 	0,
 	/* tp_as_buffer */
+#if PY_MAJOR_VERSION >= 3
+	&pyfwps_record_buffer_procs,
+#else
 	0,
+#endif
 	/* tp_flags */
-	Py_TPFLAGS_DEFAULT,
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
 	/* tp_doc */
 	"pyfwps record object (wraps libfwps_record_t)",
 	/* tp_traverse */
-	0,
+	(traverseproc) pyfwps_record_traverse,
 	/* tp_clear */
 	0,
 	/* tp_richcompare */
@@ -307,7 +384,7 @@ PyObject *pyfwps_record_new(
 	}
 	/* PyObject_New does not invoke tp_init
 	 */
-	pyfwps_record = PyObject_New(
+	pyfwps_record = PyObject_GC_New(
 	                 struct pyfwps_record,
 	                 &pyfwps_record_type_object );
 
@@ -328,6 +405,9 @@ PyObject *pyfwps_record_new(
 		Py_IncRef(
 		 pyfwps_record->parent_object );
 	}
+	PyObject_GC_Track(
+	 (PyObject *) pyfwps_record );
+
 	return( (PyObject *) pyfwps_record );
 
 on_error:
@@ -408,6 +488,9 @@ void pyfwps_record_free(
 
 		return;
 	}
+	PyObject_GC_UnTrack(
+	 (PyObject *) pyfwps_record );
+
 	if( pyfwps_record->record != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -439,6 +522,136 @@ void pyfwps_record_free(
 	 (PyObject*) pyfwps_record );
 }
 
+/* Traverses the parent object of a record object
+ * Returns 0 if successful or the result of the visit function otherwise
+ */
+int pyfwps_record_traverse(
+     pyfwps_record_t *pyfwps_record,
+     visitproc visit,
+     void *arg )
+{
+	Py_VISIT(
+	 pyfwps_record->parent_object );
+
+	return( 0 );
+}
+
+/* Reduces the record for pickling
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_reduce(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *method_object  = NULL;
+	PyObject *reduce_object  = NULL;
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	libfwps_set_t *set       = NULL;
+	static char *function    = "pyfwps_record_reduce";
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( pyfwps_record->parent_object == NULL )
+	 || ( PyObject_TypeCheck(
+	       pyfwps_record->parent_object,
+	       &pyfwps_set_type_object ) == 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unable to pickle record without set.",
+		 function );
+
+		return( NULL );
+	}
+	set = ( (pyfwps_set_t *) pyfwps_record->parent_object )->set;
+
+	if( libfwps_set_get_number_of_records(
+	     set,
+	     &number_of_records,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* The record does not know its index so look it up in the set
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfwps_set_get_record_by_index(
+		     set,
+		     record_index,
+		     &record,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( record == pyfwps_record->record )
+		{
+			break;
+		}
+	}
+	if( record_index >= number_of_records )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to find record in set.",
+		 function );
+
+		return( NULL );
+	}
+	/* Unpickling retrieves the record from the unpickled set
+	 */
+	method_object = PyObject_GetAttrString(
+	                 pyfwps_record->parent_object,
+	                 "get_record" );
+
+	if( method_object == NULL )
+	{
+		return( NULL );
+	}
+	reduce_object = Py_BuildValue(
+	                 "O(i)",
+	                 method_object,
+	                 record_index );
+
+	Py_DecRef(
+	 method_object );
+
+	return( reduce_object );
+}
+
 /* Retrieves the entry name
  * Returns a Python object if successful or NULL on error
  */
@@ -464,15 +677,11 @@ PyObject *pyfwps_record_get_entry_name(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_utf8_entry_name_size(
 	          pyfwps_record->record,
 	          &utf8_string_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result == -1 )
 	{
 		pyfwps_error_raise(
@@ -506,16 +715,12 @@ PyObject *pyfwps_record_get_entry_name(
 
 		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_utf8_entry_name(
 	          pyfwps_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -584,15 +789,11 @@ PyObject *pyfwps_record_get_entry_type(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_entry_type(
 	          pyfwps_record->record,
 	          &value_32bit,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result == -1 )
 	{
 		pyfwps_error_raise(
@@ -644,15 +845,11 @@ PyObject *pyfwps_record_get_value_name(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_utf8_value_name_size(
 	          pyfwps_record->record,
 	          &utf8_string_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result == -1 )
 	{
 		pyfwps_error_raise(
@@ -686,16 +883,12 @@ PyObject *pyfwps_record_get_value_name(
 
 		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_utf8_value_name(
 	          pyfwps_record->record,
 	          (uint8_t *) utf8_string,
 	          utf8_string_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -764,15 +957,11 @@ PyObject *pyfwps_record_get_value_type(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_value_type(
 	          pyfwps_record->record,
 	          &value_32bit,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -817,15 +1006,11 @@ PyObject *pyfwps_record_get_data(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_data_size(
 	          pyfwps_record->record,
 	          &data_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result == -1 )
 	{
 		pyfwps_error_raise(
@@ -916,20 +1101,23 @@ on_error:
 	return( NULL );
 }
 
-/* Retrieves the data as a boolean value
- * Returns a Python object if successful or NULL on error
+#if PY_MAJOR_VERSION >= 3
+
+/* Exports the data as a read-only buffer
+ * The buffer is only available if the data is available in memory
+ * Returns 0 if successful or -1 on error
  */
-PyObject *pyfwps_record_get_data_as_boolean(
-           pyfwps_record_t *pyfwps_record,
-           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+int pyfwps_record_get_buffer(
+     pyfwps_record_t *pyfwps_record,
+     Py_buffer *buffer,
+     int flags )
 {
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyfwps_record_get_data_as_boolean";
-	uint8_t value_boolean    = 0;
+	const uint8_t *data      = NULL;
+	static char *function    = "pyfwps_record_get_buffer";
+	size_t data_size         = 0;
 	int result               = 0;
 
-	PYFWPS_UNREFERENCED_PARAMETER( arguments )
-
 	if( pyfwps_record == NULL )
 	{
 		PyErr_Format(
@@ -937,58 +1125,140 @@ PyObject *pyfwps_record_get_data_as_boolean(
 		 "%s: invalid record.",
 		 function );
 
-		return( NULL );
+		return( -1 );
 	}
-	Py_BEGIN_ALLOW_THREADS
+	if( buffer == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid buffer.",
+		 function );
 
-	result = libfwps_record_get_data_as_boolean(
+		return( -1 );
+	}
+	result = libfwps_record_get_data_pointer(
 	          pyfwps_record->record,
-	          &value_boolean,
+	          &data,
+	          &data_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result == -1 )
 	{
 		pyfwps_error_raise(
 		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve boolean value.",
+		 PyExc_BufferError,
+		 "%s: unable to retrieve data.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		return( NULL );
+		return( -1 );
 	}
-	if( value_boolean != 0x00 )
+	else if( result == 0 )
 	{
-		Py_IncRef(
-		 Py_True );
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: data not available in memory.",
+		 function );
 
-		return( Py_True );
+		return( -1 );
 	}
-	Py_IncRef(
-	 Py_False );
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-	return( Py_False );
+		return( -1 );
+	}
+	/* The buffer holds a reference to the record object
+	 */
+	if( PyBuffer_FillInfo(
+	     buffer,
+	     (PyObject *) pyfwps_record,
+	     (void *) data,
+	     (Py_ssize_t) data_size,
+	     1,
+	     flags ) != 0 )
+	{
+		return( -1 );
+	}
+	/* The parent set and store refuse to be copied from a byte stream
+	 * while the buffer is exported, since this would free the data
+	 */
+	pyfwps_record_update_number_of_exported_buffers(
+	 pyfwps_record,
+	 1 );
+
+	return( 0 );
 }
 
-/* Retrieves the data as an integer value
+/* Releases an exported buffer
+ */
+void pyfwps_record_release_buffer(
+      pyfwps_record_t *pyfwps_record,
+      Py_buffer *buffer PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PYFWPS_UNREFERENCED_PARAMETER( buffer )
+
+	if( pyfwps_record == NULL )
+	{
+		return;
+	}
+	pyfwps_record_update_number_of_exported_buffers(
+	 pyfwps_record,
+	 -1 );
+}
+
+/* Updates the number of exported buffers of the parent set and store
+ */
+void pyfwps_record_update_number_of_exported_buffers(
+      pyfwps_record_t *pyfwps_record,
+      int difference )
+{
+	pyfwps_set_t *pyfwps_set     = NULL;
+	pyfwps_store_t *pyfwps_store = NULL;
+
+	if( pyfwps_record == NULL )
+	{
+		return;
+	}
+	if( ( pyfwps_record->parent_object == NULL )
+	 || ( Py_TYPE( pyfwps_record->parent_object ) != &pyfwps_set_type_object ) )
+	{
+		return;
+	}
+	pyfwps_set = (pyfwps_set_t *) pyfwps_record->parent_object;
+
+	pyfwps_set->number_of_exported_buffers += difference;
+
+	if( ( pyfwps_set->parent_object == NULL )
+	 || ( Py_TYPE( pyfwps_set->parent_object ) != &pyfwps_store_type_object ) )
+	{
+		return;
+	}
+	pyfwps_store = (pyfwps_store_t *) pyfwps_set->parent_object;
+
+	pyfwps_store->number_of_exported_buffers += difference;
+}
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+/* Retrieves a read-only view of the data
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyfwps_record_get_data_as_integer(
+PyObject *pyfwps_record_get_data_view(
            pyfwps_record_t *pyfwps_record,
            PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
 {
-	PyObject *integer_object = NULL;
+	PyObject *bytes_object   = NULL;
+	PyObject *view_object    = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyfwps_record_get_data_as_integer";
-	uint64_t value_64bit     = 0;
-	uint32_t value_32bit     = 0;
-	uint32_t value_type      = 0;
-	uint16_t value_16bit     = 0;
-	uint8_t value_8bit       = 0;
+	const uint8_t *data      = NULL;
+	static char *function    = "pyfwps_record_get_data_view";
+	size_t data_size         = 0;
 	int result               = 0;
 
 	PYFWPS_UNREFERENCED_PARAMETER( arguments )
@@ -1002,21 +1272,18 @@ PyObject *pyfwps_record_get_data_as_integer(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libfwps_record_get_value_type(
+	result = libfwps_record_get_data_pointer(
 	          pyfwps_record->record,
-	          &value_type,
+	          &data,
+	          &data_size,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
+	if( result == -1 )
 	{
 		pyfwps_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve value type.",
+		 "%s: unable to retrieve data.",
 		 function );
 
 		libcerror_error_free(
@@ -1024,51 +1291,383 @@ PyObject *pyfwps_record_get_data_as_integer(
 
 		return( NULL );
 	}
-	switch( value_type )
+#if PY_MAJOR_VERSION >= 3
+	if( ( result != 0 )
+	 && ( data_size > 0 ) )
 	{
-		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
-			Py_BEGIN_ALLOW_THREADS
+		view_object = PyMemoryView_FromObject(
+		               (PyObject *) pyfwps_record );
 
-			result = libfwps_record_get_data_as_8bit_integer(
-			          pyfwps_record->record,
-			          &value_8bit,
-			          &error );
+		return( view_object );
+	}
+#endif
+	/* Fall back to a view of a copy of the data if the data
+	 * is not available in memory
+	 */
+	bytes_object = pyfwps_record_get_data(
+	                pyfwps_record,
+	                NULL );
 
-			Py_END_ALLOW_THREADS
+	if( ( bytes_object == NULL )
+	 || ( bytes_object == Py_None ) )
+	{
+		return( bytes_object );
+	}
+	view_object = PyMemoryView_FromObject(
+	               bytes_object );
 
-#if PY_MAJOR_VERSION >= 3
-			integer_object = PyLong_FromLong(
-			                  (long) ( (int8_t) value_8bit ) );
-#else
-			integer_object = PyInt_FromLong(
-			                  (long) ( (int8_t) value_8bit ) );
-#endif
+	Py_DecRef(
+	 bytes_object );
+
+	return( view_object );
+}
+
+/* Retrieves the array type code of a value type
+ * Returns 1 if successful or 0 if the value type is not supported
+ */
+int pyfwps_record_get_array_type_code(
+     uint32_t value_type,
+     const char **type_code )
+{
+	if( type_code == NULL )
+	{
+		return( 0 );
+	}
+	/* Both scalar and vector values are supported
+	 */
+	switch( value_type & 0xffffefffUL )
+	{
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
+			*type_code = "b";
 			break;
 
+		case LIBFWPS_VALUE_TYPE_BOOLEAN:
 		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
-			Py_BEGIN_ALLOW_THREADS
+			*type_code = "B";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+			*type_code = "h";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			*type_code = "H";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
+			*type_code = "i";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_ERROR:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
+			*type_code = "I";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_CURRENCY:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+			*type_code = "q";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FILETIME:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+			*type_code = "Q";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
+			*type_code = "f";
+			break;
+
+		case LIBFWPS_VALUE_TYPE_APPLICATION_TIME:
+		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
+			*type_code = "d";
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a fixed-size value or vector of values as an array
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_array(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *array_object   = NULL;
+	PyObject *module_object  = NULL;
+	PyObject *result_object  = NULL;
+	PyObject *view_object    = NULL;
+	libcerror_error_t *error = NULL;
+	const char *type_code    = NULL;
+	static char *function    = "pyfwps_record_get_data_as_array";
+	uint32_t value_type      = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_value_type(
+	          pyfwps_record->record,
+	          &value_type,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( pyfwps_record_get_array_type_code(
+	     value_type,
+	     &type_code ) != 1 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 value_type );
+
+		goto on_error;
+	}
+	module_object = PyImport_ImportModule(
+	                 "array" );
+
+	if( module_object == NULL )
+	{
+		goto on_error;
+	}
+	array_object = PyObject_CallMethod(
+	                module_object,
+	                "array",
+	                "s",
+	                type_code );
+
+	Py_DecRef(
+	 module_object );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	view_object = pyfwps_record_get_data_view(
+	               pyfwps_record,
+	               NULL );
+
+	if( view_object == NULL )
+	{
+		goto on_error;
+	}
+	if( view_object != Py_None )
+	{
+		/* The array stores a copy of the data
+		 */
+#if PY_MAJOR_VERSION >= 3
+		result_object = PyObject_CallMethod(
+		                 array_object,
+		                 "frombytes",
+		                 "O",
+		                 view_object );
+#else
+		result_object = PyObject_CallMethod(
+		                 array_object,
+		                 "fromstring",
+		                 "O",
+		                 view_object );
+#endif
+		if( result_object == NULL )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 result_object );
+
+#if PY_BIG_ENDIAN
+		/* The values are stored in little-endian
+		 */
+		result_object = PyObject_CallMethod(
+		                 array_object,
+		                 "byteswap",
+		                 NULL );
+
+		if( result_object == NULL )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 result_object );
+#endif
+	}
+	Py_DecRef(
+	 view_object );
+
+	return( array_object );
+
+on_error:
+	if( view_object != NULL )
+	{
+		Py_DecRef(
+		 view_object );
+	}
+	if( array_object != NULL )
+	{
+		Py_DecRef(
+		 array_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the data as a boolean value
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_boolean(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_get_data_as_boolean";
+	uint8_t value_boolean    = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_data_as_boolean(
+	          pyfwps_record->record,
+	          &value_boolean,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve boolean value.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( value_boolean != 0x00 )
+	{
+		Py_IncRef(
+		 Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 Py_False );
+
+	return( Py_False );
+}
+
+/* Retrieves the data as an integer value
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_integer(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_get_data_as_integer";
+	uint64_t value_64bit     = 0;
+	uint32_t value_32bit     = 0;
+	uint32_t value_type      = 0;
+	uint16_t value_16bit     = 0;
+	uint8_t value_8bit       = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_value_type(
+	          pyfwps_record->record,
+	          &value_type,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
 
+		return( NULL );
+	}
+	switch( value_type )
+	{
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
 			result = libfwps_record_get_data_as_8bit_integer(
 			          pyfwps_record->record,
 			          &value_8bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
+#if PY_MAJOR_VERSION >= 3
+			integer_object = PyLong_FromLong(
+			                  (long) ( (int8_t) value_8bit ) );
+#else
+			integer_object = PyInt_FromLong(
+			                  (long) ( (int8_t) value_8bit ) );
+#endif
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libfwps_record_get_data_as_8bit_integer(
+			          pyfwps_record->record,
+			          &value_8bit,
+			          &error );
 
 			integer_object = PyLong_FromUnsignedLong(
 			                  (unsigned long) value_8bit );
 			break;
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_16bit_integer(
 			          pyfwps_record->record,
 			          &value_16bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 #if PY_MAJOR_VERSION >= 3
 			integer_object = PyLong_FromLong(
 			                  (long) ( (int16_t) value_16bit ) );
@@ -1079,29 +1678,21 @@ PyObject *pyfwps_record_get_data_as_integer(
 			break;
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_16bit_integer(
 			          pyfwps_record->record,
 			          &value_16bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 			integer_object = PyLong_FromUnsignedLong(
 			                  (unsigned long) value_16bit );
 			break;
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_32bit_integer(
 			          pyfwps_record->record,
 			          &value_32bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 #if PY_MAJOR_VERSION >= 3
 			integer_object = PyLong_FromLong(
 			                  (long) ( (int32_t) value_32bit ) );
@@ -1112,29 +1703,21 @@ PyObject *pyfwps_record_get_data_as_integer(
 			break;
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_32bit_integer(
 			          pyfwps_record->record,
 			          &value_32bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 			integer_object = PyLong_FromUnsignedLong(
 			                  (unsigned long) value_32bit );
 			break;
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_64bit_integer(
 			          pyfwps_record->record,
 			          &value_64bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 			integer_object = pyfwps_integer_signed_new_from_64bit(
 			                  (int64_t) value_64bit );
 
@@ -1142,15 +1725,11 @@ PyObject *pyfwps_record_get_data_as_integer(
 
 		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
 		case LIBFWPS_VALUE_TYPE_FILETIME:
-			Py_BEGIN_ALLOW_THREADS
-
 			result = libfwps_record_get_data_as_64bit_integer(
 			          pyfwps_record->record,
 			          &value_64bit,
 			          &error );
 
-			Py_END_ALLOW_THREADS
-
 			integer_object = pyfwps_integer_unsigned_new_from_64bit(
 			                  value_64bit );
 			break;
@@ -1203,15 +1782,11 @@ PyObject *pyfwps_record_get_data_as_floating_point(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_data_as_floating_point(
 	          pyfwps_record->record,
 	          &floating_point_value,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -1505,16 +2080,12 @@ PyObject *pyfwps_record_get_data_as_guid(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_record_get_data_as_guid(
 	          pyfwps_record->record,
 	          guid_data,
 	          16,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -1544,3 +2115,1055 @@ PyObject *pyfwps_record_get_data_as_guid(
 	return( string_object );
 }
 
+/* Retrieves the data as a datetime object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_datetime(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_get_data_as_datetime";
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_data_as_filetime(
+	          pyfwps_record->record,
+	          &filetime,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data as a FILETIME value.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyfwps_datetime_new_from_filetime(
+	         filetime ) );
+}
+
+/* Retrieves the data as an UUID object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_uuid(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_get_data_as_uuid";
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_data_as_guid(
+	          pyfwps_record->record,
+	          guid_data,
+	          16,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data as a GUID value.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyfwps_uuid_new_from_guid(
+	         NULL,
+	         guid_data,
+	         16 ) );
+}
+
+/* Retrieves the data of a FILETIME or GUID value or vector of values as a list
+ * The base value type must be either LIBFWPS_VALUE_TYPE_FILETIME or LIBFWPS_VALUE_TYPE_GUID
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_list_new_from_data(
+           pyfwps_record_t *pyfwps_record,
+           uint32_t base_value_type )
+{
+	PyObject *list_object    = NULL;
+	PyObject *uuid_type      = NULL;
+	PyObject *value_object   = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	static char *function    = "pyfwps_record_list_new_from_data";
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	size_t value_size        = 0;
+	uint64_t filetime        = 0;
+	uint32_t value_type      = 0;
+	Py_ssize_t value_index   = 0;
+	int result               = 0;
+
+	if( pyfwps_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	if( base_value_type == LIBFWPS_VALUE_TYPE_FILETIME )
+	{
+		value_size = 8;
+	}
+	else if( base_value_type == LIBFWPS_VALUE_TYPE_GUID )
+	{
+		value_size = 16;
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported base value type.",
+		 function );
+
+		return( NULL );
+	}
+	result = libfwps_record_get_value_type(
+	          pyfwps_record->record,
+	          &value_type,
+	          &error );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Both scalar and vector values are supported
+	 */
+	if( ( value_type & 0xffffefffUL ) != base_value_type )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 value_type );
+
+		goto on_error;
+	}
+	result = libfwps_record_get_data_size(
+	          pyfwps_record->record,
+	          &data_size,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( ( data_size % value_size ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unsupported data size: %" PRIzd ".",
+		 function,
+		 (ssize_t) data_size );
+
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		data = (uint8_t *) PyMem_Malloc(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfwps_record_get_data(
+		          pyfwps_record->record,
+		          data,
+		          data_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve data.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) ( data_size / value_size ) );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( base_value_type == LIBFWPS_VALUE_TYPE_GUID )
+	 && ( data_size > 0 ) )
+	{
+		/* Look up the UUID type once instead of for every value
+		 */
+		value_object = PyImport_ImportModule(
+		                "uuid" );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		uuid_type = PyObject_GetAttrString(
+		             value_object,
+		             "UUID" );
+
+		Py_DecRef(
+		 value_object );
+
+		value_object = NULL;
+
+		if( uuid_type == NULL )
+		{
+			goto on_error;
+		}
+	}
+	while( data_offset < data_size )
+	{
+		if( base_value_type == LIBFWPS_VALUE_TYPE_FILETIME )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 filetime );
+
+			value_object = pyfwps_datetime_new_from_filetime(
+			                filetime );
+		}
+		else
+		{
+			value_object = pyfwps_uuid_new_from_guid(
+			                uuid_type,
+			                &( data[ data_offset ] ),
+			                16 );
+		}
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference
+		 */
+		if( PyList_SetItem(
+		     list_object,
+		     value_index,
+		     value_object ) != 0 )
+		{
+			goto on_error;
+		}
+		data_offset += value_size;
+
+		value_index++;
+	}
+	if( uuid_type != NULL )
+	{
+		Py_DecRef(
+		 uuid_type );
+	}
+	if( data != NULL )
+	{
+		PyMem_Free(
+		 data );
+	}
+	return( list_object );
+
+on_error:
+	if( uuid_type != NULL )
+	{
+		Py_DecRef(
+		 uuid_type );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( data != NULL )
+	{
+		PyMem_Free(
+		 data );
+	}
+	return( NULL );
+}
+
+/* Retrieves the data of a FILETIME value or vector of values as a list of datetime objects
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_datetimes(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyfwps_record_list_new_from_data(
+	         pyfwps_record,
+	         LIBFWPS_VALUE_TYPE_FILETIME ) );
+}
+
+/* Retrieves the data of a GUID value or vector of values as a list of UUID objects
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_get_data_as_uuids(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyfwps_record_list_new_from_data(
+	         pyfwps_record,
+	         LIBFWPS_VALUE_TYPE_GUID ) );
+}
+
+/* Creates a new string object from the UTF-8 entry name or data of a record
+ * Returns a Python object if successful, Py_None if not available or NULL on error
+ */
+PyObject *pyfwps_record_string_new_from_record(
+           libfwps_record_t *record,
+           int string_type )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_string_new_from_record";
+	char *utf8_string        = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	if( string_type == PYFWPS_RECORD_STRING_TYPE_ENTRY_NAME )
+	{
+		result = libfwps_record_get_utf8_entry_name_size(
+		          record,
+		          &utf8_string_size,
+		          &error );
+	}
+	else
+	{
+		result = libfwps_record_get_data_as_utf8_string_size(
+		          record,
+		          &utf8_string_size,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf8_string = (char *) PyMem_Malloc(
+	                        sizeof( char ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_type == PYFWPS_RECORD_STRING_TYPE_ENTRY_NAME )
+	{
+		result = libfwps_record_get_utf8_entry_name(
+		          record,
+		          (uint8_t *) utf8_string,
+		          utf8_string_size,
+		          &error );
+	}
+	else
+	{
+		result = libfwps_record_get_data_as_utf8_string(
+		          record,
+		          (uint8_t *) utf8_string,
+		          utf8_string_size,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 NULL );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
+/* Creates a new value object from the data of a record
+ * Integer types, including FILETIME, are converted into an integer object,
+ * string types into a Unicode object, a GUID into its 16 bytes in little-endian
+ * and other types into a bytes object of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_value_new_from_record(
+           libfwps_record_t *record )
+{
+	PyObject *value_object      = NULL;
+	libcerror_error_t *error    = NULL;
+	uint8_t *data               = NULL;
+	static char *function       = "pyfwps_record_value_new_from_record";
+	double floating_point_value = 0.0;
+	size_t data_size            = 0;
+	uint64_t value_64bit        = 0;
+	uint32_t value_32bit        = 0;
+	uint32_t value_type         = 0;
+	uint16_t value_16bit        = 0;
+	uint8_t value_8bit          = 0;
+	int result                  = 0;
+
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_type,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	switch( value_type )
+	{
+		case LIBFWPS_VALUE_TYPE_EMPTY:
+		case LIBFWPS_VALUE_TYPE_NULL:
+			Py_IncRef(
+			 Py_None );
+
+			return( Py_None );
+
+		case LIBFWPS_VALUE_TYPE_BOOLEAN:
+			result = libfwps_record_get_data_as_boolean(
+			          record,
+			          &value_8bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyBool_FromLong(
+				                (long) ( value_8bit != 0 ) );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_8BIT_UNSIGNED:
+			result = libfwps_record_get_data_as_8bit_integer(
+			          record,
+			          &value_8bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( value_type == LIBFWPS_VALUE_TYPE_INTEGER_8BIT_SIGNED )
+				{
+					value_object = PyLong_FromLong(
+					                (long) ( (int8_t) value_8bit ) );
+				}
+				else
+				{
+					value_object = PyLong_FromUnsignedLong(
+					                (unsigned long) value_8bit );
+				}
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_16BIT_UNSIGNED:
+			result = libfwps_record_get_data_as_16bit_integer(
+			          record,
+			          &value_16bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( value_type == LIBFWPS_VALUE_TYPE_INTEGER_16BIT_SIGNED )
+				{
+					value_object = PyLong_FromLong(
+					                (long) ( (int16_t) value_16bit ) );
+				}
+				else
+				{
+					value_object = PyLong_FromUnsignedLong(
+					                (unsigned long) value_16bit );
+				}
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_ERROR:
+			result = libfwps_record_get_data_as_32bit_integer(
+			          record,
+			          &value_32bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( ( value_type == LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED )
+				 || ( value_type == LIBFWPS_VALUE_TYPE_INTEGER_SIGNED ) )
+				{
+					value_object = PyLong_FromLong(
+					                (long) ( (int32_t) value_32bit ) );
+				}
+				else
+				{
+					value_object = PyLong_FromUnsignedLong(
+					                (unsigned long) value_32bit );
+				}
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED:
+		case LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED:
+		case LIBFWPS_VALUE_TYPE_FILETIME:
+			result = libfwps_record_get_data_as_64bit_integer(
+			          record,
+			          &value_64bit,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( value_type == LIBFWPS_VALUE_TYPE_INTEGER_64BIT_SIGNED )
+				{
+					value_object = pyfwps_integer_signed_new_from_64bit(
+					                (int64_t) value_64bit );
+				}
+				else
+				{
+					value_object = pyfwps_integer_unsigned_new_from_64bit(
+					                value_64bit );
+				}
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_FLOAT_32BIT:
+		case LIBFWPS_VALUE_TYPE_DOUBLE_64BIT:
+			result = libfwps_record_get_data_as_floating_point(
+			          record,
+			          &floating_point_value,
+			          &error );
+
+			if( result == 1 )
+			{
+				value_object = PyFloat_FromDouble(
+				                floating_point_value );
+			}
+			break;
+
+		case LIBFWPS_VALUE_TYPE_BINARY_STRING:
+		case LIBFWPS_VALUE_TYPE_STRING_ASCII:
+		case LIBFWPS_VALUE_TYPE_STRING_UNICODE:
+			return( pyfwps_record_string_new_from_record(
+			         record,
+			         PYFWPS_RECORD_STRING_TYPE_DATA ) );
+
+		default:
+			result = libfwps_record_get_data_size(
+			          record,
+			          &data_size,
+			          &error );
+
+			if( result == 1 )
+			{
+				if( ( value_type == LIBFWPS_VALUE_TYPE_GUID )
+				 && ( data_size != 16 ) )
+				{
+					PyErr_Format(
+					 PyExc_IOError,
+					 "%s: unsupported GUID data size.",
+					 function );
+
+					return( NULL );
+				}
+				if( data_size == 0 )
+				{
+					Py_IncRef(
+					 Py_None );
+
+					return( Py_None );
+				}
+				/* Copy the data directly into the bytes object
+				 * to prevent an intermediate allocation
+				 */
+#if PY_MAJOR_VERSION >= 3
+				value_object = PyBytes_FromStringAndSize(
+				                NULL,
+				                (Py_ssize_t) data_size );
+#else
+				value_object = PyString_FromStringAndSize(
+				                NULL,
+				                (Py_ssize_t) data_size );
+#endif
+				if( value_object == NULL )
+				{
+					PyErr_Format(
+					 PyExc_MemoryError,
+					 "%s: unable to create bytes object.",
+					 function );
+
+					return( NULL );
+				}
+#if PY_MAJOR_VERSION >= 3
+				data = (uint8_t *) PyBytes_AsString(
+				                    value_object );
+#else
+				data = (uint8_t *) PyString_AsString(
+				                    value_object );
+#endif
+				result = libfwps_record_get_data(
+				          record,
+				          data,
+				          data_size,
+				          &error );
+
+				if( result != 1 )
+				{
+					Py_DecRef(
+					 value_object );
+
+					value_object = NULL;
+				}
+			}
+			break;
+	}
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value of type: 0x%08" PRIx32 ".",
+		 function,
+		 value_type );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( value_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create value object.",
+		 function );
+
+		return( NULL );
+	}
+	return( value_object );
+}
+
+/* Creates a new key object of a record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_key_new_from_record(
+           libfwps_record_t *record,
+           PyObject *set_identifier_object,
+           int key_type )
+{
+	PyObject *entry_name_object = NULL;
+	PyObject *key_object        = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfwps_record_key_new_from_record";
+	uint32_t entry_type         = 0;
+	int result                  = 0;
+
+	result = libfwps_record_get_entry_type(
+	          record,
+	          &entry_type,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve entry type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		if( key_type == PYFWPS_RECORD_KEY_TYPE_ENTRY )
+		{
+			key_object = PyLong_FromUnsignedLong(
+			              (unsigned long) entry_type );
+		}
+		else
+		{
+			key_object = PyUnicode_FromFormat(
+			              "{%U} %lu",
+			              set_identifier_object,
+			              (unsigned long) entry_type );
+		}
+		return( key_object );
+	}
+	entry_name_object = pyfwps_record_string_new_from_record(
+	                     record,
+	                     PYFWPS_RECORD_STRING_TYPE_ENTRY_NAME );
+
+	if( entry_name_object == NULL )
+	{
+		return( NULL );
+	}
+	if( key_type == PYFWPS_RECORD_KEY_TYPE_ENTRY )
+	{
+		return( entry_name_object );
+	}
+	key_object = PyUnicode_FromFormat(
+	              "{%U} %S",
+	              set_identifier_object,
+	              entry_name_object );
+
+	Py_DecRef(
+	 entry_name_object );
+
+	return( key_object );
+}
+
+/* Creates a new dictionary object of a record
+ * The dictionary contains the set identifier, entry type, entry name,
+ * value type and value
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_dict_new_from_record(
+           libfwps_record_t *record,
+           PyObject *set_identifier_object )
+{
+	PyObject *dict_object    = NULL;
+	PyObject *item_object    = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwps_record_dict_new_from_record";
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	dict_object = PyDict_New();
+
+	if( dict_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dict_object,
+	     "set_identifier",
+	     set_identifier_object ) != 0 )
+	{
+		goto on_error;
+	}
+	result = libfwps_record_get_entry_type(
+	          record,
+	          &value_32bit,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve entry type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		item_object = Py_None;
+	}
+	else
+	{
+		item_object = PyLong_FromUnsignedLong(
+		               (unsigned long) value_32bit );
+	}
+	if( item_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dict_object,
+	     "entry_type",
+	     item_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 item_object );
+
+	item_object = pyfwps_record_string_new_from_record(
+	               record,
+	               PYFWPS_RECORD_STRING_TYPE_ENTRY_NAME );
+
+	if( item_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dict_object,
+	     "entry_name",
+	     item_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 item_object );
+
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_32bit,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		item_object = NULL;
+
+		goto on_error;
+	}
+	item_object = PyLong_FromUnsignedLong(
+	               (unsigned long) value_32bit );
+
+	if( item_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dict_object,
+	     "value_type",
+	     item_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 item_object );
+
+	item_object = pyfwps_record_value_new_from_record(
+	               record );
+
+	if( item_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dict_object,
+	     "value",
+	     item_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 item_object );
+
+	return( dict_object );
+
+on_error:
+	if( item_object != NULL )
+	{
+		Py_DecRef(
+		 item_object );
+	}
+	if( dict_object != NULL )
+	{
+		Py_DecRef(
+		 dict_object );
+	}
+	return( NULL );
+}
+
+/* Determines the key type from a string
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_record_get_key_type_from_string(
+     const char *string,
+     int *key_type )
+{
+	static char *function = "pyfwps_record_get_key_type_from_string";
+	size_t string_length  = 0;
+
+	if( key_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid key type.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		*key_type = PYFWPS_RECORD_KEY_TYPE_PKEY;
+
+		return( 1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( ( string_length == 4 )
+	 && ( narrow_string_compare(
+	       string,
+	       "pkey",
+	       4 ) == 0 ) )
+	{
+		*key_type = PYFWPS_RECORD_KEY_TYPE_PKEY;
+	}
+	else if( ( string_length == 5 )
+	      && ( narrow_string_compare(
+	            string,
+	            "entry",
+	            5 ) == 0 ) )
+	{
+		*key_type = PYFWPS_RECORD_KEY_TYPE_ENTRY;
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported key: %s.",
+		 function,
+		 string );
+
+		return( -1 );
+	}
+	return( 1 );
+}
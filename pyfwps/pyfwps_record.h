@@ -32,6 +32,18 @@
 extern "C" {
 #endif
 
+enum PYFWPS_RECORD_KEY_TYPES
+{
+	PYFWPS_RECORD_KEY_TYPE_PKEY		= 1,
+	PYFWPS_RECORD_KEY_TYPE_ENTRY		= 2
+};
+
+enum PYFWPS_RECORD_STRING_TYPES
+{
+	PYFWPS_RECORD_STRING_TYPE_ENTRY_NAME	= 1,
+	PYFWPS_RECORD_STRING_TYPE_DATA		= 2
+};
+
 typedef struct pyfwps_record pyfwps_record_t;
 
 struct pyfwps_record
@@ -50,6 +62,9 @@ struct pyfwps_record
 };
 
 extern PyMethodDef pyfwps_record_object_methods[];
+#if PY_MAJOR_VERSION >= 3
+extern PyBufferProcs pyfwps_record_buffer_procs;
+#endif
 extern PyTypeObject pyfwps_record_type_object;
 
 PyObject *pyfwps_record_new(
@@ -62,6 +77,15 @@ int pyfwps_record_init(
 void pyfwps_record_free(
       pyfwps_record_t *pyfwps_record );
 
+int pyfwps_record_traverse(
+     pyfwps_record_t *pyfwps_record,
+     visitproc visit,
+     void *arg );
+
+PyObject *pyfwps_record_reduce(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
 PyObject *pyfwps_record_get_entry_name(
            pyfwps_record_t *pyfwps_record,
            PyObject *arguments );
@@ -82,6 +106,33 @@ PyObject *pyfwps_record_get_data(
            pyfwps_record_t *pyfwps_record,
            PyObject *arguments );
 
+#if PY_MAJOR_VERSION >= 3
+int pyfwps_record_get_buffer(
+     pyfwps_record_t *pyfwps_record,
+     Py_buffer *buffer,
+     int flags );
+
+void pyfwps_record_release_buffer(
+      pyfwps_record_t *pyfwps_record,
+      Py_buffer *buffer );
+
+void pyfwps_record_update_number_of_exported_buffers(
+      pyfwps_record_t *pyfwps_record,
+      int difference );
+#endif
+
+PyObject *pyfwps_record_get_data_view(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
+int pyfwps_record_get_array_type_code(
+     uint32_t value_type,
+     const char **type_code );
+
+PyObject *pyfwps_record_get_data_as_array(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
 PyObject *pyfwps_record_get_data_as_boolean(
            pyfwps_record_t *pyfwps_record,
            PyObject *arguments );
@@ -106,6 +157,46 @@ PyObject *pyfwps_record_get_data_as_guid(
            pyfwps_record_t *pyfwps_record,
            PyObject *arguments );
 
+PyObject *pyfwps_record_get_data_as_datetime(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
+PyObject *pyfwps_record_get_data_as_uuid(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
+PyObject *pyfwps_record_list_new_from_data(
+           pyfwps_record_t *pyfwps_record,
+           uint32_t base_value_type );
+
+PyObject *pyfwps_record_get_data_as_datetimes(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
+PyObject *pyfwps_record_get_data_as_uuids(
+           pyfwps_record_t *pyfwps_record,
+           PyObject *arguments );
+
+PyObject *pyfwps_record_string_new_from_record(
+           libfwps_record_t *record,
+           int string_type );
+
+PyObject *pyfwps_record_value_new_from_record(
+           libfwps_record_t *record );
+
+PyObject *pyfwps_record_key_new_from_record(
+           libfwps_record_t *record,
+           PyObject *set_identifier_object,
+           int key_type );
+
+PyObject *pyfwps_record_dict_new_from_record(
+           libfwps_record_t *record,
+           PyObject *set_identifier_object );
+
+int pyfwps_record_get_key_type_from_string(
+     const char *string,
+     int *key_type );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,623 @@
+/*
+ * Python object definition of the iterator object of scanned records
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfwps_error.h"
+#include "pyfwps_guid.h"
+#include "pyfwps_libcerror.h"
+#include "pyfwps_libfwps.h"
+#include "pyfwps_python.h"
+#include "pyfwps_record.h"
+#include "pyfwps_record_scanner.h"
+
+PyTypeObject pyfwps_record_scanner_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfwps.record_scanner",
+	/* tp_basicsize */
+	sizeof( pyfwps_record_scanner_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfwps_record_scanner_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyfwps iterator object of scanned records",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfwps_record_scanner_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfwps_record_scanner_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfwps_record_scanner_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new record scanner object
+ * The buffer of the bytes object is retained until the scanner object is freed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_record_scanner_new(
+           PyObject *bytes_object,
+           int ascii_codepage )
+{
+	pyfwps_record_scanner_t *scanner_object = NULL;
+	static char *function                   = "pyfwps_record_scanner_new";
+
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid bytes object.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the record scanner values are initialized
+	 */
+	scanner_object = PyObject_New(
+	                  struct pyfwps_record_scanner,
+	                  &pyfwps_record_scanner_type_object );
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create scanner object.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_object->has_buffer            = 0;
+	scanner_object->ascii_codepage        = ascii_codepage;
+	scanner_object->byte_stream_offset    = 0;
+	scanner_object->is_finished           = 0;
+	scanner_object->set_identifier_object = NULL;
+	scanner_object->records_list          = NULL;
+	scanner_object->current_index         = 0;
+
+	if( PyObject_GetBuffer(
+	     bytes_object,
+	     &( scanner_object->buffer ),
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		pyfwps_error_fetch_and_raise(
+		 PyExc_TypeError,
+		 "%s: unsupported byte stream object type.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_object->has_buffer = 1;
+
+	if( ( scanner_object->buffer.len < 0 )
+	 || ( scanner_object->buffer.len > (Py_ssize_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	return( (PyObject *) scanner_object );
+
+on_error:
+	if( scanner_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) scanner_object );
+	}
+	return( NULL );
+}
+
+/* Initializes a record scanner object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfwps_record_scanner_init(
+     pyfwps_record_scanner_t *scanner_object )
+{
+	static char *function = "pyfwps_record_scanner_init";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the record scanner values are initialized
+	 */
+	scanner_object->has_buffer            = 0;
+	scanner_object->ascii_codepage        = 0;
+	scanner_object->byte_stream_offset    = 0;
+	scanner_object->is_finished           = 1;
+	scanner_object->set_identifier_object = NULL;
+	scanner_object->records_list          = NULL;
+	scanner_object->current_index         = 0;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of record scanner not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a record scanner object
+ */
+void pyfwps_record_scanner_free(
+      pyfwps_record_scanner_t *scanner_object )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfwps_record_scanner_free";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           scanner_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( scanner_object->records_list != NULL )
+	{
+		Py_DecRef(
+		 scanner_object->records_list );
+	}
+	if( scanner_object->set_identifier_object != NULL )
+	{
+		Py_DecRef(
+		 scanner_object->set_identifier_object );
+	}
+	if( scanner_object->has_buffer != 0 )
+	{
+		PyBuffer_Release(
+		 &( scanner_object->buffer ) );
+	}
+	ob_type->tp_free(
+	 (PyObject*) scanner_object );
+}
+
+/* Record callback function of the set scan
+ * Appends a tuple of the set identifier, the entry type or name,
+ * the value type and the value of the record to the records list
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_record_scanner_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	PyObject *key_object                    = NULL;
+	PyObject *tuple_object                  = NULL;
+	PyObject *value_object                  = NULL;
+	pyfwps_record_scanner_t *scanner_object = NULL;
+	static char *function                   = "pyfwps_record_scanner_record_callback";
+	uint32_t value_type                     = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	scanner_object = (pyfwps_record_scanner_t *) callback_data;
+
+	/* All the records of a set share the same identifier object
+	 */
+	if( scanner_object->set_identifier_object == NULL )
+	{
+		scanner_object->set_identifier_object = pyfwps_string_new_from_guid(
+		                                         set_identifier,
+		                                         16 );
+
+		if( scanner_object->set_identifier_object == NULL )
+		{
+			return( -1 );
+		}
+	}
+	if( libfwps_record_get_value_type(
+	     record,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	key_object = pyfwps_record_key_new_from_record(
+	              record,
+	              scanner_object->set_identifier_object,
+	              PYFWPS_RECORD_KEY_TYPE_ENTRY );
+
+	if( key_object == NULL )
+	{
+		goto on_error;
+	}
+	value_object = pyfwps_record_value_new_from_record(
+	                record );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = Py_BuildValue(
+	                "(OOkO)",
+	                scanner_object->set_identifier_object,
+	                key_object,
+	                (unsigned long) value_type,
+	                value_object );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = NULL;
+
+	Py_DecRef(
+	 key_object );
+
+	key_object = NULL;
+
+	if( PyList_Append(
+	     scanner_object->records_list,
+	     tuple_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 tuple_object );
+
+	return( 1 );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 value_object );
+	}
+	if( key_object != NULL )
+	{
+		Py_DecRef(
+		 key_object );
+	}
+	return( -1 );
+}
+
+/* Scans the next set in the byte stream into the list of record tuples
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_record_scanner_scan_next_set(
+     pyfwps_record_scanner_t *scanner_object )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *set_data  = NULL;
+	static char *function    = "pyfwps_record_scanner_scan_next_set";
+	size_t byte_stream_size  = 0;
+	uint32_t set_data_size   = 0;
+	int result               = 0;
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record tuples of the previous set are released before
+	 * the next set is scanned to keep the memory usage flat
+	 */
+	if( scanner_object->records_list != NULL )
+	{
+		Py_DecRef(
+		 scanner_object->records_list );
+
+		scanner_object->records_list = NULL;
+	}
+	if( scanner_object->set_identifier_object != NULL )
+	{
+		Py_DecRef(
+		 scanner_object->set_identifier_object );
+
+		scanner_object->set_identifier_object = NULL;
+	}
+	scanner_object->current_index = 0;
+
+	byte_stream_size = (size_t) scanner_object->buffer.len;
+
+	if( scanner_object->byte_stream_offset >= byte_stream_size )
+	{
+		scanner_object->is_finished = 1;
+
+		return( 1 );
+	}
+	if( scanner_object->byte_stream_offset > ( byte_stream_size - 4 ) )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	set_data = &( ( (uint8_t *) scanner_object->buffer.buf )[ scanner_object->byte_stream_offset ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 set_data,
+	 set_data_size );
+
+	if( set_data_size == 0 )
+	{
+		scanner_object->is_finished = 1;
+
+		return( 1 );
+	}
+	if( (size_t) set_data_size > ( byte_stream_size - scanner_object->byte_stream_offset ) )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid set data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	scanner_object->records_list = PyList_New(
+	                                0 );
+
+	if( scanner_object->records_list == NULL )
+	{
+		goto on_error;
+	}
+	result = libfwps_set_scan_byte_stream(
+	          set_data,
+	          (size_t) set_data_size,
+	          scanner_object->ascii_codepage,
+	          &pyfwps_record_scanner_record_callback,
+	          (void *) scanner_object,
+	          &error );
+
+	if( result == -1 )
+	{
+		/* The callback function raised a Python exception
+		 */
+		if( PyErr_Occurred() )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to scan set at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) scanner_object->byte_stream_offset );
+
+			libcerror_error_free(
+			 &error );
+		}
+		goto on_error;
+	}
+	scanner_object->byte_stream_offset += set_data_size;
+
+	return( 1 );
+
+on_error:
+	scanner_object->is_finished = 1;
+
+	return( -1 );
+}
+
+/* The record scanner iter() function
+ */
+PyObject *pyfwps_record_scanner_iter(
+           pyfwps_record_scanner_t *scanner_object )
+{
+	static char *function = "pyfwps_record_scanner_iter";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) scanner_object );
+
+	return( (PyObject *) scanner_object );
+}
+
+/* The record scanner iternext() function
+ */
+PyObject *pyfwps_record_scanner_iternext(
+           pyfwps_record_scanner_t *scanner_object )
+{
+	PyObject *tuple_object = NULL;
+	static char *function  = "pyfwps_record_scanner_iternext";
+
+	if( scanner_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner object.",
+		 function );
+
+		return( NULL );
+	}
+	/* Sets without records are skipped
+	 */
+	while( ( scanner_object->records_list == NULL )
+	    || ( scanner_object->current_index >= PyList_GET_SIZE( scanner_object->records_list ) ) )
+	{
+		if( scanner_object->is_finished != 0 )
+		{
+			PyErr_SetNone(
+			 PyExc_StopIteration );
+
+			return( NULL );
+		}
+		if( pyfwps_record_scanner_scan_next_set(
+		     scanner_object ) != 1 )
+		{
+			return( NULL );
+		}
+	}
+	tuple_object = PyList_GET_ITEM(
+	                scanner_object->records_list,
+	                scanner_object->current_index );
+
+	scanner_object->current_index++;
+
+	Py_IncRef(
+	 tuple_object );
+
+	return( tuple_object );
+}
+
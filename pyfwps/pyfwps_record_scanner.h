@@ -0,0 +1,109 @@
+/*
+ * Python object definition of the iterator object of scanned records
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFWPS_RECORD_SCANNER_H )
+#define _PYFWPS_RECORD_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfwps_libcerror.h"
+#include "pyfwps_libfwps.h"
+#include "pyfwps_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfwps_record_scanner pyfwps_record_scanner_t;
+
+struct pyfwps_record_scanner
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The byte stream buffer
+	 */
+	Py_buffer buffer;
+
+	/* Value to indicate the buffer was retrieved
+	 */
+	int has_buffer;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The current offset in the byte stream
+	 */
+	size_t byte_stream_offset;
+
+	/* Value to indicate the scan has finished
+	 */
+	int is_finished;
+
+	/* The identifier object of the set that is being scanned
+	 */
+	PyObject *set_identifier_object;
+
+	/* The list of the record tuples of the last scanned set
+	 */
+	PyObject *records_list;
+
+	/* The current index in the list of record tuples
+	 */
+	Py_ssize_t current_index;
+};
+
+extern PyTypeObject pyfwps_record_scanner_type_object;
+
+PyObject *pyfwps_record_scanner_new(
+           PyObject *bytes_object,
+           int ascii_codepage );
+
+int pyfwps_record_scanner_init(
+     pyfwps_record_scanner_t *scanner_object );
+
+void pyfwps_record_scanner_free(
+      pyfwps_record_scanner_t *scanner_object );
+
+int pyfwps_record_scanner_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int pyfwps_record_scanner_scan_next_set(
+     pyfwps_record_scanner_t *scanner_object );
+
+PyObject *pyfwps_record_scanner_iter(
+           pyfwps_record_scanner_t *scanner_object );
+
+PyObject *pyfwps_record_scanner_iternext(
+           pyfwps_record_scanner_t *scanner_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFWPS_RECORD_SCANNER_H ) */
+
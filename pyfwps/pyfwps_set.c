@@ -20,12 +20,15 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "pyfwps_codepage.h"
 #include "pyfwps_error.h"
 #include "pyfwps_guid.h"
 #include "pyfwps_libcerror.h"
@@ -43,7 +46,9 @@ PyMethodDef pyfwps_set_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "copy_from_byte_stream(byte_stream)\n"
 	  "\n"
-	  "Copies the set from the byte stream." },
+	  "Copies the set from the byte stream.\n"
+	  "The byte stream can be any object that supports the buffer protocol,\n"
+	  "such as bytes, bytearray, memoryview or mmap." },
 
 	{ "get_identifier",
 	  (PyCFunction) pyfwps_set_get_identifier,
@@ -52,6 +57,21 @@ PyMethodDef pyfwps_set_object_methods[] = {
 	  "\n"
 	  "Retrieves the identifier." },
 
+	{ "__reduce__",
+	  (PyCFunction) pyfwps_set_reduce,
+	  METH_NOARGS,
+	  "__reduce__() -> Tuple\n"
+	  "\n"
+	  "Reduces the set for pickling.\n"
+	  "The pickled state consists of the serialized set and the ASCII codepage." },
+
+	{ "__setstate__",
+	  (PyCFunction) pyfwps_set_set_state,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "__setstate__(state)\n"
+	  "\n"
+	  "Restores the set from the pickled state." },
+
 	{ "get_number_of_records",
 	  (PyCFunction) pyfwps_set_get_number_of_records,
 	  METH_NOARGS,
@@ -66,6 +86,39 @@ PyMethodDef pyfwps_set_object_methods[] = {
 	  "\n"
 	  "Retrieves the record specified by the index." },
 
+	{ "get_record_by_entry_type",
+	  (PyCFunction) pyfwps_set_get_record_by_entry_type,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_by_entry_type(entry_type) -> Object or None\n"
+	  "\n"
+	  "Retrieves the record specified by the entry type.\n"
+	  "This method is only supported for sets of numeric records." },
+
+	{ "get_record_by_name",
+	  (PyCFunction) pyfwps_set_get_record_by_name,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_record_by_name(name) -> Object or None\n"
+	  "\n"
+	  "Retrieves the record specified by the entry name.\n"
+	  "This method is only supported for sets of named records." },
+
+	{ "to_list",
+	  (PyCFunction) pyfwps_set_to_list,
+	  METH_NOARGS,
+	  "to_list() -> List\n"
+	  "\n"
+	  "Converts the records into a list of dictionaries with the keys:\n"
+	  "set_identifier, entry_type, entry_name, value_type and value." },
+
+	{ "to_dict",
+	  (PyCFunction) pyfwps_set_to_dict,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_dict(key=\"pkey\") -> Dictionary\n"
+	  "\n"
+	  "Converts the records into a dictionary of dictionaries as returned by to_list.\n"
+	  "The key is either \"pkey\", which is formatted as \"{identifier} entry\",\n"
+	  "or \"entry\", which is the entry type or entry name." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -134,13 +187,13 @@ PyTypeObject pyfwps_set_type_object = {
 	/* tp_as_buffer */
 	0,
 	/* tp_flags */
-	Py_TPFLAGS_DEFAULT,
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
 	/* tp_doc */
 	"pyfwps set object (wraps libfwps_set_t)",
 	/* tp_traverse */
-	0,
+	(traverseproc) pyfwps_set_traverse,
 	/* tp_clear */
-	0,
+	(inquiry) pyfwps_set_clear,
 	/* tp_richcompare */
 	0,
 	/* tp_weaklistoffset */
@@ -210,7 +263,7 @@ PyObject *pyfwps_set_new(
 	}
 	/* PyObject_New does not invoke tp_init
 	 */
-	pyfwps_set = PyObject_New(
+	pyfwps_set = PyObject_GC_New(
 	              struct pyfwps_set,
 	              &pyfwps_set_type_object );
 
@@ -223,14 +276,21 @@ PyObject *pyfwps_set_new(
 
 		goto on_error;
 	}
-	pyfwps_set->set           = set;
-	pyfwps_set->parent_object = parent_object;
+	pyfwps_set->set                        = set;
+	pyfwps_set->parent_object              = parent_object;
+	pyfwps_set->record_objects             = NULL;
+	pyfwps_set->number_of_record_objects   = 0;
+	pyfwps_set->number_of_exported_buffers = 0;
+	pyfwps_set->ascii_codepage             = LIBFWPS_CODEPAGE_WINDOWS_1252;
 
 	if( pyfwps_set->parent_object != NULL )
 	{
 		Py_IncRef(
 		 pyfwps_set->parent_object );
 	}
+	PyObject_GC_Track(
+	 (PyObject *) pyfwps_set );
+
 	return( (PyObject *) pyfwps_set );
 
 on_error:
@@ -262,7 +322,11 @@ int pyfwps_set_init(
 	}
 	/* Make sure libfwps set is set to NULL
 	 */
-	pyfwps_set->set = NULL;
+	pyfwps_set->set                        = NULL;
+	pyfwps_set->record_objects             = NULL;
+	pyfwps_set->number_of_record_objects   = 0;
+	pyfwps_set->number_of_exported_buffers = 0;
+	pyfwps_set->ascii_codepage             = LIBFWPS_CODEPAGE_WINDOWS_1252;
 
 	if( libfwps_set_initialize(
 	     &( pyfwps_set->set ),
@@ -322,6 +386,12 @@ void pyfwps_set_free(
 
 		return;
 	}
+	PyObject_GC_UnTrack(
+	 (PyObject *) pyfwps_set );
+
+	pyfwps_set_clear(
+	 pyfwps_set );
+
 	if( pyfwps_set->set != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -353,6 +423,66 @@ void pyfwps_set_free(
 	 (PyObject*) pyfwps_set );
 }
 
+/* Traverses the parent and cached objects of a set object
+ * Returns 0 if successful or the result of the visit function otherwise
+ */
+int pyfwps_set_traverse(
+     pyfwps_set_t *pyfwps_set,
+     visitproc visit,
+     void *arg )
+{
+	int record_index = 0;
+
+	Py_VISIT(
+	 pyfwps_set->parent_object );
+
+	if( pyfwps_set->record_objects != NULL )
+	{
+		for( record_index = 0;
+		     record_index < pyfwps_set->number_of_record_objects;
+		     record_index++ )
+		{
+			Py_VISIT(
+			 pyfwps_set->record_objects[ record_index ] );
+		}
+	}
+	return( 0 );
+}
+
+/* Clears the cached objects of a set object
+ * Returns 0
+ */
+int pyfwps_set_clear(
+     pyfwps_set_t *pyfwps_set )
+{
+	PyObject **record_objects    = NULL;
+	int number_of_record_objects = 0;
+	int record_index             = 0;
+
+	/* Detach the cache before releasing the objects since releasing
+	 * an object can re-enter the set
+	 */
+	record_objects           = pyfwps_set->record_objects;
+	number_of_record_objects = pyfwps_set->number_of_record_objects;
+
+	pyfwps_set->record_objects           = NULL;
+	pyfwps_set->number_of_record_objects = 0;
+
+	if( record_objects != NULL )
+	{
+		for( record_index = 0;
+		     record_index < number_of_record_objects;
+		     record_index++ )
+		{
+			Py_CLEAR(
+			 record_objects[ record_index ] );
+		}
+		PyMem_Free(
+		 record_objects );
+	}
+	return( 0 );
+}
+
 /* Copies the set from a byte stream
  * Returns a Python object if successful or NULL on error
  */
@@ -361,12 +491,12 @@ PyObject *pyfwps_set_copy_from_byte_stream(
            PyObject *arguments,
            PyObject *keywords )
 {
+	Py_buffer buffer;
+
 	PyObject *bytes_object      = NULL;
 	libcerror_error_t *error    = NULL;
-	const char *byte_stream     = NULL;
 	static char *function       = "pyfwps_set_copy_from_byte_stream";
 	static char *keyword_list[] = { "byte_stream", NULL };
-	Py_ssize_t byte_stream_size = 0;
 	int result                  = 0;
 
 	if( pyfwps_set == NULL )
@@ -378,6 +508,17 @@ PyObject *pyfwps_set_copy_from_byte_stream(
 
 		return( NULL );
 	}
+	/* The exported record data buffers point into the data that is replaced
+	 */
+	if( pyfwps_set->number_of_exported_buffers > 0 )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: unable to copy set from byte stream while record data is exported.",
+		 function );
+
+		return( NULL );
+	}
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
@@ -389,65 +530,156 @@ PyObject *pyfwps_set_copy_from_byte_stream(
 	}
 	PyErr_Clear();
 
-#if PY_MAJOR_VERSION >= 3
-	result = PyObject_IsInstance(
-	          bytes_object,
-	          (PyObject *) &PyBytes_Type );
-#else
-	result = PyObject_IsInstance(
-	          bytes_object,
-	          (PyObject *) &PyString_Type );
-#endif
-	if( result == -1 )
+	/* The buffer remains pinned until it is released, which prevents
+	 * the exporter, such as a bytearray, from being resized during the parse
+	 */
+	if( PyObject_GetBuffer(
+	     bytes_object,
+	     &buffer,
+	     PyBUF_SIMPLE ) != 0 )
 	{
 		pyfwps_error_fetch_and_raise(
-		 PyExc_RuntimeError,
-		 "%s: unable to determine if object is of type bytes.",
+		 PyExc_TypeError,
+		 "%s: unsupported byte stream object type.",
 		 function );
 
 		return( NULL );
 	}
-	else if( result == 0 )
+	if( ( buffer.len < 0 )
+	 || ( buffer.len > (Py_ssize_t) SSIZE_MAX ) )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* The cached record objects refer to the records that are replaced
+	 */
+	pyfwps_set_clear(
+	 pyfwps_set );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwps_set_copy_from_byte_stream(
+	          pyfwps_set->set,
+	          (uint8_t *) buffer.buf,
+	          (size_t) buffer.len,
+	          pyfwps_set->ascii_codepage,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to copy set from byte stream.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Reduces the set for pickling
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_reduce(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *bytes_object   = NULL;
+	PyObject *reduce_object  = NULL;
+	libcerror_error_t *error = NULL;
+	char *byte_stream        = NULL;
+	static char *function    = "pyfwps_set_reduce";
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_set == NULL )
 	{
 		PyErr_Format(
 		 PyExc_TypeError,
-		 "%s: unsupported bytes object type",
+		 "%s: invalid set.",
 		 function );
 
 		return( NULL );
 	}
-	PyErr_Clear();
+	result = libfwps_set_get_serialized_size(
+	          pyfwps_set->set,
+	          &byte_stream_size,
+	          &error );
 
-#if PY_MAJOR_VERSION >= 3
-	byte_stream = PyBytes_AsString(
-	               bytes_object );
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve serialized size.",
+		 function );
 
-	byte_stream_size = PyBytes_Size(
-	                    bytes_object );
-#else
-	byte_stream = PyString_AsString(
-	               bytes_object );
+		libcerror_error_free(
+		 &error );
 
-	byte_stream_size = PyString_Size(
-	                    bytes_object );
-#endif
-	if( ( byte_stream_size < 0 )
-	 || ( byte_stream_size > (Py_ssize_t) SSIZE_MAX ) )
+		goto on_error;
+	}
+	if( byte_stream_size > (size_t) PY_SSIZE_T_MAX )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
-		 "%s: invalid byte stream size value out of bounds.",
+		 "%s: invalid serialized size value exceeds maximum.",
 		 function );
 
-		return( NULL );
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) byte_stream_size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) byte_stream_size );
+#endif
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create byte stream object.",
+		 function );
+
+		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	byte_stream = PyBytes_AsString(
+	               bytes_object );
+#else
+	byte_stream = PyString_AsString(
+	               bytes_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libfwps_set_copy_from_byte_stream(
+	result = libfwps_set_copy_to_byte_stream(
 	          pyfwps_set->set,
 	          (uint8_t *) byte_stream,
-	          (size_t) byte_stream_size,
-	          LIBFWPS_ENDIAN_LITTLE,
+	          byte_stream_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -457,18 +689,112 @@ PyObject *pyfwps_set_copy_from_byte_stream(
 		pyfwps_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to copy set from byte stream.",
+		 "%s: unable to copy set to byte stream.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
+		goto on_error;
+	}
+	/* Unpickling creates a new set and restores it with __setstate__
+	 */
+	reduce_object = Py_BuildValue(
+	                 "O()(Oi)",
+	                 (PyObject *) Py_TYPE( pyfwps_set ),
+	                 bytes_object,
+	                 pyfwps_set->ascii_codepage );
+
+	if( reduce_object == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 bytes_object );
+
+	return( reduce_object );
+
+on_error:
+	if( bytes_object != NULL )
+	{
+		Py_DecRef(
+		 bytes_object );
+	}
+	return( NULL );
+}
+
+/* Restores the set from the pickled state
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_set_state(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *bytes_object      = NULL;
+	PyObject *copy_arguments    = NULL;
+	PyObject *result_object     = NULL;
+	PyObject *state_object      = NULL;
+	static char *function       = "pyfwps_set_set_state";
+	static char *keyword_list[] = { "state", NULL };
+	int ascii_codepage          = 0;
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid set.",
+		 function );
+
 		return( NULL );
 	}
-	Py_IncRef(
-	 Py_None );
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &state_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyArg_ParseTuple(
+	     state_object,
+	     "Oi",
+	     &bytes_object,
+	     &ascii_codepage ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyfwps_codepage_to_string(
+	     ascii_codepage ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported ASCII codepage: %d.",
+		 function,
+		 ascii_codepage );
 
-	return( Py_None );
+		return( NULL );
+	}
+	copy_arguments = PyTuple_Pack(
+	                  1,
+	                  bytes_object );
+
+	if( copy_arguments == NULL )
+	{
+		return( NULL );
+	}
+	pyfwps_set->ascii_codepage = ascii_codepage;
+
+	result_object = pyfwps_set_copy_from_byte_stream(
+	                 pyfwps_set,
+	                 copy_arguments,
+	                 NULL );
+
+	Py_DecRef(
+	 copy_arguments );
+
+	return( result_object );
 }
 
 /* Retrieves the identifier
@@ -496,16 +822,12 @@ PyObject *pyfwps_set_get_identifier(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_set_get_identifier(
 	          pyfwps_set->set,
 	          guid_data,
 	          16,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -559,15 +881,11 @@ PyObject *pyfwps_set_get_number_of_records(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_set_get_number_of_records(
 	          pyfwps_set->set,
 	          &number_of_records,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -598,10 +916,12 @@ PyObject *pyfwps_set_get_record_by_index(
            PyObject *pyfwps_set,
            int record_index )
 {
+	pyfwps_set_t *set_object = NULL;
 	PyObject *record_object  = NULL;
 	libcerror_error_t *error = NULL;
 	libfwps_record_t *record = NULL;
 	static char *function    = "pyfwps_set_get_record_by_index";
+	int number_of_records    = 0;
 	int result               = 0;
 
 	if( pyfwps_set == NULL )
@@ -613,16 +933,28 @@ PyObject *pyfwps_set_get_record_by_index(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
+	set_object = (pyfwps_set_t *) pyfwps_set;
 
+	/* Reuse the record object if it was created before
+	 */
+	if( ( set_object->record_objects != NULL )
+	 && ( record_index >= 0 )
+	 && ( record_index < set_object->number_of_record_objects )
+	 && ( set_object->record_objects[ record_index ] != NULL ) )
+	{
+		record_object = set_object->record_objects[ record_index ];
+
+		Py_IncRef(
+		 record_object );
+
+		return( record_object );
+	}
 	result = libfwps_set_get_record_by_index(
-	          ( (pyfwps_set_t *) pyfwps_set )->set,
+	          set_object->set,
 	          record_index,
 	          &record,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -650,12 +982,62 @@ PyObject *pyfwps_set_get_record_by_index(
 
 		goto on_error;
 	}
+	if( set_object->record_objects == NULL )
+	{
+		if( libfwps_set_get_number_of_records(
+		     set_object->set,
+		     &number_of_records,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		set_object->record_objects = (PyObject **) PyMem_Malloc(
+		                                            sizeof( PyObject * ) * number_of_records );
+
+		if( set_object->record_objects == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create record objects cache.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 set_object->record_objects,
+		 0,
+		 sizeof( PyObject * ) * number_of_records );
+
+		set_object->number_of_record_objects = number_of_records;
+	}
+	if( ( record_index >= 0 )
+	 && ( record_index < set_object->number_of_record_objects ) )
+	{
+		Py_IncRef(
+		 record_object );
+
+		set_object->record_objects[ record_index ] = record_object;
+	}
 	return( record_object );
 
 on_error:
-	if( record != NULL )
+	if( record_object != NULL )
 	{
-		libfwps_record_free(
+		Py_DecRef(
+		 record_object );
+	}
+	else if( record != NULL )
+	{
+		libfwps_record_free(
 		 &record,
 		 NULL );
 	}
@@ -690,6 +1072,228 @@ PyObject *pyfwps_set_get_record(
 	return( record_object );
 }
 
+/* Retrieves the record object of a specific libfwps record
+ * The record object is retrieved by index so that cached record objects are reused
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_get_record_by_record(
+           PyObject *pyfwps_set,
+           libfwps_record_t *record )
+{
+	libcerror_error_t *error       = NULL;
+	libfwps_record_t *other_record = NULL;
+	static char *function          = "pyfwps_set_get_record_by_record";
+	int number_of_records          = 0;
+	int record_index               = 0;
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid set.",
+		 function );
+
+		return( NULL );
+	}
+	if( libfwps_set_get_number_of_records(
+	     ( (pyfwps_set_t *) pyfwps_set )->set,
+	     &number_of_records,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfwps_set_get_record_by_index(
+		     ( (pyfwps_set_t *) pyfwps_set )->set,
+		     record_index,
+		     &other_record,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( other_record == record )
+		{
+			return( pyfwps_set_get_record_by_index(
+			         pyfwps_set,
+			         record_index ) );
+		}
+	}
+	PyErr_Format(
+	 PyExc_IOError,
+	 "%s: unable to find record in set.",
+	 function );
+
+	return( NULL );
+}
+
+/* Retrieves a specific record by entry type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_get_record_by_entry_type(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	libfwps_record_t *record    = NULL;
+	static char *function       = "pyfwps_set_get_record_by_entry_type";
+	static char *keyword_list[] = { "entry_type", NULL };
+	unsigned long entry_type    = 0;
+	int result                  = 0;
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid set.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "k",
+	     keyword_list,
+	     &entry_type ) == 0 )
+	{
+		return( NULL );
+	}
+	if( entry_type > (unsigned long) UINT32_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid entry type value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	/* The GIL is kept since the lookup can build the records index of the set
+	 */
+	result = libfwps_set_get_record_by_entry_type(
+	          pyfwps_set->set,
+	          (uint32_t) entry_type,
+	          &record,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %lu.",
+		 function,
+		 entry_type );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	return( pyfwps_set_get_record_by_record(
+	         (PyObject *) pyfwps_set,
+	         record ) );
+}
+
+/* Retrieves a specific record by entry name
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_get_record_by_name(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	libfwps_record_t *record    = NULL;
+	static char *function       = "pyfwps_set_get_record_by_name";
+	static char *keyword_list[] = { "name", NULL };
+	char *utf8_name             = NULL;
+	size_t utf8_name_length     = 0;
+	int result                  = 0;
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid set.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "s",
+	     keyword_list,
+	     &utf8_name ) == 0 )
+	{
+		return( NULL );
+	}
+	utf8_name_length = narrow_string_length(
+	                    utf8_name );
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          pyfwps_set->set,
+	          (uint8_t *) utf8_name,
+	          utf8_name_length,
+	          &record,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %s.",
+		 function,
+		 utf8_name );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	return( pyfwps_set_get_record_by_record(
+	         (PyObject *) pyfwps_set,
+	         record ) );
+}
+
 /* Retrieves a sequence and iterator object for the records
  * Returns a Python object if successful or NULL on error
  */
@@ -714,15 +1318,11 @@ PyObject *pyfwps_set_get_records(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_set_get_number_of_records(
 	          pyfwps_set->set,
 	          &number_of_records,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -754,3 +1354,271 @@ PyObject *pyfwps_set_get_records(
 	return( sequence_object );
 }
 
+/* Converts the records of a set into dictionary objects
+ * The dictionaries are appended to the list object if set, otherwise
+ * they are inserted into the dict object by the key of the record
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_set_convert_records(
+     libfwps_set_t *set,
+     PyObject *list_object,
+     PyObject *dict_object,
+     int key_type )
+{
+	uint8_t guid_data[ 16 ];
+
+	PyObject *identifier_object = NULL;
+	PyObject *key_object        = NULL;
+	PyObject *record_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	libfwps_record_t *record    = NULL;
+	static char *function       = "pyfwps_set_convert_records";
+	int number_of_records       = 0;
+	int record_index            = 0;
+	int result                  = 0;
+
+	if( libfwps_set_get_identifier(
+	     set,
+	     guid_data,
+	     16,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	identifier_object = pyfwps_string_new_from_guid(
+	                     guid_data,
+	                     16 );
+
+	if( identifier_object == NULL )
+	{
+		goto on_error;
+	}
+	if( libfwps_set_get_number_of_records(
+	     set,
+	     &number_of_records,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfwps_set_get_record_by_index(
+		     set,
+		     record_index,
+		     &record,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		record_object = pyfwps_record_dict_new_from_record(
+		                 record,
+		                 identifier_object );
+
+		if( record_object == NULL )
+		{
+			goto on_error;
+		}
+		if( list_object != NULL )
+		{
+			result = PyList_Append(
+			          list_object,
+			          record_object );
+		}
+		else
+		{
+			key_object = pyfwps_record_key_new_from_record(
+			              record,
+			              identifier_object,
+			              key_type );
+
+			if( key_object == NULL )
+			{
+				goto on_error;
+			}
+			result = PyDict_SetItem(
+			          dict_object,
+			          key_object,
+			          record_object );
+
+			Py_DecRef(
+			 key_object );
+
+			key_object = NULL;
+		}
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 record_object );
+
+		record_object = NULL;
+
+		libfwps_record_free(
+		 &record,
+		 NULL );
+	}
+	Py_DecRef(
+	 identifier_object );
+
+	return( 1 );
+
+on_error:
+	if( record_object != NULL )
+	{
+		Py_DecRef(
+		 record_object );
+	}
+	if( record != NULL )
+	{
+		libfwps_record_free(
+		 &record,
+		 NULL );
+	}
+	if( identifier_object != NULL )
+	{
+		Py_DecRef(
+		 identifier_object );
+	}
+	return( -1 );
+}
+
+/* Converts the records into a list of dictionaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_to_list(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *list_object = NULL;
+	static char *function = "pyfwps_set_to_list";
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid set.",
+		 function );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               0 );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwps_set_convert_records(
+	     pyfwps_set->set,
+	     list_object,
+	     NULL,
+	     0 ) != 1 )
+	{
+		Py_DecRef(
+		 list_object );
+
+		return( NULL );
+	}
+	return( list_object );
+}
+
+/* Converts the records into a dictionary of dictionaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_set_to_dict(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *dict_object       = NULL;
+	static char *function       = "pyfwps_set_to_dict";
+	static char *keyword_list[] = { "key", NULL };
+	char *key_string            = NULL;
+	int key_type                = 0;
+
+	if( pyfwps_set == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid set.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|s",
+	     keyword_list,
+	     &key_string ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyfwps_record_get_key_type_from_string(
+	     key_string,
+	     &key_type ) != 1 )
+	{
+		return( NULL );
+	}
+	dict_object = PyDict_New();
+
+	if( dict_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwps_set_convert_records(
+	     pyfwps_set->set,
+	     NULL,
+	     dict_object,
+	     key_type ) != 1 )
+	{
+		Py_DecRef(
+		 dict_object );
+
+		return( NULL );
+	}
+	return( dict_object );
+}
@@ -47,6 +47,22 @@ struct pyfwps_set
 	/* The parent object
 	 */
 	PyObject *parent_object;
+
+	/* The cached record objects
+	 */
+	PyObject **record_objects;
+
+	/* The number of cached record objects
+	 */
+	int number_of_record_objects;
+
+	/* The number of exported record data buffers
+	 */
+	int number_of_exported_buffers;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
 };
 
 extern PyMethodDef pyfwps_set_object_methods[];
@@ -62,11 +78,28 @@ int pyfwps_set_init(
 void pyfwps_set_free(
       pyfwps_set_t *pyfwps_set );
 
+int pyfwps_set_traverse(
+     pyfwps_set_t *pyfwps_set,
+     visitproc visit,
+     void *arg );
+
+int pyfwps_set_clear(
+     pyfwps_set_t *pyfwps_set );
+
 PyObject *pyfwps_set_copy_from_byte_stream(
            pyfwps_set_t *pyfwps_set,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwps_set_reduce(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments );
+
+PyObject *pyfwps_set_set_state(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfwps_set_get_identifier(
            pyfwps_set_t *pyfwps_set,
            PyObject *arguments );
@@ -84,10 +117,39 @@ PyObject *pyfwps_set_get_record(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwps_set_get_record_by_record(
+           PyObject *pyfwps_set,
+           libfwps_record_t *record );
+
+PyObject *pyfwps_set_get_record_by_entry_type(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwps_set_get_record_by_name(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfwps_set_get_records(
            pyfwps_set_t *pyfwps_set,
            PyObject *arguments );
 
+int pyfwps_set_convert_records(
+     libfwps_set_t *set,
+     PyObject *list_object,
+     PyObject *dict_object,
+     int key_type );
+
+PyObject *pyfwps_set_to_list(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments );
+
+PyObject *pyfwps_set_to_dict(
+           pyfwps_set_t *pyfwps_set,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
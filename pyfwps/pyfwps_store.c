@@ -20,16 +20,21 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "pyfwps_codepage.h"
 #include "pyfwps_error.h"
+#include "pyfwps_guid.h"
 #include "pyfwps_libcerror.h"
 #include "pyfwps_libfwps.h"
 #include "pyfwps_python.h"
+#include "pyfwps_record.h"
 #include "pyfwps_set.h"
 #include "pyfwps_sets.h"
 #include "pyfwps_store.h"
@@ -42,7 +47,26 @@ PyMethodDef pyfwps_store_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "copy_from_byte_stream(byte_stream)\n"
 	  "\n"
-	  "Copies the store from the byte stream." },
+	  "Copies the store from the byte stream.\n"
+	  "The byte stream can be any object that supports the buffer protocol,\n"
+	  "such as bytes, bytearray, memoryview or mmap.\n"
+	  "The GIL is released while parsing, so stores can be parsed\n"
+	  "concurrently from multiple threads." },
+
+	{ "__reduce__",
+	  (PyCFunction) pyfwps_store_reduce,
+	  METH_NOARGS,
+	  "__reduce__() -> Tuple\n"
+	  "\n"
+	  "Reduces the store for pickling.\n"
+	  "The pickled state consists of the serialized store and the ASCII codepage." },
+
+	{ "__setstate__",
+	  (PyCFunction) pyfwps_store_set_state,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "__setstate__(state)\n"
+	  "\n"
+	  "Restores the store from the pickled state." },
 
 	{ "get_number_of_sets",
 	  (PyCFunction) pyfwps_store_get_number_of_sets,
@@ -58,6 +82,32 @@ PyMethodDef pyfwps_store_object_methods[] = {
 	  "\n"
 	  "Retrieves the set specified by the index." },
 
+	{ "get_property",
+	  (PyCFunction) pyfwps_store_get_property,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_property(fmtid, pid) -> Object or None\n"
+	  "\n"
+	  "Retrieves the record specified by the property key.\n"
+	  "The format class identifier (fmtid) is a GUID string, with or without surrounding braces,\n"
+	  "and the property identifier (pid) is the entry type of the record." },
+
+	{ "to_list",
+	  (PyCFunction) pyfwps_store_to_list,
+	  METH_NOARGS,
+	  "to_list() -> List\n"
+	  "\n"
+	  "Converts the records of all sets into a list of dictionaries with the keys:\n"
+	  "set_identifier, entry_type, entry_name, value_type and value." },
+
+	{ "to_dict",
+	  (PyCFunction) pyfwps_store_to_dict,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_dict(key=\"pkey\") -> Dictionary\n"
+	  "\n"
+	  "Converts the records of all sets into a dictionary of dictionaries as returned by to_list.\n"
+	  "The key is either \"pkey\", which is formatted as \"{identifier} entry\",\n"
+	  "or \"entry\", which is the entry type or entry name." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -120,13 +170,13 @@ PyTypeObject pyfwps_store_type_object = {
 	/* tp_as_buffer */
 	0,
 	/* tp_flags */
-	Py_TPFLAGS_DEFAULT,
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
 	/* tp_doc */
 	"pyfwps store object (wraps libfwps_store_t)",
 	/* tp_traverse */
-	0,
+	(traverseproc) pyfwps_store_traverse,
 	/* tp_clear */
-	0,
+	(inquiry) pyfwps_store_clear,
 	/* tp_richcompare */
 	0,
 	/* tp_weaklistoffset */
@@ -175,6 +225,52 @@ PyTypeObject pyfwps_store_type_object = {
 	0
 };
 
+/* Creates a new store object
+ * The store object takes over ownership of the libfwps store
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_new(
+           libfwps_store_t *store )
+{
+	pyfwps_store_t *pyfwps_store = NULL;
+	static char *function        = "pyfwps_store_new";
+
+	if( store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyfwps_store = PyObject_GC_New(
+	                struct pyfwps_store,
+	                &pyfwps_store_type_object );
+
+	if( pyfwps_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize store.",
+		 function );
+
+		return( NULL );
+	}
+	pyfwps_store->store                      = store;
+	pyfwps_store->set_objects                = NULL;
+	pyfwps_store->number_of_set_objects      = 0;
+	pyfwps_store->number_of_exported_buffers = 0;
+	pyfwps_store->ascii_codepage             = LIBFWPS_CODEPAGE_WINDOWS_1252;
+
+	PyObject_GC_Track(
+	 (PyObject *) pyfwps_store );
+
+	return( (PyObject *) pyfwps_store );
+}
+
 /* Initializes a store object
  * Returns 0 if successful or -1 on error
  */
@@ -195,7 +291,11 @@ int pyfwps_store_init(
 	}
 	/* Make sure libfwps store is set to NULL
 	 */
-	pyfwps_store->store = NULL;
+	pyfwps_store->store                      = NULL;
+	pyfwps_store->set_objects                = NULL;
+	pyfwps_store->number_of_set_objects      = 0;
+	pyfwps_store->number_of_exported_buffers = 0;
+	pyfwps_store->ascii_codepage             = LIBFWPS_CODEPAGE_WINDOWS_1252;
 
 	if( libfwps_store_initialize(
 	     &( pyfwps_store->store ),
@@ -255,6 +355,12 @@ void pyfwps_store_free(
 
 		return;
 	}
+	PyObject_GC_UnTrack(
+	 (PyObject *) pyfwps_store );
+
+	pyfwps_store_clear(
+	 pyfwps_store );
+
 	if( pyfwps_store->store != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -281,6 +387,63 @@ void pyfwps_store_free(
 	 (PyObject*) pyfwps_store );
 }
 
+/* Traverses the cached objects of a store object
+ * Returns 0 if successful or the result of the visit function otherwise
+ */
+int pyfwps_store_traverse(
+     pyfwps_store_t *pyfwps_store,
+     visitproc visit,
+     void *arg )
+{
+	int set_index = 0;
+
+	if( pyfwps_store->set_objects != NULL )
+	{
+		for( set_index = 0;
+		     set_index < pyfwps_store->number_of_set_objects;
+		     set_index++ )
+		{
+			Py_VISIT(
+			 pyfwps_store->set_objects[ set_index ] );
+		}
+	}
+	return( 0 );
+}
+
+/* Clears the cached objects of a store object
+ * Returns 0
+ */
+int pyfwps_store_clear(
+     pyfwps_store_t *pyfwps_store )
+{
+	PyObject **set_objects    = NULL;
+	int number_of_set_objects = 0;
+	int set_index             = 0;
+
+	/* Detach the cache before releasing the objects since releasing
+	 * an object can re-enter the store
+	 */
+	set_objects           = pyfwps_store->set_objects;
+	number_of_set_objects = pyfwps_store->number_of_set_objects;
+
+	pyfwps_store->set_objects           = NULL;
+	pyfwps_store->number_of_set_objects = 0;
+
+	if( set_objects != NULL )
+	{
+		for( set_index = 0;
+		     set_index < number_of_set_objects;
+		     set_index++ )
+		{
+			Py_CLEAR(
+			 set_objects[ set_index ] );
+		}
+		PyMem_Free(
+		 set_objects );
+	}
+	return( 0 );
+}
+
 /* Copies the store from a byte stream
  * Returns a Python object if successful or NULL on error
  */
@@ -289,12 +452,12 @@ PyObject *pyfwps_store_copy_from_byte_stream(
            PyObject *arguments,
            PyObject *keywords )
 {
+	Py_buffer buffer;
+
 	PyObject *bytes_object      = NULL;
 	libcerror_error_t *error    = NULL;
-	const char *byte_stream     = NULL;
 	static char *function       = "pyfwps_store_copy_from_byte_stream";
 	static char *keyword_list[] = { "byte_stream", NULL };
-	Py_ssize_t byte_stream_size = 0;
 	int result                  = 0;
 
 	if( pyfwps_store == NULL )
@@ -306,6 +469,17 @@ PyObject *pyfwps_store_copy_from_byte_stream(
 
 		return( NULL );
 	}
+	/* The exported record data buffers point into the data that is replaced
+	 */
+	if( pyfwps_store->number_of_exported_buffers > 0 )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: unable to copy store from byte stream while record data is exported.",
+		 function );
+
+		return( NULL );
+	}
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
@@ -317,65 +491,156 @@ PyObject *pyfwps_store_copy_from_byte_stream(
 	}
 	PyErr_Clear();
 
-#if PY_MAJOR_VERSION >= 3
-	result = PyObject_IsInstance(
-	          bytes_object,
-	          (PyObject *) &PyBytes_Type );
-#else
-	result = PyObject_IsInstance(
-	          bytes_object,
-	          (PyObject *) &PyString_Type );
-#endif
-	if( result == -1 )
+	/* The buffer remains pinned until it is released, which prevents
+	 * the exporter, such as a bytearray, from being resized during the parse
+	 */
+	if( PyObject_GetBuffer(
+	     bytes_object,
+	     &buffer,
+	     PyBUF_SIMPLE ) != 0 )
 	{
 		pyfwps_error_fetch_and_raise(
-		 PyExc_RuntimeError,
-		 "%s: unable to determine if object is of type bytes.",
+		 PyExc_TypeError,
+		 "%s: unsupported byte stream object type.",
 		 function );
 
 		return( NULL );
 	}
-	else if( result == 0 )
+	if( ( buffer.len < 0 )
+	 || ( buffer.len > (Py_ssize_t) SSIZE_MAX ) )
+	{
+		PyBuffer_Release(
+		 &buffer );
+
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* The cached set objects refer to the sets that are replaced
+	 */
+	pyfwps_store_clear(
+	 pyfwps_store );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwps_store_copy_from_byte_stream(
+	          pyfwps_store->store,
+	          (uint8_t *) buffer.buf,
+	          (size_t) buffer.len,
+	          pyfwps_store->ascii_codepage,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to copy store from byte stream.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Reduces the store for pickling
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_reduce(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *bytes_object   = NULL;
+	PyObject *reduce_object  = NULL;
+	libcerror_error_t *error = NULL;
+	char *byte_stream        = NULL;
+	static char *function    = "pyfwps_store_reduce";
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_store == NULL )
 	{
 		PyErr_Format(
 		 PyExc_TypeError,
-		 "%s: unsupported bytes object type",
+		 "%s: invalid store.",
 		 function );
 
 		return( NULL );
 	}
-	PyErr_Clear();
+	result = libfwps_store_get_serialized_size(
+	          pyfwps_store->store,
+	          &byte_stream_size,
+	          &error );
 
-#if PY_MAJOR_VERSION >= 3
-	byte_stream = PyBytes_AsString(
-	               bytes_object );
+	if( result != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve serialized size.",
+		 function );
 
-	byte_stream_size = PyBytes_Size(
-	                    bytes_object );
-#else
-	byte_stream = PyString_AsString(
-	               bytes_object );
+		libcerror_error_free(
+		 &error );
 
-	byte_stream_size = PyString_Size(
-	                    bytes_object );
-#endif
-	if( ( byte_stream_size < 0 )
-	 || ( byte_stream_size > (Py_ssize_t) SSIZE_MAX ) )
+		goto on_error;
+	}
+	if( byte_stream_size > (size_t) PY_SSIZE_T_MAX )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
-		 "%s: invalid byte stream size value out of bounds.",
+		 "%s: invalid serialized size value exceeds maximum.",
 		 function );
 
-		return( NULL );
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) byte_stream_size );
+#else
+	bytes_object = PyString_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) byte_stream_size );
+#endif
+	if( bytes_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create byte stream object.",
+		 function );
+
+		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	byte_stream = PyBytes_AsString(
+	               bytes_object );
+#else
+	byte_stream = PyString_AsString(
+	               bytes_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libfwps_store_copy_from_byte_stream(
+	result = libfwps_store_copy_to_byte_stream(
 	          pyfwps_store->store,
 	          (uint8_t *) byte_stream,
-	          (size_t) byte_stream_size,
-	          LIBFWPS_ENDIAN_LITTLE,
+	          byte_stream_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -385,18 +650,112 @@ PyObject *pyfwps_store_copy_from_byte_stream(
 		pyfwps_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to copy store from byte stream.",
+		 "%s: unable to copy store to byte stream.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
+		goto on_error;
+	}
+	/* Unpickling creates a new store and restores it with __setstate__
+	 */
+	reduce_object = Py_BuildValue(
+	                 "O()(Oi)",
+	                 (PyObject *) Py_TYPE( pyfwps_store ),
+	                 bytes_object,
+	                 pyfwps_store->ascii_codepage );
+
+	if( reduce_object == NULL )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 bytes_object );
+
+	return( reduce_object );
+
+on_error:
+	if( bytes_object != NULL )
+	{
+		Py_DecRef(
+		 bytes_object );
+	}
+	return( NULL );
+}
+
+/* Restores the store from the pickled state
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_set_state(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *bytes_object      = NULL;
+	PyObject *copy_arguments    = NULL;
+	PyObject *result_object     = NULL;
+	PyObject *state_object      = NULL;
+	static char *function       = "pyfwps_store_set_state";
+	static char *keyword_list[] = { "state", NULL };
+	int ascii_codepage          = 0;
+
+	if( pyfwps_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid store.",
+		 function );
+
 		return( NULL );
 	}
-	Py_IncRef(
-	 Py_None );
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &state_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyArg_ParseTuple(
+	     state_object,
+	     "Oi",
+	     &bytes_object,
+	     &ascii_codepage ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyfwps_codepage_to_string(
+	     ascii_codepage ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported ASCII codepage: %d.",
+		 function,
+		 ascii_codepage );
 
-	return( Py_None );
+		return( NULL );
+	}
+	copy_arguments = PyTuple_Pack(
+	                  1,
+	                  bytes_object );
+
+	if( copy_arguments == NULL )
+	{
+		return( NULL );
+	}
+	pyfwps_store->ascii_codepage = ascii_codepage;
+
+	result_object = pyfwps_store_copy_from_byte_stream(
+	                 pyfwps_store,
+	                 copy_arguments,
+	                 NULL );
+
+	Py_DecRef(
+	 copy_arguments );
+
+	return( result_object );
 }
 
 /* Retrieves the number of sets
@@ -423,15 +782,11 @@ PyObject *pyfwps_store_get_number_of_sets(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_store_get_number_of_sets(
 	          pyfwps_store->store,
 	          &number_of_sets,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -462,11 +817,13 @@ PyObject *pyfwps_store_get_set_by_index(
            PyObject *pyfwps_store,
            int set_index )
 {
-	PyObject *set_object     = NULL;
-	libcerror_error_t *error = NULL;
-	libfwps_set_t *set       = NULL;
-	static char *function    = "pyfwps_store_get_set_by_index";
-	int result               = 0;
+	pyfwps_store_t *store_object = NULL;
+	PyObject *set_object         = NULL;
+	libcerror_error_t *error     = NULL;
+	libfwps_set_t *set           = NULL;
+	static char *function        = "pyfwps_store_get_set_by_index";
+	int number_of_sets           = 0;
+	int result                   = 0;
 
 	if( pyfwps_store == NULL )
 	{
@@ -477,16 +834,28 @@ PyObject *pyfwps_store_get_set_by_index(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
+	store_object = (pyfwps_store_t *) pyfwps_store;
+
+	/* Reuse the set object if it was created before
+	 */
+	if( ( store_object->set_objects != NULL )
+	 && ( set_index >= 0 )
+	 && ( set_index < store_object->number_of_set_objects )
+	 && ( store_object->set_objects[ set_index ] != NULL ) )
+	{
+		set_object = store_object->set_objects[ set_index ];
+
+		Py_IncRef(
+		 set_object );
 
+		return( set_object );
+	}
 	result = libfwps_store_get_set_by_index(
-	          ( (pyfwps_store_t *) pyfwps_store )->store,
+	          store_object->store,
 	          set_index,
 	          &set,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -514,10 +883,64 @@ PyObject *pyfwps_store_get_set_by_index(
 
 		goto on_error;
 	}
+	/* The records of the set were read with the codepage of the store
+	 */
+	( (pyfwps_set_t *) set_object )->ascii_codepage = store_object->ascii_codepage;
+
+	if( store_object->set_objects == NULL )
+	{
+		if( libfwps_store_get_number_of_sets(
+		     store_object->store,
+		     &number_of_sets,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve number of sets.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		store_object->set_objects = (PyObject **) PyMem_Malloc(
+		                                           sizeof( PyObject * ) * number_of_sets );
+
+		if( store_object->set_objects == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create set objects cache.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 store_object->set_objects,
+		 0,
+		 sizeof( PyObject * ) * number_of_sets );
+
+		store_object->number_of_set_objects = number_of_sets;
+	}
+	if( ( set_index >= 0 )
+	 && ( set_index < store_object->number_of_set_objects ) )
+	{
+		Py_IncRef(
+		 set_object );
+
+		store_object->set_objects[ set_index ] = set_object;
+	}
 	return( set_object );
 
 on_error:
-	if( set != NULL )
+	if( set_object != NULL )
+	{
+		Py_DecRef(
+		 set_object );
+	}
+	else if( set != NULL )
 	{
 		libfwps_set_free(
 		 &set,
@@ -554,6 +977,194 @@ PyObject *pyfwps_store_get_set(
 	return( set_object );
 }
 
+/* Retrieves a specific record by property key
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_get_property(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	uint8_t guid_data[ 16 ];
+
+	PyObject *record_object     = NULL;
+	PyObject *set_object        = NULL;
+	libcerror_error_t *error    = NULL;
+	libfwps_record_t *record    = NULL;
+	libfwps_set_t *other_set    = NULL;
+	libfwps_set_t *set          = NULL;
+	static char *function       = "pyfwps_store_get_property";
+	static char *keyword_list[] = { "fmtid", "pid", NULL };
+	char *utf8_fmtid            = NULL;
+	unsigned long pid           = 0;
+	int number_of_sets          = 0;
+	int result                  = 0;
+	int set_index               = 0;
+
+	if( pyfwps_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "sk",
+	     keyword_list,
+	     &utf8_fmtid,
+	     &pid ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pid > (unsigned long) UINT32_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid property identifier value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwps_guid_copy_from_utf8_string(
+	     utf8_fmtid,
+	     narrow_string_length(
+	      utf8_fmtid ),
+	     guid_data,
+	     16 ) != 1 )
+	{
+		return( NULL );
+	}
+	result = libfwps_store_get_set_by_identifier(
+	          pyfwps_store->store,
+	          guid_data,
+	          16,
+	          &set,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve set: %s.",
+		 function,
+		 utf8_fmtid );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          (uint32_t) pid,
+	          &record,
+	          &error );
+
+	if( result == -1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %lu.",
+		 function,
+		 pid );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	/* Look up the index of the set so that cached set and record objects are reused
+	 */
+	if( libfwps_store_get_number_of_sets(
+	     pyfwps_store->store,
+	     &number_of_sets,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libfwps_store_get_set_by_index(
+		     pyfwps_store->store,
+		     set_index,
+		     &other_set,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( other_set == set )
+		{
+			break;
+		}
+	}
+	if( set_index >= number_of_sets )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to find set in store.",
+		 function );
+
+		return( NULL );
+	}
+	set_object = pyfwps_store_get_set_by_index(
+	              (PyObject *) pyfwps_store,
+	              set_index );
+
+	if( set_object == NULL )
+	{
+		return( NULL );
+	}
+	record_object = pyfwps_set_get_record_by_record(
+	                 set_object,
+	                 record );
+
+	Py_DecRef(
+	 set_object );
+
+	return( record_object );
+}
+
 /* Retrieves a sequence and iterator object for the sets
  * Returns a Python object if successful or NULL on error
  */
@@ -578,15 +1189,11 @@ PyObject *pyfwps_store_get_sets(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
 	result = libfwps_store_get_number_of_sets(
 	          pyfwps_store->store,
 	          &number_of_sets,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwps_error_raise(
@@ -618,3 +1225,184 @@ PyObject *pyfwps_store_get_sets(
 	return( sequence_object );
 }
 
+/* Converts the records of all sets into dictionary objects
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwps_store_convert_records(
+     libfwps_store_t *store,
+     PyObject *list_object,
+     PyObject *dict_object,
+     int key_type )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_set_t *set       = NULL;
+	static char *function    = "pyfwps_store_convert_records";
+	int number_of_sets       = 0;
+	int result               = 0;
+	int set_index            = 0;
+
+	if( libfwps_store_get_number_of_sets(
+	     store,
+	     &number_of_sets,
+	     &error ) != 1 )
+	{
+		pyfwps_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of sets.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	for( set_index = 0;
+	     set_index < number_of_sets;
+	     set_index++ )
+	{
+		if( libfwps_store_get_set_by_index(
+		     store,
+		     set_index,
+		     &set,
+		     &error ) != 1 )
+		{
+			pyfwps_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve set: %d.",
+			 function,
+			 set_index );
+
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		result = pyfwps_set_convert_records(
+		          set,
+		          list_object,
+		          dict_object,
+		          key_type );
+
+		libfwps_set_free(
+		 &set,
+		 NULL );
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Converts the records of all sets into a list of dictionaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_to_list(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments PYFWPS_ATTRIBUTE_UNUSED )
+{
+	PyObject *list_object = NULL;
+	static char *function = "pyfwps_store_to_list";
+
+	PYFWPS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwps_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               0 );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwps_store_convert_records(
+	     pyfwps_store->store,
+	     list_object,
+	     NULL,
+	     0 ) != 1 )
+	{
+		Py_DecRef(
+		 list_object );
+
+		return( NULL );
+	}
+	return( list_object );
+}
+
+/* Converts the records of all sets into a dictionary of dictionaries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwps_store_to_dict(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *dict_object       = NULL;
+	static char *function       = "pyfwps_store_to_dict";
+	static char *keyword_list[] = { "key", NULL };
+	char *key_string            = NULL;
+	int key_type                = 0;
+
+	if( pyfwps_store == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid store.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|s",
+	     keyword_list,
+	     &key_string ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyfwps_record_get_key_type_from_string(
+	     key_string,
+	     &key_type ) != 1 )
+	{
+		return( NULL );
+	}
+	dict_object = PyDict_New();
+
+	if( dict_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwps_store_convert_records(
+	     pyfwps_store->store,
+	     NULL,
+	     dict_object,
+	     key_type ) != 1 )
+	{
+		Py_DecRef(
+		 dict_object );
+
+		return( NULL );
+	}
+	return( dict_object );
+}
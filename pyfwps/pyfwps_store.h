@@ -43,22 +43,58 @@ struct pyfwps_store
 	/* The libfwps store
 	 */
 	libfwps_store_t *store;
+
+	/* The cached set objects
+	 */
+	PyObject **set_objects;
+
+	/* The number of cached set objects
+	 */
+	int number_of_set_objects;
+
+	/* The number of exported record data buffers
+	 */
+	int number_of_exported_buffers;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
 };
 
 extern PyMethodDef pyfwps_store_object_methods[];
 extern PyTypeObject pyfwps_store_type_object;
 
+PyObject *pyfwps_store_new(
+           libfwps_store_t *store );
+
 int pyfwps_store_init(
      pyfwps_store_t *pyfwps_store );
 
 void pyfwps_store_free(
       pyfwps_store_t *pyfwps_store );
 
+int pyfwps_store_traverse(
+     pyfwps_store_t *pyfwps_store,
+     visitproc visit,
+     void *arg );
+
+int pyfwps_store_clear(
+     pyfwps_store_t *pyfwps_store );
+
 PyObject *pyfwps_store_copy_from_byte_stream(
            pyfwps_store_t *pyfwps_store,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwps_store_reduce(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments );
+
+PyObject *pyfwps_store_set_state(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfwps_store_get_number_of_sets(
            pyfwps_store_t *pyfwps_store,
            PyObject *arguments );
@@ -72,10 +108,30 @@ PyObject *pyfwps_store_get_set(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwps_store_get_property(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfwps_store_get_sets(
            pyfwps_store_t *pyfwps_store,
            PyObject *arguments );
 
+int pyfwps_store_convert_records(
+     libfwps_store_t *store,
+     PyObject *list_object,
+     PyObject *dict_object,
+     int key_type );
+
+PyObject *pyfwps_store_to_list(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments );
+
+PyObject *pyfwps_store_to_dict(
+           pyfwps_store_t *pyfwps_store,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
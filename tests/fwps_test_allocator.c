@@ -0,0 +1,603 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_test_libcerror.h"
+#include "fwps_test_libfwps.h"
+#include "fwps_test_macros.h"
+#include "fwps_test_memory.h"
+#include "fwps_test_unused.h"
+
+#include "../libfwps/libfwps_allocator.h"
+#include "../libfwps/libfwps_definitions.h"
+
+typedef struct fwps_test_allocator_context fwps_test_allocator_context_t;
+
+struct fwps_test_allocator_context
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The number of frees
+	 */
+	int number_of_frees;
+};
+
+/* Allocates memory for the allocator tests
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *fwps_test_allocator_allocate_function(
+       size_t size,
+       void *context )
+{
+	( (fwps_test_allocator_context_t *) context )->number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Frees memory for the allocator tests
+ */
+void fwps_test_allocator_free_function(
+      void *memory,
+      void *context )
+{
+	( (fwps_test_allocator_context_t *) context )->number_of_frees += 1;
+
+	memory_free(
+	 memory );
+}
+
+/* Tests the libfwps_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_allocator(
+     void )
+{
+	fwps_test_allocator_context_t allocator_context;
+
+	libcerror_error_t *error = NULL;
+	libfwps_store_t *store   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	allocator_context.number_of_allocations = 0;
+	allocator_context.number_of_frees       = 0;
+
+	result = libfwps_set_allocator(
+	          &fwps_test_allocator_allocate_function,
+	          &fwps_test_allocator_free_function,
+	          (void *) &allocator_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_allocator(
+	          &fwps_test_allocator_allocate_function,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_allocator(
+	          NULL,
+	          &fwps_test_allocator_free_function,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	libfwps_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfwps_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_get_statistics(
+     void )
+{
+	libfwps_statistics_t initial_statistics;
+	libfwps_statistics_t statistics;
+
+	libcerror_error_t *error           = NULL;
+	libfwps_store_cache_t *store_cache = NULL;
+	libfwps_store_t *store             = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_get_statistics(
+	          &initial_statistics,
+	          &error );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The statistics are only available if libfwps was built with allocation statistics
+	 */
+	if( result != 0 )
+	{
+		result = libfwps_store_initialize(
+		          &store,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_get_statistics(
+		          &statistics,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics.number_of_store_allocations",
+		 statistics.number_of_store_allocations,
+		 initial_statistics.number_of_store_allocations + 1 );
+
+		FWPS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "initial_statistics.live_size",
+		 initial_statistics.live_size,
+		 statistics.live_size );
+
+		FWPS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "statistics.live_size",
+		 statistics.live_size,
+		 statistics.peak_live_size + 1 );
+
+		result = libfwps_store_free(
+		          &store,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_get_statistics(
+		          &statistics,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics.live_size",
+		 statistics.live_size,
+		 initial_statistics.live_size );
+
+		/* The store cache and its entries are allocated by the allocator
+		 */
+		result = libfwps_store_cache_initialize(
+		          &store_cache,
+		          1,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_get_statistics(
+		          &statistics,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics.number_of_store_cache_allocations",
+		 statistics.number_of_store_cache_allocations,
+		 initial_statistics.number_of_store_cache_allocations + 2 );
+
+		result = libfwps_store_cache_free(
+		          &store_cache,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_get_statistics(
+		          &statistics,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "statistics.live_size",
+		 statistics.live_size,
+		 initial_statistics.live_size );
+	}
+	/* Test error cases
+	 */
+	result = libfwps_get_statistics(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store_cache != NULL )
+	{
+		libfwps_store_cache_free(
+		 &store_cache,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+/* Tests the libfwps_allocator_allocate and libfwps_allocator_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_allocator_allocate(
+     void )
+{
+	fwps_test_allocator_context_t allocator_context;
+
+	libcerror_error_t *error = NULL;
+	void *memory             = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	memory = libfwps_allocator_allocate(
+	          16,
+	          LIBFWPS_ALLOCATION_TYPE_STORE );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	libfwps_allocator_free(
+	 memory );
+
+	memory = NULL;
+
+	/* Test allocation and free with a custom allocator
+	 */
+	allocator_context.number_of_allocations = 0;
+	allocator_context.number_of_frees       = 0;
+
+	result = libfwps_set_allocator(
+	          &fwps_test_allocator_allocate_function,
+	          &fwps_test_allocator_free_function,
+	          (void *) &allocator_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory = libfwps_allocator_allocate(
+	          16,
+	          LIBFWPS_ALLOCATION_TYPE_INDEX );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	libfwps_allocator_free(
+	 memory );
+
+	memory = NULL;
+
+	result = libfwps_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 1 );
+
+	/* Freeing NULL is ignored
+	 */
+	libfwps_allocator_free(
+	 NULL );
+
+	/* Test error cases
+	 */
+	memory = libfwps_allocator_allocate(
+	          16,
+	          -1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	memory = libfwps_allocator_allocate(
+	          16,
+	          LIBFWPS_NUMBER_OF_ALLOCATION_TYPES );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory != NULL )
+	{
+		libfwps_allocator_free(
+		 memory );
+	}
+	libfwps_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+	FWPS_TEST_RUN(
+	 "libfwps_allocator_allocate",
+	 fwps_test_allocator_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_allocator",
+	 fwps_test_set_allocator );
+
+	FWPS_TEST_RUN(
+	 "libfwps_get_statistics",
+	 fwps_test_get_statistics );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
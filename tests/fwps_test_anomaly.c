@@ -0,0 +1,762 @@
+/*
+ * Library anomaly functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_test_libcdata.h"
+#include "fwps_test_libcerror.h"
+#include "fwps_test_libfwps.h"
+#include "fwps_test_macros.h"
+#include "fwps_test_memory.h"
+#include "fwps_test_unused.h"
+
+#include "../libfwps/libfwps_anomaly.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+/* Tests the libfwps_anomaly_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_anomaly_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwps_anomaly_t *anomaly      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWPS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwps_anomaly_initialize(
+	          &anomaly,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "anomaly",
+	 anomaly );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_anomaly_free(
+	          &anomaly,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "anomaly",
+	 anomaly );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_anomaly_initialize(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	anomaly = (libfwps_anomaly_t *) 0x12345678UL;
+
+	result = libfwps_anomaly_initialize(
+	          &anomaly,
+	          &error );
+
+	anomaly = NULL;
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWPS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwps_anomaly_initialize with malloc failing
+		 */
+		fwps_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwps_anomaly_initialize(
+		          &anomaly,
+		          &error );
+
+		if( fwps_test_malloc_attempts_before_fail != -1 )
+		{
+			fwps_test_malloc_attempts_before_fail = -1;
+
+			if( anomaly != NULL )
+			{
+				libfwps_anomaly_free(
+				 &anomaly,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWPS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWPS_TEST_ASSERT_IS_NULL(
+			 "anomaly",
+			 anomaly );
+
+			FWPS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwps_anomaly_initialize with memset failing
+		 */
+		fwps_test_memset_attempts_before_fail = test_number;
+
+		result = libfwps_anomaly_initialize(
+		          &anomaly,
+		          &error );
+
+		if( fwps_test_memset_attempts_before_fail != -1 )
+		{
+			fwps_test_memset_attempts_before_fail = -1;
+
+			if( anomaly != NULL )
+			{
+				libfwps_anomaly_free(
+				 &anomaly,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWPS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWPS_TEST_ASSERT_IS_NULL(
+			 "anomaly",
+			 anomaly );
+
+			FWPS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWPS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( anomaly != NULL )
+	{
+		libfwps_anomaly_free(
+		 &anomaly,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_anomaly_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_anomaly_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwps_anomaly_free(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_anomaly_is_recoverable_parse_error function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_anomaly_is_recoverable_parse_error(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_INSUFFICIENT_MEMORY );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwps_anomaly_is_recoverable_parse_error(
+	          LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwps_anomaly_append_to_array, libfwps_anomaly_append_array_to_array,
+ * libfwps_anomaly_array_get_number_of_anomalies and libfwps_anomaly_array_get_anomaly_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_anomaly_append_to_array(
+     void )
+{
+	libcdata_array_t *anomalies_array        = NULL;
+	libcdata_array_t *copied_anomalies_array = NULL;
+	libcerror_error_t *error                 = NULL;
+	off64_t offset                           = 0;
+	int anomaly_type                         = 0;
+	int number_of_anomalies                  = 0;
+	int parse_error_code                     = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_anomaly_array_get_number_of_anomalies(
+	          anomalies_array,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The anomalies array is created on the first anomaly
+	 */
+	result = libfwps_anomaly_append_to_array(
+	          &anomalies_array,
+	          LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED,
+	          24,
+	          LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "anomalies_array",
+	 anomalies_array );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_anomaly_append_to_array(
+	          &anomalies_array,
+	          LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED,
+	          137,
+	          LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_anomaly_append_array_to_array(
+	          &copied_anomalies_array,
+	          anomalies_array,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "copied_anomalies_array",
+	 copied_anomalies_array );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Appending a missing anomalies array is ignored
+	 */
+	result = libfwps_anomaly_append_array_to_array(
+	          &copied_anomalies_array,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_anomaly_array_get_number_of_anomalies(
+	          copied_anomalies_array,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 2 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          copied_anomalies_array,
+	          1,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 137 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_anomaly_append_to_array(
+	          NULL,
+	          LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED,
+	          24,
+	          LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_append_array_to_array(
+	          NULL,
+	          anomalies_array,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_number_of_anomalies(
+	          anomalies_array,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          NULL,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          anomalies_array,
+	          2,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          anomalies_array,
+	          0,
+	          NULL,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          anomalies_array,
+	          0,
+	          &anomaly_type,
+	          NULL,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_anomaly_array_get_anomaly_by_index(
+	          anomalies_array,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &copied_anomalies_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "copied_anomalies_array",
+	 copied_anomalies_array );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &anomalies_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "anomalies_array",
+	 anomalies_array );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( copied_anomalies_array != NULL )
+	{
+		libcdata_array_free(
+		 &copied_anomalies_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		 NULL );
+	}
+	if( anomalies_array != NULL )
+	{
+		libcdata_array_free(
+		 &anomalies_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwps_anomaly_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+	FWPS_TEST_RUN(
+	 "libfwps_anomaly_initialize",
+	 fwps_test_anomaly_initialize );
+
+	FWPS_TEST_RUN(
+	 "libfwps_anomaly_free",
+	 fwps_test_anomaly_free );
+
+	FWPS_TEST_RUN(
+	 "libfwps_anomaly_is_recoverable_parse_error",
+	 fwps_test_anomaly_is_recoverable_parse_error );
+
+	FWPS_TEST_RUN(
+	 "libfwps_anomaly_append_to_array",
+	 fwps_test_anomaly_append_to_array );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,364 @@
+/*
+ * Library diagnostics functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_test_libcerror.h"
+#include "fwps_test_libfwps.h"
+#include "fwps_test_macros.h"
+#include "fwps_test_memory.h"
+#include "fwps_test_unused.h"
+
+/* A store with a single set that contains a 32-bit integer record
+ */
+uint8_t fwps_test_diagnostics_store_data1[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43,
+	0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00 };
+
+/* Tests the libfwps_diagnostics_enable, libfwps_diagnostics_read_event
+ * and libfwps_diagnostics_disable functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_diagnostics(
+     void )
+{
+	libfwps_diagnostic_event_t event;
+
+	libcerror_error_t *error          = NULL;
+	libfwps_store_t *store            = NULL;
+	uint64_t number_of_dropped_events = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_diagnostics_enable(
+	          2,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_diagnostics_store_data1,
+	          49,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An event for the record followed by an event for the set
+	 */
+	result = libfwps_diagnostics_read_event(
+	          &event,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "event.event_type",
+	 event.event_type,
+	 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_RECORD );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "event.offset",
+	 (int64_t) event.offset,
+	 (int64_t) 24 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT64(
+	 "event.size",
+	 (uint64_t) event.size,
+	 (uint64_t) 17 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "event.value_type",
+	 event.value_type,
+	 (uint32_t) LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "event.decision",
+	 event.decision,
+	 LIBFWPS_DIAGNOSTIC_DECISION_ACCEPTED );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "event.anomaly_flags",
+	 event.anomaly_flags,
+	 0 );
+
+	result = libfwps_diagnostics_read_event(
+	          &event,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "event.event_type",
+	 event.event_type,
+	 LIBFWPS_DIAGNOSTIC_EVENT_TYPE_SET );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT64(
+	 "event.size",
+	 (uint64_t) event.size,
+	 (uint64_t) 45 );
+
+	result = libfwps_diagnostics_read_event(
+	          &event,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Events that do not fit in the ring buffer are dropped
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_diagnostics_store_data1,
+	          49,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_diagnostics_store_data1,
+	          49,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_diagnostics_get_number_of_dropped_events(
+	          &number_of_dropped_events,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_dropped_events",
+	 number_of_dropped_events,
+	 (uint64_t) 2 );
+
+	result = libfwps_diagnostics_disable(
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_diagnostics_enable(
+	          3,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_diagnostics_read_event(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	libfwps_diagnostics_disable(
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWPS_TEST_RUN(
+	 "libfwps_diagnostics",
+	 fwps_test_diagnostics );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
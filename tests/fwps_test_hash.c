@@ -0,0 +1,739 @@
+/*
+ * Library hash functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_test_libcerror.h"
+#include "fwps_test_libfwps.h"
+#include "fwps_test_macros.h"
+#include "fwps_test_memory.h"
+#include "fwps_test_unused.h"
+
+#include "../libfwps/libfwps_hash.h"
+
+uint8_t fwps_test_hash_data1[ 37 ] = {
+	0x25, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10,
+	0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+/* Tests the libfwps_hash_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_hash_context_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwps_hash_context_t *context = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWPS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwps_hash_context_initialize(
+	          &context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_free(
+	          &context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_hash_context_initialize(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (libfwps_hash_context_t *) 0x12345678UL;
+
+	result = libfwps_hash_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWPS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwps_hash_context_initialize with malloc failing
+		 */
+		fwps_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwps_hash_context_initialize(
+		          &context,
+		          &error );
+
+		if( fwps_test_malloc_attempts_before_fail != -1 )
+		{
+			fwps_test_malloc_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libfwps_hash_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWPS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWPS_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			FWPS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwps_hash_context_initialize with memset failing
+		 */
+		fwps_test_memset_attempts_before_fail = test_number;
+
+		result = libfwps_hash_context_initialize(
+		          &context,
+		          &error );
+
+		if( fwps_test_memset_attempts_before_fail != -1 )
+		{
+			fwps_test_memset_attempts_before_fail = -1;
+
+			if( context != NULL )
+			{
+				libfwps_hash_context_free(
+				 &context,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWPS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWPS_TEST_ASSERT_IS_NULL(
+			 "context",
+			 context );
+
+			FWPS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWPS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libfwps_hash_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_hash_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_hash_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwps_hash_context_free(
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_hash_context_update and libfwps_hash_context_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_hash_context_update(
+     void )
+{
+	uint8_t calculated_hash[ LIBFWPS_HASH_SIZE ];
+	uint8_t hash[ LIBFWPS_HASH_SIZE ];
+
+	libcerror_error_t *error        = NULL;
+	libfwps_hash_context_t *context = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_hash_context_initialize(
+	          &context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwps_hash_context_reset(
+	 context );
+
+	/* Test regular cases
+	 */
+	result = libfwps_hash_context_update(
+	          context,
+	          fwps_test_hash_data1,
+	          5,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_update(
+	          context,
+	          &( fwps_test_hash_data1[ 5 ] ),
+	          32,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_finalize(
+	          context,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          37,
+	          calculated_hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          calculated_hash,
+	          LIBFWPS_HASH_SIZE );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          36,
+	          calculated_hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          calculated_hash,
+	          LIBFWPS_HASH_SIZE );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_hash_context_update(
+	          NULL,
+	          fwps_test_hash_data1,
+	          37,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_context_update(
+	          context,
+	          NULL,
+	          37,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_context_update(
+	          context,
+	          fwps_test_hash_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_context_finalize(
+	          NULL,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_context_finalize(
+	          context,
+	          NULL,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_context_finalize(
+	          context,
+	          hash,
+	          LIBFWPS_HASH_SIZE - 1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_hash_context_free(
+	          &context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libfwps_hash_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_hash_calculate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_hash_calculate(
+     void )
+{
+	uint8_t hash[ LIBFWPS_HASH_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          37,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          0,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_hash_calculate(
+	          NULL,
+	          37,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          37,
+	          NULL,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_hash_calculate(
+	          fwps_test_hash_data1,
+	          37,
+	          hash,
+	          LIBFWPS_HASH_SIZE - 1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+	FWPS_TEST_RUN(
+	 "libfwps_hash_context_initialize",
+	 fwps_test_hash_context_initialize );
+
+	FWPS_TEST_RUN(
+	 "libfwps_hash_context_free",
+	 fwps_test_hash_context_free );
+
+	FWPS_TEST_RUN(
+	 "libfwps_hash_context_update",
+	 fwps_test_hash_context_update );
+
+	FWPS_TEST_RUN(
+	 "libfwps_hash_calculate",
+	 fwps_test_hash_calculate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+}
+
@@ -21,12 +21,15 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fwps_test_functions.h"
+#include "fwps_test_libbfio.h"
 #include "fwps_test_libcerror.h"
 #include "fwps_test_libfwps.h"
 #include "fwps_test_macros.h"
@@ -34,6 +37,7 @@
 #include "fwps_test_unused.h"
 
 #include "../libfwps/libfwps_definitions.h"
+#include "../libfwps/libfwps_hash.h"
 #include "../libfwps/libfwps_record.h"
 
 uint8_t fwps_test_record_data1[ 113 ] = {
@@ -68,6 +72,26 @@ uint8_t fwps_test_record_data2[ 281 ] = {
 	0x00, 0x42, 0x00, 0x32, 0x00, 0x37, 0x00, 0x42, 0x00, 0x33, 0x00, 0x44, 0x00, 0x39, 0x00, 0x7d,
 	0x00, 0x2c, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+/* Record with value of type 0x0041
+ */
+uint8_t fwps_test_record_data3[ 33 ] = {
+	0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f };
+
+/* Record with value of type 0x101f with alignment padding
+ */
+uint8_t fwps_test_record_data4[ 33 ] = {
+	0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+	0x00 };
+
+/* Record with value of type 0x101f without alignment padding
+ */
+uint8_t fwps_test_record_data5[ 29 ] = {
+	0x1d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
 
 /* Tests the libfwps_record_initialize function
@@ -572,23 +596,47 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
-
-/* Tests the libfwps_record_get_value_type function
+/* Tests the libfwps_record_get_parse_error function
  * Returns 1 if successful or 0 if not
  */
-int fwps_test_record_get_value_type(
-     libfwps_record_t *record )
+int fwps_test_record_get_parse_error(
+     void )
 {
+	uint8_t byte_stream[ 33 ];
+
 	libcerror_error_t *error = NULL;
-	uint32_t value_type      = 0;
+	libfwps_record_t *record = NULL;
+	size_t error_offset      = 0;
+	int error_code           = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libfwps_record_get_value_type(
+	result = libfwps_record_copy_from_byte_stream(
 	          record,
-	          &value_type,
+	          fwps_test_record_data1,
+	          113,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -596,37 +644,69 @@ int fwps_test_record_get_value_type(
 	 result,
 	 1 );
 
-	FWPS_TEST_ASSERT_EQUAL_UINT32(
-	 "value_type",
-	 value_type,
-	 (uint32_t) 0x0000001fUL );
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_parse_error(
+	          record,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	FWPS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Clean up
 	 */
-	result = libfwps_record_get_value_type(
-	          NULL,
-	          &value_type,
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test parse error with a byte stream that is too small
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
 
-	result = libfwps_record_get_value_type(
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
 	          record,
-	          NULL,
+	          fwps_test_record_data1,
+	          12,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -641,65 +721,57 @@ int fwps_test_record_get_value_type(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	result = libfwps_record_get_parse_error(
+	          record,
+	          &error_code,
+	          &error_offset,
+	          &error );
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
-#endif
-{
-#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	libcerror_error_t *error = NULL;
-	libfwps_record_t *record = NULL;
-	int result               = 0;
-#endif
-#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
-	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_DATA_TOO_SMALL );
 
-	FWPS_TEST_RUN(
-	 "libfwps_record_initialize",
-	 fwps_test_record_initialize );
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 0 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
 
-	FWPS_TEST_RUN(
-	 "libfwps_record_free",
-	 fwps_test_record_free );
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
 
-	FWPS_TEST_RUN(
-	 "libfwps_record_copy_from_byte_stream",
-	 fwps_test_record_copy_from_byte_stream );
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+	/* Test parse error with an unsupported value type
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_record_data3,
+	 33 );
 
-#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	byte_stream[ 9 ] = 0x0d;
 
-	/* Initialize record for tests
-	 */
 	result = libfwps_record_initialize(
 	          &record,
 	          LIBFWPS_RECORD_TYPE_NUMERIC,
@@ -720,11 +792,29 @@ int main(
 
 	result = libfwps_record_copy_from_byte_stream(
 	          record,
-	          fwps_test_record_data1,
-	          113,
+	          byte_stream,
+	          33,
 	          LIBFWPS_CODEPAGE_WINDOWS_1252,
 	          &error );
 
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_parse_error(
+	          record,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
 	FWPS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -734,23 +824,2437 @@ int main(
 	 "error",
 	 error );
 
-	/* TODO: add tests for libfwps_record_get_utf8_entry_name_size */
-	/* TODO: add tests for libfwps_record_get_utf8_entry_name */
-	/* TODO: add tests for libfwps_record_get_utf16_entry_name_size */
-	/* TODO: add tests for libfwps_record_get_utf16_entry_name */
-	/* TODO: add tests for libfwps_record_get_entry_type */
-	/* TODO: add tests for libfwps_record_get_utf8_value_name_size */
-	/* TODO: add tests for libfwps_record_get_utf8_value_name */
-	/* TODO: add tests for libfwps_record_get_utf16_value_name_size */
-	/* TODO: add tests for libfwps_record_get_utf16_value_name */
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
 
-	FWPS_TEST_RUN_WITH_ARGS(
-	 "libfwps_record_get_value_type",
-	 fwps_test_record_get_value_type,
-	 record );
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 13 );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_get_parse_error(
+	          NULL,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_parse_error(
+	          record,
+	          NULL,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_parse_error(
+	          record,
+	          &error_code,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_internal_record_read_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_internal_record_read_byte_stream(
+     void )
+{
+	uint8_t data[ 281 ];
+
+	const uint8_t *data_pointer = NULL;
+	libcerror_error_t *error    = NULL;
+	libfwps_record_t *record    = NULL;
+	size_t data_size            = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test vector value data larger than the value data threshold is deferred
+	 */
+	result = libfwps_internal_record_read_byte_stream(
+	          (libfwps_internal_record_t *) record,
+	          fwps_test_record_data2,
+	          281,
+	          0,
+	          16,
+	          NULL,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "record->has_deferred_value_data",
+	 ( (libfwps_internal_record_t *) record )->has_deferred_value_data,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record->value_data",
+	 ( (libfwps_internal_record_t *) record )->value_data );
+
+	result = libfwps_record_get_data_pointer(
+	          record,
+	          &data_pointer,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_size(
+	          record,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 264 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data(
+	          record,
+	          data,
+	          data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( fwps_test_record_data2[ 17 ] ),
+	          data_size );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwps_internal_record_clear(
+	          (libfwps_internal_record_t *) record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test vector value data smaller than the value data threshold is copied
+	 */
+	result = libfwps_internal_record_read_byte_stream(
+	          (libfwps_internal_record_t *) record,
+	          fwps_test_record_data2,
+	          281,
+	          0,
+	          1024,
+	          NULL,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "record->has_deferred_value_data",
+	 ( (libfwps_internal_record_t *) record )->has_deferred_value_data,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record->value_data",
+	 ( (libfwps_internal_record_t *) record )->value_data );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+/* Tests the libfwps_record_get_value_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_get_value_type(
+     libfwps_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t value_type      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_get_value_type(
+	          record,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 (uint32_t) 0x0000001fUL );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_get_value_type(
+	          NULL,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_value_type(
+	          record,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_record_get_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_get_data_pointer(
+     libfwps_record_t *record )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_get_data_pointer(
+	          record,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 92 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_get_data_pointer(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_data_pointer(
+	          record,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_get_data_pointer(
+	          record,
+	          &data,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_record_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_read_data(
+     libfwps_record_t *record )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+
+	/* Test regular cases
+	 */
+	read_count = libfwps_record_read_data(
+	              record,
+	              0,
+	              buffer,
+	              128,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 92 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              88,
+	              buffer,
+	              128,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              0,
+	              buffer,
+	              2,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 0 ]",
+	 (int) buffer[ 0 ],
+	 0x53 );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              92,
+	              buffer,
+	              128,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfwps_record_read_data(
+	              NULL,
+	              0,
+	              buffer,
+	              128,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              0,
+	              NULL,
+	              128,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+/* Tests the libfwps_record_patch_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_patch_value(
+     void )
+{
+	uint8_t byte_stream[ 113 ];
+	uint8_t data[ 92 ];
+	uint8_t file_data[ 49 ];
+
+	uint8_t patch_data[ 10 ] = {
+		'S', 0, '-', 0, '1', 0, '-', 0, '5', 0 };
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfwps_record_t *record         = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_record_data1,
+	 113 );
+
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
+	          record,
+	          byte_stream,
+	          113,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          byte_stream,
+	          113,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value data starts at offset 17 and is 92 bytes of size
+	 */
+	result = memory_compare(
+	          &( byte_stream[ 17 ] ),
+	          patch_data,
+	          10 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "byte_stream[ 27 ]",
+	 (int) byte_stream[ 27 ],
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "byte_stream[ 108 ]",
+	 (int) byte_stream[ 108 ],
+	 0 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwps_test_record_data1,
+	          17 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwps_record_get_data(
+	          record,
+	          data,
+	          92,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( byte_stream[ 17 ] ),
+	          92 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_patch_value(
+	          NULL,
+	          byte_stream,
+	          113,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          NULL,
+	          113,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          byte_stream,
+	          100,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          byte_stream,
+	          113,
+	          0,
+	          NULL,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          byte_stream,
+	          113,
+	          0,
+	          data,
+	          93,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the byte stream does not contain the record value data
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          fwps_test_record_data1,
+	          113,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test with value data deferred to the byte stream
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_record_data3,
+	 33 );
+
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_internal_record_read_byte_stream(
+	          (libfwps_internal_record_t *) record,
+	          byte_stream,
+	          33,
+	          0,
+	          8,
+	          NULL,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "record->has_deferred_value_data",
+	 ( (libfwps_internal_record_t *) record )->has_deferred_value_data,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          byte_stream,
+	          33,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfwps_record_read_data(
+	              record,
+	              0,
+	              data,
+	              16,
+	              &error );
+
+	FWPS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          patch_data,
+	          10 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error case where the byte stream does not contain the deferred record value data
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          fwps_test_record_data3,
+	          33,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test with value data deferred to a file IO handle
+	 * where the record is stored at file offset 16
+	 */
+	memory_set(
+	 file_data,
+	 0,
+	 16 );
+
+	memory_copy(
+	 &( file_data[ 16 ] ),
+	 fwps_test_record_data3,
+	 33 );
+
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          49,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_read_file_io_handle(
+	          record,
+	          file_io_handle,
+	          16,
+	          33,
+	          8,
+	          NULL,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "record->has_deferred_value_data",
+	 ( (libfwps_internal_record_t *) record )->has_deferred_value_data,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          &( file_data[ 16 ] ),
+	          33,
+	          16,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value data starts at file offset 33 and is 16 bytes of size
+	 */
+	result = memory_compare(
+	          &( file_data[ 33 ] ),
+	          patch_data,
+	          10 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "file_data[ 48 ]",
+	 (int) file_data[ 48 ],
+	 0 );
+
+	/* Test error case where the byte stream offset is not the file offset of the byte stream
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          &( file_data[ 16 ] ),
+	          33,
+	          0,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          &( file_data[ 16 ] ),
+	          33,
+	          -1,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_patch_value(
+	          record,
+	          &( file_data[ 16 ] ),
+	          33,
+	          34,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the byte stream does not contain the deferred record value data
+	 */
+	result = libfwps_record_patch_value(
+	          record,
+	          fwps_test_record_data3,
+	          33,
+	          16,
+	          patch_data,
+	          10,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		fwps_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_internal_record_compare_value and libfwps_internal_record_update_hash_context functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_internal_record_compare_value(
+     void )
+{
+	libfwps_hash_context_t hash_context;
+
+	uint8_t data[ 29 ];
+	uint8_t first_hash[ LIBFWPS_HASH_SIZE ];
+	uint8_t second_hash[ LIBFWPS_HASH_SIZE ];
+
+	libcerror_error_t *error        = NULL;
+	libfwps_record_t *first_record  = NULL;
+	libfwps_record_t *second_record = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &first_record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "first_record",
+	 first_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_initialize(
+	          &second_record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "second_record",
+	 second_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
+	          first_record,
+	          fwps_test_record_data4,
+	          33,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
+	          second_record,
+	          fwps_test_record_data5,
+	          29,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the vector value data sizes and alignment padding are ignored
+	 */
+	result = libfwps_internal_record_compare_value(
+	          (libfwps_internal_record_t *) first_record,
+	          (libfwps_internal_record_t *) second_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwps_hash_context_reset(
+	 &hash_context );
+
+	result = libfwps_internal_record_update_hash_context(
+	          (libfwps_internal_record_t *) first_record,
+	          &hash_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_finalize(
+	          &hash_context,
+	          first_hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwps_hash_context_reset(
+	 &hash_context );
+
+	result = libfwps_internal_record_update_hash_context(
+	          (libfwps_internal_record_t *) second_record,
+	          &hash_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_finalize(
+	          &hash_context,
+	          second_hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_hash,
+	          second_hash,
+	          LIBFWPS_HASH_SIZE );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that different vector values are not equal
+	 */
+	memory_copy(
+	 data,
+	 fwps_test_record_data5,
+	 29 );
+
+	data[ 27 ] = 0x43;
+
+	result = libfwps_internal_record_clear(
+	          (libfwps_internal_record_t *) second_record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
+	          second_record,
+	          data,
+	          29,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_internal_record_compare_value(
+	          (libfwps_internal_record_t *) first_record,
+	          (libfwps_internal_record_t *) second_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwps_hash_context_reset(
+	 &hash_context );
+
+	result = libfwps_internal_record_update_hash_context(
+	          (libfwps_internal_record_t *) second_record,
+	          &hash_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_hash_context_finalize(
+	          &hash_context,
+	          second_hash,
+	          LIBFWPS_HASH_SIZE,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_hash,
+	          second_hash,
+	          LIBFWPS_HASH_SIZE );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_internal_record_compare_value(
+	          NULL,
+	          (libfwps_internal_record_t *) second_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_internal_record_update_hash_context(
+	          NULL,
+	          &hash_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &second_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "second_record",
+	 second_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &first_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "first_record",
+	 first_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &second_record,
+		 NULL );
+	}
+	if( first_record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &first_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+/* Tests the libfwps_record_set_data_as_boolean function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_set_data_as_boolean(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	uint32_t value_type      = 0;
+	uint8_t value_boolean    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_set_data_as_boolean(
+	          record,
+	          1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_value_type(
+	          record,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 LIBFWPS_VALUE_TYPE_BOOLEAN );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_as_boolean(
+	          record,
+	          &value_boolean,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT8(
+	 "value_boolean",
+	 value_boolean,
+	 0xff );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_set_data_as_boolean(
+	          NULL,
+	          1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_record_set_data_as_64bit_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_set_data_as_64bit_integer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	uint32_t value_type      = 0;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_set_data_as_64bit_integer(
+	          record,
+	          0x0123456789abcdefUL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_value_type(
+	          record,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 LIBFWPS_VALUE_TYPE_INTEGER_64BIT_UNSIGNED );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_as_64bit_integer(
+	          record,
+	          &value_64bit,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x0123456789abcdefUL );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_set_data_as_64bit_integer(
+	          NULL,
+	          0x0123456789abcdefUL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_record_set_data_as_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_set_data_as_filetime(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	uint32_t value_type      = 0;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_set_data_as_filetime(
+	          record,
+	          0x01cb3a623d0a17ceUL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_value_type(
+	          record,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 LIBFWPS_VALUE_TYPE_FILETIME );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_as_filetime(
+	          record,
+	          &filetime,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 0x01cb3a623d0a17ceUL );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_set_data_as_filetime(
+	          NULL,
+	          0x01cb3a623d0a17ceUL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_record_set_data_as_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_record_set_data_as_guid(
+     void )
+{
+	uint8_t guid_data[ 16 ] = {
+		0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce };
+
+	uint8_t value_guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	uint32_t value_type      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_record_set_data_as_guid(
+	          record,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_value_type(
+	          record,
+	          &value_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_type",
+	 value_type,
+	 LIBFWPS_VALUE_TYPE_GUID );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_as_guid(
+	          record,
+	          value_guid_data,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_guid_data,
+	          guid_data,
+	          16 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_record_set_data_as_guid(
+	          NULL,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_set_data_as_guid(
+	          record,
+	          NULL,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_record_set_data_as_guid(
+	          record,
+	          guid_data,
+	          15,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_internal_record_free(
+	          (libfwps_internal_record_t **) &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libfwps_internal_record_free(
+		 (libfwps_internal_record_t **) &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	int result               = 0;
+#endif
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_initialize",
+	 fwps_test_record_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_free",
+	 fwps_test_record_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_copy_from_byte_stream",
+	 fwps_test_record_copy_from_byte_stream );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_get_parse_error",
+	 fwps_test_record_get_parse_error );
+
+	FWPS_TEST_RUN(
+	 "libfwps_internal_record_read_byte_stream",
+	 fwps_test_internal_record_read_byte_stream );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_patch_value",
+	 fwps_test_record_patch_value );
+
+	FWPS_TEST_RUN(
+	 "libfwps_internal_record_compare_value",
+	 fwps_test_internal_record_compare_value );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_set_data_as_boolean",
+	 fwps_test_record_set_data_as_boolean );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_set_data_as_64bit_integer",
+	 fwps_test_record_set_data_as_64bit_integer );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_set_data_as_filetime",
+	 fwps_test_record_set_data_as_filetime );
+
+	FWPS_TEST_RUN(
+	 "libfwps_record_set_data_as_guid",
+	 fwps_test_record_set_data_as_guid );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFWPS_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize record for tests
+	 */
+	result = libfwps_record_initialize(
+	          &record,
+	          LIBFWPS_RECORD_TYPE_NUMERIC,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_copy_from_byte_stream(
+	          record,
+	          fwps_test_record_data1,
+	          113,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* TODO: add tests for libfwps_record_get_utf8_entry_name_size */
+	/* TODO: add tests for libfwps_record_get_utf8_entry_name */
+	/* TODO: add tests for libfwps_record_get_utf16_entry_name_size */
+	/* TODO: add tests for libfwps_record_get_utf16_entry_name */
+	/* TODO: add tests for libfwps_record_get_entry_type */
+	/* TODO: add tests for libfwps_record_get_utf8_value_name_size */
+	/* TODO: add tests for libfwps_record_get_utf8_value_name */
+	/* TODO: add tests for libfwps_record_get_utf16_value_name_size */
+	/* TODO: add tests for libfwps_record_get_utf16_value_name */
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_record_get_value_type",
+	 fwps_test_record_get_value_type,
+	 record );
+
+	/* TODO: add tests for libfwps_record_get_data_size */
+	/* TODO: add tests for libfwps_record_get_data */
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_record_get_data_pointer",
+	 fwps_test_record_get_data_pointer,
+	 record );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_record_read_data",
+	 fwps_test_record_read_data,
+	 record );
 
-	/* TODO: add tests for libfwps_record_get_data_size */
-	/* TODO: add tests for libfwps_record_get_data */
 	/* TODO: add tests for libfwps_record_get_data_as_boolean */
 	/* TODO: add tests for libfwps_record_get_data_as_8bit_integer */
 	/* TODO: add tests for libfwps_record_get_data_as_16bit_integer */
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -478,18 +479,1734 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwps_set_get_parse_error function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_get_parse_error(
+     void )
+{
+	uint8_t byte_stream[ 141 ];
+
+	libcerror_error_t *error = NULL;
+	libfwps_set_t *set       = NULL;
+	size_t error_offset      = 0;
+	int error_code           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse error of an unsupported signature
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_set_data1,
+	 141 );
+
+	byte_stream[ 4 ] = 0xff;
+
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse error of a record with an unsupported value type
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_set_data1,
+	 141 );
+
+	byte_stream[ 33 ] = 0x0d;
+
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 37 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_get_parse_error(
+	          NULL,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          NULL,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          &error_code,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( set != NULL )
+	{
+		libfwps_set_free(
+		 &set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Record callback function for the scan byte stream tests
+ * Returns 1 to continue the scan, 0 to stop the scan or -1 on error
+ */
+int fwps_test_set_scan_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	uint32_t entry_type = 0;
+
+	if( ( set_identifier == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libfwps_record_get_entry_type(
+	     record,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( entry_type != 4 )
+	{
+		return( -1 );
+	}
+	*( (int *) callback_data ) += 1;
+
+	return( 1 );
+}
+
+/* Record callback function that stops the scan
+ * Returns 0 to stop the scan
+ */
+int fwps_test_set_scan_record_callback_stop(
+     const uint8_t *set_identifier FWPS_TEST_ATTRIBUTE_UNUSED,
+     libfwps_record_t *record FWPS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWPS_TEST_ATTRIBUTE_UNUSED )
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( set_identifier )
+	FWPS_TEST_UNREFERENCED_PARAMETER( record )
+	FWPS_TEST_UNREFERENCED_PARAMETER( error )
+
+	*( (int *) callback_data ) += 1;
+
+	return( 0 );
+}
+
+/* Tests the libfwps_set_scan_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_scan_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_scan_byte_stream(
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_set_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records = 0;
+
+	result = libfwps_set_scan_byte_stream(
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_set_scan_record_callback_stop,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_scan_byte_stream(
+	          NULL,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_set_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_scan_byte_stream(
+	          fwps_test_set_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_set_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_scan_byte_stream(
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwps_set_get_number_of_records function
  * Returns 1 if successful or 0 if not
  */
-int fwps_test_set_get_number_of_records(
-     libfwps_set_t *set )
+int fwps_test_set_get_number_of_records(
+     libfwps_set_t *set )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_get_number_of_records(
+	          set,
+	          &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_number_of_records(
+	          set,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_get_record_by_entry_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_get_record_by_entry_type(
+     libfwps_set_t *set )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record = NULL;
+
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_get_record_by_entry_type(
+	          NULL,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          4,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          (uint8_t *) "name",
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_get_record_by_utf8_entry_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_get_record_by_utf8_entry_name(
+     void )
+{
+	uint8_t named_properties_identifier[ 16 ] = {
+		0x05, 0xd5, 0xcd, 0xd5, 0x9c, 0x2e, 0x1b, 0x10, 0x93, 0x97, 0x08, 0x00, 0x2b, 0x2c, 0xf9, 0xae };
+
+	libcerror_error_t *error       = NULL;
+	libfwps_record_t *first_record = NULL;
+	libfwps_record_t *record       = NULL;
+	libfwps_set_t *set             = NULL;
+	libfwps_store_t *store         = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_append_set(
+	          store,
+	          named_properties_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_append_record(
+	          set,
+	          &first_record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_utf8_entry_name(
+	          first_record,
+	          (uint8_t *) "second",
+	          6,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_append_record(
+	          set,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_utf8_entry_name(
+	          record,
+	          (uint8_t *) "first",
+	          5,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	record = NULL;
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          (uint8_t *) "second",
+	          6,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INTPTR(
+	 "record",
+	 (intptr_t) record,
+	 (intptr_t) first_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          (uint8_t *) "third",
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if changing the entry name is reflected by the index
+	 */
+	result = libfwps_record_set_utf8_entry_name(
+	          first_record,
+	          (uint8_t *) "third",
+	          5,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          (uint8_t *) "second",
+	          6,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record = NULL;
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          (uint8_t *) "third",
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INTPTR(
+	 "record",
+	 (intptr_t) record,
+	 (intptr_t) first_record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          NULL,
+	          (uint8_t *) "first",
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_record_by_utf8_entry_name(
+	          set,
+	          NULL,
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_record_by_entry_type(
+	          set,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_set_parse_flags, libfwps_set_get_number_of_anomalies
+ * and libfwps_set_get_anomaly_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_set_parse_flags(
+     void )
+{
+	uint8_t byte_stream[ 141 ];
+
+	libcerror_error_t *error = NULL;
+	libfwps_set_t *set       = NULL;
+	off64_t offset           = 0;
+	int anomaly_type         = 0;
+	int number_of_anomalies  = 0;
+	int number_of_records    = 0;
+	int parse_error_code     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_set_data1,
+	 141 );
+
+	/* The record has an unsupported value type
+	 */
+	byte_stream[ 33 ] = 0xff;
+
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_set_parse_flags(
+	          set,
+	          LIBFWPS_PARSE_FLAG_LENIENT,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The set is kept without the record
+	 */
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_number_of_records(
+	          set,
+	          &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_number_of_anomalies(
+	          set,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_anomaly_by_index(
+	          set,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record size that exceeds the data
+	 */
+	byte_stream[ 24 ] = 0xff;
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_anomaly_by_index(
+	          set,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_set_parse_flags(
+	          NULL,
+	          LIBFWPS_PARSE_FLAG_LENIENT,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_set_parse_flags(
+	          set,
+	          0xff,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_number_of_anomalies(
+	          NULL,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_number_of_anomalies(
+	          set,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_anomaly_by_index(
+	          NULL,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_anomaly_by_index(
+	          set,
+	          1,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( set != NULL )
+	{
+		libfwps_set_free(
+		 &set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_set_value_data_threshold function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_set_value_data_threshold(
+     libfwps_set_t *set )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_set_value_data_threshold(
+	          set,
+	          1024,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_set_value_data_threshold(
+	          set,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_set_value_data_threshold(
+	          NULL,
+	          1024,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_set_value_data_threshold(
+	          set,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_get_serialized_size and libfwps_set_copy_to_byte_stream functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_copy_to_byte_stream(
+     libfwps_set_t *set )
+{
+	uint8_t byte_stream[ 141 ];
+
+	libcerror_error_t *error = NULL;
+	size_t serialized_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_get_serialized_size(
+	          set,
+	          &serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) 137 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_to_byte_stream(
+	          set,
+	          byte_stream,
+	          141,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The set is serialized without the terminator
+	 */
+	result = memory_compare(
+	          byte_stream,
+	          fwps_test_set_data1,
+	          137 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_set_get_serialized_size(
+	          NULL,
+	          &serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_serialized_size(
+	          set,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          141,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_copy_to_byte_stream(
+	          set,
+	          NULL,
+	          141,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_copy_to_byte_stream(
+	          set,
+	          byte_stream,
+	          136,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_set_set_parse_limits function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_set_parse_limits(
+     void )
 {
 	libcerror_error_t *error = NULL;
+	libfwps_set_t *set       = NULL;
+	size_t error_offset      = 0;
+	int error_code           = 0;
 	int number_of_records    = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
+	result = libfwps_set_set_parse_limits(
+	          set,
+	          4096,
+	          1,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a parse that exceeds the maximum total size
+	 */
+	result = libfwps_set_initialize(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_set_parse_limits(
+	          set,
+	          64,
+	          0,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          fwps_test_set_data1,
+	          141,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_set_get_parse_error(
+	          set,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfwps_set_get_number_of_records(
 	          set,
 	          &number_of_records,
@@ -503,7 +2220,7 @@ int fwps_test_set_get_number_of_records(
 	FWPS_TEST_ASSERT_EQUAL_INT(
 	 "number_of_records",
 	 number_of_records,
-	 1 );
+	 0 );
 
 	FWPS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -511,9 +2228,11 @@ int fwps_test_set_get_number_of_records(
 
 	/* Test error cases
 	 */
-	result = libfwps_set_get_number_of_records(
+	result = libfwps_set_set_parse_limits(
 	          NULL,
-	          &number_of_records,
+	          0,
+	          0,
+	          0,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -528,9 +2247,11 @@ int fwps_test_set_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwps_set_get_number_of_records(
+	result = libfwps_set_set_parse_limits(
 	          set,
-	          NULL,
+	          0,
+	          -1,
+	          0,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -545,6 +2266,25 @@ int fwps_test_set_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -553,6 +2293,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( set != NULL )
+	{
+		libfwps_set_free(
+		 &set,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -589,6 +2335,26 @@ int main(
 	 "libfwps_set_copy_from_byte_stream",
 	 fwps_test_set_copy_from_byte_stream );
 
+	FWPS_TEST_RUN(
+	 "libfwps_set_get_parse_error",
+	 fwps_test_set_get_parse_error );
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_scan_byte_stream",
+	 fwps_test_set_scan_byte_stream );
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_get_record_by_utf8_entry_name",
+	 fwps_test_set_get_record_by_utf8_entry_name );
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_set_parse_limits",
+	 fwps_test_set_set_parse_limits );
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_set_parse_flags",
+	 fwps_test_set_set_parse_flags );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize set for tests
@@ -635,6 +2401,21 @@ int main(
 
 	/* TODO: add tests for libfwps_set_get_record_by_index */
 
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_set_get_record_by_entry_type",
+	 fwps_test_set_get_record_by_entry_type,
+	 set );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_set_set_value_data_threshold",
+	 fwps_test_set_set_value_data_threshold,
+	 set );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_set_copy_to_byte_stream",
+	 fwps_test_set_copy_to_byte_stream,
+	 set );
+
 	/* Clean up
 	 */
 	result = libfwps_set_free(
@@ -20,13 +20,17 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fwps_test_functions.h"
+#include "fwps_test_libbfio.h"
 #include "fwps_test_libcerror.h"
 #include "fwps_test_libfwps.h"
 #include "fwps_test_macros.h"
@@ -479,21 +483,3945 @@ on_error:
 	return( 0 );
 }
 
+/* Record callback function for the scan byte stream tests
+ * Returns 1 to continue the scan, 0 to stop the scan or -1 on error
+ */
+int fwps_test_store_scan_record_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	uint32_t entry_type = 0;
+
+	if( ( set_identifier == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libfwps_record_get_entry_type(
+	     record,
+	     &entry_type,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( entry_type != 4 )
+	{
+		return( -1 );
+	}
+	*( (int *) callback_data ) += 1;
+
+	return( 1 );
+}
+
+/* Record callback function that stops the scan
+ * Returns 0 to stop the scan
+ */
+int fwps_test_store_scan_record_callback_stop(
+     const uint8_t *set_identifier FWPS_TEST_ATTRIBUTE_UNUSED,
+     libfwps_record_t *record FWPS_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWPS_TEST_ATTRIBUTE_UNUSED )
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( set_identifier )
+	FWPS_TEST_UNREFERENCED_PARAMETER( record )
+	FWPS_TEST_UNREFERENCED_PARAMETER( error )
+
+	*( (int *) callback_data ) += 1;
+
+	return( 0 );
+}
+
+/* Tests the libfwps_store_scan_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_scan_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_scan_byte_stream(
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_store_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records = 0;
+
+	result = libfwps_store_scan_byte_stream(
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_store_scan_record_callback_stop,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_scan_byte_stream(
+	          NULL,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_store_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_scan_byte_stream(
+	          fwps_test_store_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &fwps_test_store_scan_record_callback,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_scan_byte_stream(
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          (void *) &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_get_parse_error function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_get_parse_error(
+     void )
+{
+	uint8_t byte_stream[ 145 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfwps_store_t *store           = NULL;
+	size_t error_offset              = 0;
+	int error_code                   = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse error of a set with an unsupported signature
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_store_data1,
+	 145 );
+
+	byte_stream[ 4 ] = 0xff;
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_SIGNATURE );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse error of a record with an unsupported value type
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_store_data1,
+	 145 );
+
+	byte_stream[ 33 ] = 0x0d;
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          NULL );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 37 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that opening a file IO handle replaces the parse error of a previous copy from byte stream
+	 */
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          fwps_test_store_data1,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse error of a record with an unsupported value type using a file IO handle
+	 */
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          byte_stream,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "error_offset",
+	 error_offset,
+	 (size_t) 37 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_parse_error(
+	          NULL,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          NULL,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_open_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfwps_record_t *record         = NULL;
+	libfwps_set_t *set               = NULL;
+	libfwps_store_t *store           = NULL;
+	uint8_t *store_data              = NULL;
+	uint8_t *value_data              = NULL;
+	size_t data_offset               = 0;
+	size_t value_data_size           = 0;
+	int number_of_sets               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          fwps_test_store_data1,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          NULL,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          -1,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test with a binary data value that is read on demand
+	 * a store with 1 set with 1 record containing 8192 bytes of value data
+	 */
+	store_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 8241 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store_data",
+	 store_data );
+
+	memory_set(
+	 store_data,
+	 0,
+	 8241 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 store_data,
+	 8237 );
+
+	memory_copy(
+	 &( store_data[ 4 ] ),
+	 "1SPS",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( store_data[ 24 ] ),
+	 8209 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( store_data[ 28 ] ),
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( store_data[ 33 ] ),
+	 LIBFWPS_VALUE_TYPE_BINARY_DATA );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( store_data[ 37 ] ),
+	 8192 );
+
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		store_data[ 41 + data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          store_data,
+	          8241,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_set_by_index(
+	          store,
+	          0,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_record_by_index(
+	          set,
+	          0,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_size(
+	          record,
+	          &value_data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 8192 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 8192 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "value_data",
+	 value_data );
+
+	result = libfwps_record_get_data(
+	          record,
+	          value_data,
+	          8192,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( store_data[ 41 ] ),
+	          8192 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 value_data );
+
+	value_data = NULL;
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 store_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value_data != NULL )
+	{
+		memory_free(
+		 value_data );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( store_data != NULL )
+	{
+		memory_free(
+		 store_data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_append_set function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_append_set(
+     void )
+{
+	uint8_t expected_string_data[ 10 ] = {
+		'v', 0, 'a', 0, 'l', 0, 'u', 0, 'e', 0 };
+
+	uint8_t named_properties_identifier[ 16 ] = {
+		0x05, 0xd5, 0xcd, 0xd5, 0x9c, 0x2e, 0x1b, 0x10, 0x93, 0x97, 0x08, 0x00, 0x2b, 0x2c, 0xf9, 0xae };
+
+	uint8_t numeric_properties_identifier[ 16 ] = {
+		0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+	uint8_t *byte_stream       = NULL;
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error   = NULL;
+	libfwps_record_t *record   = NULL;
+	libfwps_set_t *set         = NULL;
+	libfwps_store_t *store     = NULL;
+	size_t data_size           = 0;
+	size_t serialized_size     = 0;
+	uint32_t entry_type        = 0;
+	uint32_t value_32bit       = 0;
+	int number_of_sets         = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_append_set(
+	          store,
+	          numeric_properties_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_append_record(
+	          set,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_entry_type(
+	          record,
+	          3,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_data_as_32bit_integer(
+	          record,
+	          0x12345678UL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the entry name is set on a numeric record
+	 */
+	result = libfwps_record_set_utf8_entry_name(
+	          record,
+	          (uint8_t *) "name",
+	          4,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data size does not match the value type
+	 */
+	result = libfwps_record_set_data(
+	          record,
+	          LIBFWPS_VALUE_TYPE_INTEGER_32BIT_UNSIGNED,
+	          data,
+	          2,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = NULL;
+	set    = NULL;
+
+	result = libfwps_store_append_set(
+	          store,
+	          named_properties_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_append_record(
+	          set,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_utf8_entry_name(
+	          record,
+	          (uint8_t *) "name",
+	          4,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_set_data_as_utf8_string(
+	          record,
+	          (uint8_t *) "value",
+	          5,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the entry type is set on a named record
+	 */
+	result = libfwps_record_set_entry_type(
+	          record,
+	          3,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = NULL;
+	set    = NULL;
+
+	/* Serialize the store
+	 */
+	result = libfwps_store_get_serialized_size(
+	          store,
+	          &serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) 116 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * serialized_size );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "byte_stream",
+	 byte_stream );
+
+	result = libfwps_store_copy_to_byte_stream(
+	          store,
+	          byte_stream,
+	          serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the serialized store
+	 */
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          serialized_size,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 2 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_set_by_index(
+	          store,
+	          0,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_record_by_index(
+	          set,
+	          0,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_entry_type(
+	          record,
+	          &entry_type,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "entry_type",
+	 entry_type,
+	 (uint32_t) 3 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_as_32bit_integer(
+	          record,
+	          &value_32bit,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x12345678UL );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record = NULL;
+	set    = NULL;
+
+	result = libfwps_store_get_set_by_index(
+	          store,
+	          1,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_record_by_index(
+	          set,
+	          0,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data_size(
+	          record,
+	          &data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 12 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_record_get_data(
+	          record,
+	          data,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_string_data,
+	          10 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	record = NULL;
+	set    = NULL;
+
+	/* Test error cases
+	 */
+	result = libfwps_store_append_set(
+	          NULL,
+	          numeric_properties_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_append_set(
+	          store,
+	          NULL,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_append_set(
+	          store,
+	          numeric_properties_identifier,
+	          8,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_append_set(
+	          store,
+	          numeric_properties_identifier,
+	          16,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 byte_stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_set_value_data_threshold function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_set_value_data_threshold(
+     libfwps_store_t *store )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_set_value_data_threshold(
+	          store,
+	          1024,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_set_value_data_threshold(
+	          store,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_set_value_data_threshold(
+	          NULL,
+	          1024,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_value_data_threshold(
+	          store,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_set_parse_limits function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_set_parse_limits(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwps_store_t *store   = NULL;
+	size_t error_offset      = 0;
+	int error_code           = 0;
+	int number_of_sets       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_set_parse_limits(
+	          store,
+	          4096,
+	          1,
+	          1,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a parse that exceeds the maximum total size
+	 */
+	result = libfwps_store_set_parse_limits(
+	          store,
+	          64,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          fwps_test_store_data1,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_parse_error(
+	          store,
+	          &error_code,
+	          &error_offset,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBFWPS_PARSE_ERROR_LIMIT_EXCEEDED );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_set_parse_limits(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_parse_limits(
+	          store,
+	          0,
+	          -1,
+	          0,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_parse_limits(
+	          store,
+	          0,
+	          0,
+	          -1,
+	          0,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_set_parse_flags, libfwps_store_get_number_of_anomalies
+ * and libfwps_store_get_anomaly_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_set_parse_flags(
+     void )
+{
+	uint8_t byte_stream[ 145 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libfwps_set_t *set               = NULL;
+	libfwps_store_t *store           = NULL;
+	off64_t offset                   = 0;
+	int anomaly_type                 = 0;
+	int number_of_anomalies          = 0;
+	int number_of_records            = 0;
+	int number_of_sets               = 0;
+	int parse_error_code             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_copy(
+	 byte_stream,
+	 fwps_test_store_data1,
+	 145 );
+
+	/* The record has an unsupported value type
+	 */
+	byte_stream[ 33 ] = 0xff;
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_parse_flags(
+	          store,
+	          LIBFWPS_PARSE_FLAG_LENIENT,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The set is kept without the record
+	 */
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_set_by_index(
+	          store,
+	          0,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_number_of_records(
+	          set,
+	          &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_anomalies(
+	          store,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_anomaly_by_index(
+	          store,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a set size that exceeds the data
+	 */
+	byte_stream[ 0 ] = 0xff;
+
+	result = libfwps_store_copy_from_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_anomaly_by_index(
+	          store,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test parse flags when opening a file IO handle
+	 */
+	byte_stream[ 0 ] = 0x89;
+
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          byte_stream,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_parse_flags(
+	          store,
+	          LIBFWPS_PARSE_FLAG_LENIENT,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The set is kept without the record
+	 */
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_set_by_index(
+	          store,
+	          0,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_get_number_of_records(
+	          set,
+	          &number_of_records,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_number_of_anomalies(
+	          store,
+	          &number_of_anomalies,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_anomalies",
+	 number_of_anomalies,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_anomaly_by_index(
+	          store,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_RECORD_SKIPPED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_UNSUPPORTED_VALUE_TYPE );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a set size that exceeds the data when opening a file IO handle
+	 */
+	byte_stream[ 0 ] = 0xff;
+
+	result = fwps_test_open_file_io_handle(
+	          &file_io_handle,
+	          byte_stream,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_open_file_io_handle(
+	          store,
+	          file_io_handle,
+	          0,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_anomaly_by_index(
+	          store,
+	          0,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "anomaly_type",
+	 anomaly_type,
+	 LIBFWPS_ANOMALY_TYPE_DATA_TRUNCATED );
+
+	FWPS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "parse_error_code",
+	 parse_error_code,
+	 LIBFWPS_PARSE_ERROR_SIZE_OUT_OF_BOUNDS );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_set_parse_flags(
+	          NULL,
+	          LIBFWPS_PARSE_FLAG_LENIENT,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_set_parse_flags(
+	          store,
+	          0xff,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_anomaly_by_index(
+	          store,
+	          1,
+	          &anomaly_type,
+	          &offset,
+	          &parse_error_code,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "store",
+	 store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( set != NULL )
+	{
+		libfwps_set_free(
+		 &set,
+		 NULL );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwps_store_get_number_of_sets function
  * Returns 1 if successful or 0 if not
  */
-int fwps_test_store_get_number_of_sets(
-     libfwps_store_t *store )
+int fwps_test_store_get_number_of_sets(
+     libfwps_store_t *store )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_sets       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sets",
+	 number_of_sets,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_number_of_sets(
+	          NULL,
+	          &number_of_sets,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_number_of_sets(
+	          store,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_get_set_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_get_set_by_identifier(
+     libfwps_store_t *store )
+{
+	uint8_t format_class_identifier[ 16 ] = {
+		0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce };
+
+	uint8_t unknown_format_class_identifier[ 16 ] = {
+		0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+	libcerror_error_t *error = NULL;
+	libfwps_set_t *set       = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          format_class_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_free(
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          unknown_format_class_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "set",
+	 set );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_set_by_identifier(
+	          NULL,
+	          format_class_identifier,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          NULL,
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          format_class_identifier,
+	          8,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_set_by_identifier(
+	          store,
+	          format_class_identifier,
+	          16,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_get_record_by_property_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_get_record_by_property_key(
+     libfwps_store_t *store )
+{
+	uint8_t format_class_identifier[ 16 ] = {
+		0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce };
+
+	uint8_t unknown_format_class_identifier[ 16 ] = {
+		0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+	libcerror_error_t *error = NULL;
+	libfwps_record_t *record = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          format_class_identifier,
+	          16,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record = NULL;
+
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          format_class_identifier,
+	          16,
+	          5,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          unknown_format_class_identifier,
+	          16,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_record_by_property_key(
+	          NULL,
+	          format_class_identifier,
+	          16,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          NULL,
+	          16,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          format_class_identifier,
+	          8,
+	          4,
+	          &record,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_record_by_property_key(
+	          store,
+	          format_class_identifier,
+	          16,
+	          4,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_copy_to_byte_stream(
+     libfwps_store_t *store )
+{
+	uint8_t byte_stream[ 145 ];
+
+	libcerror_error_t *error = NULL;
+	size_t serialized_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_get_serialized_size(
+	          store,
+	          &serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_SIZE(
+	 "serialized_size",
+	 serialized_size,
+	 (size_t) 141 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_to_byte_stream(
+	          store,
+	          byte_stream,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The store is serialized without the trailing data
+	 */
+	result = memory_compare(
+	          byte_stream,
+	          fwps_test_store_data1,
+	          141 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_serialized_size(
+	          NULL,
+	          &serialized_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_serialized_size(
+	          store,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_copy_to_byte_stream(
+	          store,
+	          NULL,
+	          145,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_copy_to_byte_stream(
+	          store,
+	          byte_stream,
+	          140,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwps_store_get_content_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_get_content_hash(
+     libfwps_store_t *store )
+{
+	uint8_t byte_stream[ 145 ];
+	uint8_t compare_hash[ 16 ];
+	uint8_t hash[ 16 ];
+	uint8_t set_byte_stream[ 137 ];
+
+	libcerror_error_t *error       = NULL;
+	libfwps_set_t *set             = NULL;
+	libfwps_store_t *compare_store = NULL;
+	libfwps_store_t *other_store   = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwps_store_get_content_hash(
+	          store,
+	          hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Trailing data does not change the content hash
+	 */
+	result = memory_copy(
+	          byte_stream,
+	          fwps_test_store_data1,
+	          145 ) != NULL;
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	byte_stream[ 141 ] = 0xff;
+	byte_stream[ 144 ] = 0xff;
+
+	result = libfwps_store_initialize(
+	          &compare_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "compare_store",
+	 compare_store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          compare_store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_content_hash(
+	          compare_store,
+	          compare_hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          compare_hash,
+	          16 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A different value changes the content hash
+	 */
+	byte_stream[ 41 ] = 0x54;
+
+	result = libfwps_store_copy_from_byte_stream(
+	          compare_store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_content_hash(
+	          compare_store,
+	          compare_hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          compare_hash,
+	          16 );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Changing the identifier of a set of the store updates the order of the sets
+	 */
+	result = memory_copy(
+	          set_byte_stream,
+	          fwps_test_store_data1,
+	          137 ) != NULL;
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	set_byte_stream[ 8 ] = 0xe3;
+
+	result = libfwps_store_get_set_by_index(
+	          compare_store,
+	          0,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          set_byte_stream,
+	          137,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_get_content_hash(
+	          compare_store,
+	          compare_hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	set = NULL;
+
+	result = libfwps_store_initialize(
+	          &other_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "other_store",
+	 other_store );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_copy_from_byte_stream(
+	          other_store,
+	          byte_stream,
+	          145,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_append_set(
+	          other_store,
+	          &( set_byte_stream[ 8 ] ),
+	          16,
+	          &set,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          set_byte_stream,
+	          137,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_set_copy_from_byte_stream(
+	          set,
+	          set_byte_stream,
+	          137,
+	          LIBFWPS_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	set = NULL;
+
+	result = libfwps_store_get_content_hash(
+	          other_store,
+	          hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          compare_hash,
+	          16 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwps_store_free(
+	          &other_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &compare_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwps_store_get_content_hash(
+	          NULL,
+	          hash,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_content_hash(
+	          store,
+	          NULL,
+	          16,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_get_content_hash(
+	          store,
+	          hash,
+	          15,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( other_store != NULL )
+	{
+		libfwps_store_free(
+		 &other_store,
+		 NULL );
+	}
+	if( compare_store != NULL )
+	{
+		libfwps_store_free(
+		 &compare_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Appends a set with numeric records to a store
+ * Returns 1 if successful or -1 on error
+ */
+int fwps_test_store_append_numeric_set(
+     libfwps_store_t *store,
+     const uint8_t *guid_data,
+     const uint32_t *entry_types,
+     const uint32_t *values,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libfwps_record_t *record = NULL;
+	libfwps_set_t *set       = NULL;
+	int record_index         = 0;
+
+	if( libfwps_store_append_set(
+	     store,
+	     guid_data,
+	     16,
+	     &set,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		record = NULL;
+
+		if( libfwps_set_append_record(
+		     set,
+		     &record,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfwps_record_set_entry_type(
+		     record,
+		     entry_types[ record_index ],
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfwps_record_set_data_as_32bit_integer(
+		     record,
+		     values[ record_index ],
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Counts the differences by difference type
+ * Returns 1 to continue
+ */
+int fwps_test_store_diff_callback(
+     const uint8_t *set_identifier,
+     libfwps_record_t *first_record,
+     libfwps_record_t *second_record,
+     int difference_type,
+     void *callback_data,
+     libcerror_error_t **error FWPS_TEST_ATTRIBUTE_UNUSED )
+{
+	int *number_of_differences = (int *) callback_data;
+
+	FWPS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( set_identifier == NULL )
+	 || ( difference_type < LIBFWPS_DIFFERENCE_TYPE_ADDED )
+	 || ( difference_type > LIBFWPS_DIFFERENCE_TYPE_CHANGED ) )
+	{
+		return( -1 );
+	}
+	if( ( difference_type == LIBFWPS_DIFFERENCE_TYPE_ADDED )
+	 && ( ( first_record != NULL )
+	  ||  ( second_record == NULL ) ) )
+	{
+		return( -1 );
+	}
+	if( ( difference_type == LIBFWPS_DIFFERENCE_TYPE_REMOVED )
+	 && ( ( first_record == NULL )
+	  ||  ( second_record != NULL ) ) )
+	{
+		return( -1 );
+	}
+	if( ( difference_type == LIBFWPS_DIFFERENCE_TYPE_CHANGED )
+	 && ( ( first_record == NULL )
+	  ||  ( second_record == NULL ) ) )
+	{
+		return( -1 );
+	}
+	number_of_differences[ difference_type ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfwps_store_diff and libfwps_store_compare functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_store_diff(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_sets       = 0;
-	int result               = 0;
+	uint8_t first_set_identifier[ 16 ] = {
+		0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+	uint8_t second_set_identifier[ 16 ] = {
+		0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce };
+
+	uint32_t first_entry_types[ 3 ]  = { 2, 3, 4 };
+	uint32_t first_values[ 3 ]       = { 1, 2, 3 };
+	uint32_t second_entry_types[ 3 ] = { 5, 4, 3 };
+	uint32_t second_values[ 3 ]      = { 7, 3, 5 };
+	int number_of_differences[ 4 ];
+
+	libcerror_error_t *error      = NULL;
+	libfwps_store_t *first_store  = NULL;
+	libfwps_store_t *second_store = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwps_store_initialize(
+	          &first_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_store_append_numeric_set(
+	          first_store,
+	          first_set_identifier,
+	          first_entry_types,
+	          first_values,
+	          3,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_initialize(
+	          &second_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_store_append_numeric_set(
+	          second_store,
+	          second_set_identifier,
+	          second_entry_types,
+	          second_values,
+	          1,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwps_test_store_append_numeric_set(
+	          second_store,
+	          first_set_identifier,
+	          second_entry_types,
+	          second_values,
+	          3,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libfwps_store_get_number_of_sets(
-	          store,
-	          &number_of_sets,
+	memory_set(
+	 number_of_differences,
+	 0,
+	 sizeof( int ) * 4 );
+
+	result = libfwps_store_diff(
+	          first_store,
+	          second_store,
+	          &fwps_test_store_diff_callback,
+	          number_of_differences,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -501,9 +4429,50 @@ int fwps_test_store_get_number_of_sets(
 	 result,
 	 1 );
 
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Entry type 5 of both sets is added, entry type 2 is removed
+	 * and entry type 3 is changed
+	 */
 	FWPS_TEST_ASSERT_EQUAL_INT(
-	 "number_of_sets",
-	 number_of_sets,
+	 "number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_ADDED ]",
+	 number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_ADDED ],
+	 2 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_REMOVED ]",
+	 number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_REMOVED ],
+	 1 );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_CHANGED ]",
+	 number_of_differences[ LIBFWPS_DIFFERENCE_TYPE_CHANGED ],
+	 1 );
+
+	result = libfwps_store_compare(
+	          first_store,
+	          second_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_compare(
+	          first_store,
+	          first_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
 
 	FWPS_TEST_ASSERT_IS_NULL(
@@ -512,9 +4481,11 @@ int fwps_test_store_get_number_of_sets(
 
 	/* Test error cases
 	 */
-	result = libfwps_store_get_number_of_sets(
+	result = libfwps_store_diff(
 	          NULL,
-	          &number_of_sets,
+	          second_store,
+	          &fwps_test_store_diff_callback,
+	          number_of_differences,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -529,9 +4500,47 @@ int fwps_test_store_get_number_of_sets(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwps_store_get_number_of_sets(
-	          store,
+	result = libfwps_store_diff(
+	          first_store,
+	          NULL,
+	          &fwps_test_store_diff_callback,
+	          number_of_differences,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_diff(
+	          first_store,
+	          second_store,
+	          NULL,
+	          number_of_differences,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_store_compare(
 	          NULL,
+	          second_store,
 	          &error );
 
 	FWPS_TEST_ASSERT_EQUAL_INT(
@@ -546,6 +4555,34 @@ int fwps_test_store_get_number_of_sets(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwps_store_free(
+	          &second_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwps_store_free(
+	          &first_store,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -554,6 +4591,18 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( second_store != NULL )
+	{
+		libfwps_store_free(
+		 &second_store,
+		 NULL );
+	}
+	if( first_store != NULL )
+	{
+		libfwps_store_free(
+		 &first_store,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -590,6 +4639,34 @@ int main(
 	 "libfwps_store_copy_from_byte_stream",
 	 fwps_test_store_copy_from_byte_stream );
 
+	FWPS_TEST_RUN(
+	 "libfwps_store_scan_byte_stream",
+	 fwps_test_store_scan_byte_stream );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_get_parse_error",
+	 fwps_test_store_get_parse_error );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_open_file_io_handle",
+	 fwps_test_store_open_file_io_handle );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_append_set",
+	 fwps_test_store_append_set );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_set_parse_limits",
+	 fwps_test_store_set_parse_limits );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_set_parse_flags",
+	 fwps_test_store_set_parse_flags );
+
+	FWPS_TEST_RUN(
+	 "libfwps_store_diff",
+	 fwps_test_store_diff );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize store for tests
@@ -627,6 +4704,11 @@ int main(
 	 "error",
 	 error );
 
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_store_set_value_data_threshold",
+	 fwps_test_store_set_value_data_threshold,
+	 store );
+
 	FWPS_TEST_RUN_WITH_ARGS(
 	 "libfwps_store_get_number_of_sets",
 	 fwps_test_store_get_number_of_sets,
@@ -634,6 +4716,26 @@ int main(
 
 	/* TODO: add tests for libfwps_store_get_set_by_index */
 
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_store_get_set_by_identifier",
+	 fwps_test_store_get_set_by_identifier,
+	 store );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_store_get_record_by_property_key",
+	 fwps_test_store_get_record_by_property_key,
+	 store );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_store_copy_to_byte_stream",
+	 fwps_test_store_copy_to_byte_stream,
+	 store );
+
+	FWPS_TEST_RUN_WITH_ARGS(
+	 "libfwps_store_get_content_hash",
+	 fwps_test_store_get_content_hash,
+	 store );
+
 	/* Clean up
 	 */
 	result = libfwps_store_free(
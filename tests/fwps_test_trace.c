@@ -0,0 +1,323 @@
+/*
+ * Library trace functions test program
+ *
+ * Copyright (C) 2013-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwps_test_libcerror.h"
+#include "fwps_test_libfwps.h"
+#include "fwps_test_macros.h"
+#include "fwps_test_memory.h"
+#include "fwps_test_unused.h"
+
+typedef struct fwps_test_trace_context fwps_test_trace_context_t;
+
+struct fwps_test_trace_context
+{
+	/* The number of begin events
+	 */
+	int number_of_begin_events;
+
+	/* The number of end events
+	 */
+	int number_of_end_events;
+
+	/* The value type of the last record end event
+	 */
+	uint32_t record_value_type;
+};
+
+/* A store with a single set that contains a 32-bit integer record
+ */
+uint8_t fwps_test_trace_store_data1[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43,
+	0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00 };
+
+/* Handles a trace event for the trace tests
+ */
+void fwps_test_trace_function(
+      const libfwps_trace_event_t *event,
+      void *context )
+{
+	fwps_test_trace_context_t *trace_context = (fwps_test_trace_context_t *) context;
+
+	if( event->event_type == LIBFWPS_TRACE_EVENT_TYPE_BEGIN )
+	{
+		trace_context->number_of_begin_events += 1;
+	}
+	else if( event->event_type == LIBFWPS_TRACE_EVENT_TYPE_END )
+	{
+		trace_context->number_of_end_events += 1;
+
+		if( event->stage == LIBFWPS_TRACE_STAGE_RECORD )
+		{
+			trace_context->record_value_type = event->value_type;
+		}
+	}
+}
+
+/* Tests the libfwps_set_trace_function and libfwps_get_value_type_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwps_test_set_trace_function(
+     void )
+{
+	fwps_test_trace_context_t trace_context;
+
+	libcerror_error_t *error           = NULL;
+	libfwps_store_t *store             = NULL;
+	uint64_t initial_number_of_records = 0;
+	uint64_t initial_value_data_size   = 0;
+	uint64_t number_of_records         = 0;
+	uint64_t value_data_size           = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	trace_context.number_of_begin_events = 0;
+	trace_context.number_of_end_events   = 0;
+	trace_context.record_value_type      = 0;
+
+	result = libfwps_get_value_type_statistics(
+	          LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          &initial_number_of_records,
+	          &initial_value_data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwps_set_trace_function(
+	          &fwps_test_trace_function,
+	          &trace_context,
+	          &error );
+
+	FWPS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The trace function is only called if libfwps was built with parse tracing
+	 */
+	if( result != 0 )
+	{
+		result = libfwps_store_initialize(
+		          &store,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_store_copy_from_byte_stream(
+		          store,
+		          fwps_test_trace_store_data1,
+		          49,
+		          LIBFWPS_CODEPAGE_WINDOWS_1252,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwps_store_free(
+		          &store,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A begin and end event for the store, the set and the record
+		 */
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "trace_context.number_of_begin_events",
+		 trace_context.number_of_begin_events,
+		 3 );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "trace_context.number_of_end_events",
+		 trace_context.number_of_end_events,
+		 3 );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT32(
+		 "trace_context.record_value_type",
+		 trace_context.record_value_type,
+		 (uint32_t) LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED );
+
+		result = libfwps_get_value_type_statistics(
+		          LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+		          &number_of_records,
+		          &value_data_size,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_records",
+		 number_of_records,
+		 initial_number_of_records + 1 );
+
+		FWPS_TEST_ASSERT_EQUAL_UINT64(
+		 "value_data_size",
+		 value_data_size,
+		 initial_value_data_size + 4 );
+
+		result = libfwps_set_trace_function(
+		          NULL,
+		          NULL,
+		          &error );
+
+		FWPS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWPS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwps_get_value_type_statistics(
+	          LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwps_get_value_type_statistics(
+	          LIBFWPS_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          &number_of_records,
+	          NULL,
+	          &error );
+
+	FWPS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWPS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( store != NULL )
+	{
+		libfwps_store_free(
+		 &store,
+		 NULL );
+	}
+	libfwps_set_trace_function(
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWPS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWPS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWPS_TEST_UNREFERENCED_PARAMETER( argc )
+	FWPS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWPS_TEST_RUN(
+	 "libfwps_set_trace_function",
+	 fwps_test_set_trace_function );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,9 +20,12 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import datetime
+import pickle
 import os
 import sys
 import unittest
+import uuid
 
 import pyfwps
 
@@ -44,6 +47,35 @@ class RecordTypeTests(unittest.TestCase):
       0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00,
       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]))
 
+  _TEST_VECTOR_DATA = bytes(bytearray([
+      0x39, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+      0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+      0x1d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x13, 0x10, 0x00,
+      0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+      0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00]))
+
+  _TEST_FILETIME_DATA = bytes(bytearray([
+      0x31, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+      0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+      0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+      0x00, 0x87, 0x56, 0xcc, 0xe2, 0x55, 0x25, 0xd0, 0x01, 0x00, 0x00, 0x00,
+      0x00]))
+
+  _TEST_FILETIME_VECTOR_DATA = bytes(bytearray([
+      0x3d, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+      0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+      0x21, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00,
+      0x00, 0x02, 0x00, 0x00, 0x00, 0x87, 0x56, 0xcc, 0xe2, 0x55, 0x25, 0xd0,
+      0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00]))
+
+  _TEST_GUID_DATA = bytes(bytearray([
+      0x39, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+      0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+      0x1d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+      0x00, 0xe2, 0x8a, 0x58, 0x46, 0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13,
+      0x93, 0x26, 0x98, 0x6d, 0xce, 0x00, 0x00, 0x00, 0x00]))
+
   def test_get_entry_name(self):
     """Tests the get_entry_name function and entry_name property."""
     fwps_set = pyfwps.set()
@@ -114,6 +146,55 @@ class RecordTypeTests(unittest.TestCase):
 
     self.assertIsNotNone(fwps_record.data)
 
+  def test_get_data_view(self):
+    """Tests the get_data_view function and data_view property."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    data_view = fwps_record.get_data_view()
+    self.assertIsInstance(data_view, memoryview)
+    self.assertTrue(data_view.readonly)
+    self.assertEqual(data_view.tobytes(), fwps_record.get_data())
+
+    self.assertIsInstance(fwps_record.data_view, memoryview)
+
+    # Test if the set cannot be replaced while the data is exported.
+    with self.assertRaises(BufferError):
+      fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    data_view.release()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+  def test_get_data_as_array(self):
+    """Tests the get_data_as_array function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_VECTOR_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    self.assertEqual(fwps_record.get_value_type(), 0x1013)
+
+    data_as_array = fwps_record.get_data_as_array()
+    self.assertEqual(data_as_array.typecode, 'I')
+    self.assertEqual(data_as_array.tolist(), [1, 2, 0xffffffff])
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    with self.assertRaises(IOError):
+      fwps_record.get_data_as_array()
+
   def test_get_data_as_boolean(self):
     """Tests the get_data_as_boolean function and data_as_boolean property."""
     fwps_set = pyfwps.set()
@@ -173,6 +254,121 @@ class RecordTypeTests(unittest.TestCase):
 
     self.assertIsNotNone(fwps_record.data_as_string)
 
+  def test_get_data_as_datetime(self):
+    """Tests the get_data_as_datetime function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_FILETIME_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    data_as_datetime = fwps_record.get_data_as_datetime()
+    self.assertIsNotNone(data_as_datetime)
+
+    self.assertEqual(
+        data_as_datetime.replace(tzinfo=None),
+        datetime.datetime(2015, 1, 1, 0, 0, 0, 123456))
+
+    if sys.version_info[0:2] >= (3, 7):
+      self.assertEqual(data_as_datetime.tzinfo, datetime.timezone.utc)
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    with self.assertRaises(IOError):
+      fwps_record.get_data_as_datetime()
+
+  def test_get_data_as_datetimes(self):
+    """Tests the get_data_as_datetimes function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_FILETIME_VECTOR_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    self.assertEqual(fwps_record.get_value_type(), 0x1040)
+
+    data_as_datetimes = fwps_record.get_data_as_datetimes()
+    self.assertEqual(len(data_as_datetimes), 2)
+
+    self.assertEqual(
+        [value.replace(tzinfo=None) for value in data_as_datetimes], [
+            datetime.datetime(2015, 1, 1, 0, 0, 0, 123456),
+            datetime.datetime(1601, 1, 1, 0, 0, 0)])
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_FILETIME_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    data_as_datetimes = fwps_record.get_data_as_datetimes()
+    self.assertEqual(len(data_as_datetimes), 1)
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_VECTOR_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    with self.assertRaises(IOError):
+      fwps_record.get_data_as_datetimes()
+
+  def test_get_data_as_uuid(self):
+    """Tests the get_data_as_uuid function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_GUID_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    data_as_uuid = fwps_record.get_data_as_uuid()
+    self.assertIsInstance(data_as_uuid, uuid.UUID)
+    self.assertEqual(
+        data_as_uuid, uuid.UUID('46588ae2-4cbc-4338-bbfc-139326986dce'))
+
+    self.assertEqual(str(data_as_uuid), fwps_record.get_data_as_guid())
+
+    data_as_uuids = fwps_record.get_data_as_uuids()
+    self.assertEqual(data_as_uuids, [data_as_uuid])
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    with self.assertRaises(IOError):
+      fwps_record.get_data_as_uuid()
+
+    with self.assertRaises(IOError):
+      fwps_record.get_data_as_uuids()
+
+  def test_pickle(self):
+    """Tests pickling and unpickling a record."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIsNotNone(fwps_record)
+
+    unpickled_record = pickle.loads(pickle.dumps(fwps_record))
+
+    self.assertIsInstance(unpickled_record, pyfwps.record)
+    self.assertEqual(unpickled_record.entry_type, fwps_record.entry_type)
+    self.assertEqual(unpickled_record.data, fwps_record.data)
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -20,6 +20,7 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import pickle
 import sys
 import unittest
 
@@ -43,6 +44,21 @@ class SetTypeTests(unittest.TestCase):
       0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00,
       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00]))
 
+  def test_copy_from_byte_stream(self):
+    """Tests the copy_from_byte_stream function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(bytearray(self._TEST_DATA))
+    self.assertEqual(fwps_set.number_of_records, 1)
+
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(memoryview(self._TEST_DATA))
+    self.assertEqual(fwps_set.number_of_records, 1)
+
+    with self.assertRaises(TypeError):
+      fwps_set.copy_from_byte_stream(None)
+
   def test_get_number_of_records(self):
     """Tests the get_number_of_records function and number_of_records property."""
     fwps_set = pyfwps.set()
@@ -63,6 +79,44 @@ class SetTypeTests(unittest.TestCase):
     fwps_record = fwps_set.get_record(0)
     self.assertIsNotNone(fwps_record)
 
+  def test_get_record_by_entry_type(self):
+    """Tests the get_record_by_entry_type function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_set.get_record_by_entry_type(4)
+    self.assertIs(fwps_record, fwps_set.get_record(0))
+
+    fwps_record = fwps_set.get_record_by_entry_type(5)
+    self.assertIsNone(fwps_record)
+
+    with self.assertRaises(IOError):
+      fwps_set.get_record_by_name('name')
+
+  def test_to_list(self):
+    """Tests the to_list function."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    records = fwps_set.to_list()
+    self.assertEqual(len(records), 1)
+    self.assertEqual(records[0]['entry_type'], 4)
+    self.assertEqual(records[0]['value_type'], 0x1f)
+
+  def test_pickle(self):
+    """Tests pickling and unpickling a set."""
+    fwps_set = pyfwps.set()
+
+    fwps_set.copy_from_byte_stream(self._TEST_DATA)
+
+    unpickled_set = pickle.loads(pickle.dumps(fwps_set))
+
+    self.assertIsInstance(unpickled_set, pyfwps.set)
+    self.assertEqual(unpickled_set.identifier, fwps_set.identifier)
+    self.assertEqual(unpickled_set.to_list(), fwps_set.to_list())
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
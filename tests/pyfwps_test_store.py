@@ -20,6 +20,7 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import pickle
 import sys
 import unittest
 
@@ -44,6 +45,37 @@ class StoreTypeTests(unittest.TestCase):
       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
       0x00]))
 
+  def test_copy_from_byte_stream(self):
+    """Tests the copy_from_byte_stream function."""
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+    self.assertEqual(fwps_store.number_of_sets, 1)
+
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(bytearray(self._TEST_DATA))
+    self.assertEqual(fwps_store.number_of_sets, 1)
+
+    fwps_store = pyfwps.store()
+
+    byte_stream = memoryview(b'\x00' * 8 + self._TEST_DATA)
+    fwps_store.copy_from_byte_stream(byte_stream[8:])
+    self.assertEqual(fwps_store.number_of_sets, 1)
+
+    with self.assertRaises(TypeError):
+      fwps_store.copy_from_byte_stream(None)
+
+    # Test if the store cannot be replaced while record data is exported.
+    data_view = fwps_store.get_set(0).get_record(0).get_data_view()
+
+    with self.assertRaises(BufferError):
+      fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
+    data_view.release()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
   def test_get_number_of_sets(self):
     """Tests the get_number_of_sets function and number_of_sets property."""
     fwps_store = pyfwps.store()
@@ -64,6 +96,87 @@ class StoreTypeTests(unittest.TestCase):
     fwps_set = fwps_store.get_set(0)
     self.assertIsNotNone(fwps_set)
 
+    # Test if the set and record objects are reused.
+    self.assertIs(fwps_store.sets[0], fwps_set)
+
+    fwps_record = fwps_set.get_record(0)
+    self.assertIs(fwps_store.sets[0].records[0], fwps_record)
+
+  def test_get_property(self):
+    """Tests the get_property function."""
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
+    fwps_record = fwps_store.get_property(
+        '46588ae2-4cbc-4338-bbfc-139326986dce', 4)
+    self.assertIs(fwps_record, fwps_store.sets[0].records[0])
+
+    fwps_record = fwps_store.get_property(
+        '{46588AE2-4CBC-4338-BBFC-139326986DCE}', 4)
+    self.assertIs(fwps_record, fwps_store.sets[0].records[0])
+
+    fwps_record = fwps_store.get_property(
+        '46588ae2-4cbc-4338-bbfc-139326986dce', 5)
+    self.assertIsNone(fwps_record)
+
+    fwps_record = fwps_store.get_property(
+        'f29f85e0-4ff9-1068-ab91-08002b27b3d9', 4)
+    self.assertIsNone(fwps_record)
+
+    with self.assertRaises(ValueError):
+      fwps_store.get_property('bogus', 4)
+
+  def test_to_list(self):
+    """Tests the to_list function."""
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
+    records = fwps_store.to_list()
+    self.assertEqual(len(records), 1)
+
+    expected_record = {
+        'set_identifier': '46588ae2-4cbc-4338-bbfc-139326986dce',
+        'entry_type': 4,
+        'entry_name': None,
+        'value_type': 0x1f,
+        'value': 'S-1-5-21-4060289323-199701022-3924801681-1000'}
+    self.assertEqual(records[0], expected_record)
+
+  def test_to_dict(self):
+    """Tests the to_dict function."""
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
+    records = fwps_store.to_dict()
+    self.assertEqual(
+        list(records.keys()), ['{46588ae2-4cbc-4338-bbfc-139326986dce} 4'])
+
+    records = fwps_store.to_dict(key='entry')
+    self.assertEqual(list(records.keys()), [4])
+    self.assertEqual(
+        records[4]['value'], 'S-1-5-21-4060289323-199701022-3924801681-1000')
+
+    with self.assertRaises(ValueError):
+      fwps_store.to_dict(key='bogus')
+
+  def test_pickle(self):
+    """Tests pickling and unpickling a store."""
+    fwps_store = pyfwps.store()
+
+    fwps_store.copy_from_byte_stream(self._TEST_DATA)
+
+    pickled_store = pickle.dumps(fwps_store)
+    unpickled_store = pickle.loads(pickled_store)
+
+    self.assertIsInstance(unpickled_store, pyfwps.store)
+    self.assertEqual(unpickled_store.to_list(), fwps_store.to_list())
+
+    with self.assertRaises(ValueError):
+      unpickled_store.__setstate__((self._TEST_DATA, -1))
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
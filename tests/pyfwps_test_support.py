@@ -27,11 +27,77 @@ import pyfwps
 class SupportFunctionsTests(unittest.TestCase):
   """Tests the support functions."""
 
+  _TEST_DATA = bytes(bytearray([
+      0x89, 0x00, 0x00, 0x00, 0x31, 0x53, 0x50, 0x53, 0xe2, 0x8a, 0x58, 0x46,
+      0xbc, 0x4c, 0x38, 0x43, 0xbb, 0xfc, 0x13, 0x93, 0x26, 0x98, 0x6d, 0xce,
+      0x6d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00,
+      0x00, 0x2e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x2d,
+      0x00, 0x35, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x2d, 0x00, 0x34,
+      0x00, 0x30, 0x00, 0x36, 0x00, 0x30, 0x00, 0x32, 0x00, 0x38, 0x00, 0x39,
+      0x00, 0x33, 0x00, 0x32, 0x00, 0x33, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x39,
+      0x00, 0x39, 0x00, 0x37, 0x00, 0x30, 0x00, 0x31, 0x00, 0x30, 0x00, 0x32,
+      0x00, 0x32, 0x00, 0x2d, 0x00, 0x33, 0x00, 0x39, 0x00, 0x32, 0x00, 0x34,
+      0x00, 0x38, 0x00, 0x30, 0x00, 0x31, 0x00, 0x36, 0x00, 0x38, 0x00, 0x31,
+      0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00]))
+
+
   def test_get_version(self):
     """Tests the get_version function."""
     version = pyfwps.get_version()
     self.assertIsNotNone(version)
 
+  def test_parse_many(self):
+    """Tests the parse_many function."""
+    byte_streams = [
+        self._TEST_DATA, bytearray(self._TEST_DATA),
+        memoryview(self._TEST_DATA)] * 8
+
+    for number_of_threads in (1, 4):
+      fwps_stores = pyfwps.parse_many(byte_streams, threads=number_of_threads)
+      self.assertEqual(len(fwps_stores), len(byte_streams))
+
+      for fwps_store in fwps_stores:
+        self.assertEqual(fwps_store.number_of_sets, 1)
+
+    fwps_stores = pyfwps.parse_many([])
+    self.assertEqual(fwps_stores, [])
+
+    with self.assertRaises(IOError):
+      pyfwps.parse_many([self._TEST_DATA, b'\xff' * 8], threads=2)
+
+    with self.assertRaises(TypeError):
+      pyfwps.parse_many([None])
+
+    with self.assertRaises(ValueError):
+      pyfwps.parse_many([self._TEST_DATA], threads=0)
+
+
+  def test_iter_records(self):
+    """Tests the iter_records function."""
+    byte_stream = self._TEST_DATA[:-8] + self._TEST_DATA
+
+    records = list(pyfwps.iter_records(byte_stream))
+    self.assertEqual(len(records), 2)
+
+    expected_record = (
+        '46588ae2-4cbc-4338-bbfc-139326986dce', 4, 0x1f,
+        'S-1-5-21-4060289323-199701022-3924801681-1000')
+    self.assertEqual(records[0], expected_record)
+    self.assertEqual(records[1], expected_record)
+
+    records = list(pyfwps.iter_records(memoryview(self._TEST_DATA)))
+    self.assertEqual(len(records), 1)
+
+    records = list(pyfwps.iter_records(b''))
+    self.assertEqual(records, [])
+
+    with self.assertRaises(IOError):
+      list(pyfwps.iter_records(self._TEST_DATA[:-16]))
+
+    with self.assertRaises(TypeError):
+      pyfwps.iter_records(None)
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 
 GIT_URL_PREFIX="https://github.com/libyal";
-SHARED_LIBS="libcerror libcthreads libcdata libcnotify libuna libfdatetime libfguid";
+SHARED_LIBS="libcerror libcthreads libcdata libcnotify libcsplit libuna libcfile libcpath libbfio libfdatetime libfguid";
 
 USE_HEAD="";
 
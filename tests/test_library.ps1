@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "error notify property_identifier record set store support"
+$LibraryTests = "allocator anomaly diagnostics error hash notify property_identifier record set store store_cache support trace"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="error notify property_identifier record set store support";
+LIBRARY_TESTS="allocator anomaly diagnostics error hash notify property_identifier record set store store_cache support trace";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 